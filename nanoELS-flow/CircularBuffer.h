@@ -1,138 +1,295 @@
 #ifndef CIRCULARBUFFER_H
 #define CIRCULARBUFFER_H
 
-#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
 #include <cstddef>  // For size_t
 
 /**
- * Real-time safe circular buffer for embedded systems
- * 
+ * Lock-free single-producer/single-consumer circular buffer
+ *
  * Features:
  * - Fixed-size allocation (no dynamic memory)
- * - ISR-safe operations
- * - O(1) constant time operations
- * - Thread-safe for single producer/single consumer
- * 
+ * - Lock-free on both ESP32-S3 cores and from ISRs
+ * - O(1) push/pop, O(n) bulk copies with at most two memcpy-style runs
+ * - Zero-copy contiguous spans for UART/DMA style producers and consumers
+ *
+ * Synchronisation model:
+ * - head is written only by the producer, tail only by the consumer
+ * - Both are free-running counters; size is (head - tail), so all N slots are usable
+ * - The producer publishes data with a release store of head, the consumer
+ *   acquires head before reading; the same pairing applies to tail in reverse
+ * - There is no shared read-modify-write counter, so nothing can race
+ *
  * Template parameters:
  * - T: Type of elements to store
- * - N: Maximum number of elements (must be power of 2 for optimal performance)
+ * - N: Maximum number of elements (must be power of 2)
  */
 template<typename T, size_t N>
 class CircularBuffer {
 private:
     static_assert(N > 0, "Buffer size must be greater than 0");
     static_assert((N & (N - 1)) == 0, "Buffer size must be power of 2 for optimal performance");
-    
+
     // Buffer storage - aligned for cache efficiency
     alignas(4) T buffer[N];
-    
-    // Index management - volatile for ISR safety
-    volatile size_t head;    // Write index
-    volatile size_t tail;    // Read index
-    volatile size_t count;   // Current element count
-    
+
+    // Free-running indices (wrap naturally at SIZE_MAX, masked on access)
+    std::atomic<size_t> head;    // Write counter - owned by producer
+    std::atomic<size_t> tail;    // Read counter - owned by consumer
+
+    // Performance monitoring (producer-side only)
+    size_t peakCount;
+
     // Bitmask for efficient modulo operation (works because N is power of 2)
     static constexpr size_t mask = N - 1;
-    
+
 public:
     /**
      * Constructor - initializes empty buffer
      */
-    CircularBuffer() : head(0), tail(0), count(0) {}
-    
+    CircularBuffer() : head(0), tail(0), peakCount(0) {}
+
+    // ------------------------------------------------------------------
+    // Producer side
+    // ------------------------------------------------------------------
+
     /**
      * Add element to buffer (producer operation)
      * @param item Element to add
      * @return true if successful, false if buffer full
-     * @note ISR-safe, constant time O(1)
+     * @note Lock-free, constant time O(1)
      */
     bool push(const T& item) {
-        // Check if buffer is full
-        if (count >= N) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+
+        if (h - t >= N) {
             return false;  // Buffer overflow
         }
-        
-        // Add item at head position
-        buffer[head] = item;
-        
-        // Advance head with wrap-around (efficient with power-of-2 size)
-        head = (head + 1) & mask;
-        
-        // Update count atomically (important for ISR safety)
-        count++;
-        
-        // Update peak utilization tracking
-        updatePeakCount();
-        
+
+        buffer[h & mask] = item;
+        head.store(h + 1, std::memory_order_release);
+
+        updatePeakCount(h + 1 - t);
         return true;
     }
-    
+
+    /**
+     * Add up to n elements in one operation (producer operation)
+     * @param items Source array
+     * @param n Number of elements requested
+     * @return Number of elements actually added (may be less than n when nearly full)
+     * @note Publishes all copied elements with a single release store
+     */
+    size_t pushN(const T* items, size_t n) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+
+        size_t space = N - (h - t);
+        if (n > space) n = space;
+        if (n == 0) return 0;
+
+        // Copy in at most two runs: up to end of storage, then from the start
+        size_t start = h & mask;
+        size_t first = N - start;
+        if (first > n) first = n;
+        for (size_t i = 0; i < first; i++) {
+            buffer[start + i] = items[i];
+        }
+        for (size_t i = first; i < n; i++) {
+            buffer[i - first] = items[i];
+        }
+
+        head.store(h + n, std::memory_order_release);
+        updatePeakCount(h + n - t);
+        return n;
+    }
+
+    /**
+     * Get a contiguous writable region for zero-copy production (producer operation)
+     * @param len Receives number of writable elements (0 if full)
+     * @return Pointer to first writable slot
+     * @note Nothing becomes visible to the consumer until commit() is called.
+     *       The region stops at the end of storage, so a second reserve() after
+     *       commit() may return the wrapped remainder.
+     */
+    T* reserve(size_t& len) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+
+        size_t space = N - (h - t);
+        size_t start = h & mask;
+        size_t contiguous = N - start;
+        len = (space < contiguous) ? space : contiguous;
+        return &buffer[start];
+    }
+
+    /**
+     * Publish n elements written through reserve() (producer operation)
+     * @param n Number of elements to publish (must not exceed last reserve() length)
+     */
+    void commit(size_t n) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        head.store(h + n, std::memory_order_release);
+        updatePeakCount(h + n - tail.load(std::memory_order_relaxed));
+    }
+
+    // ------------------------------------------------------------------
+    // Consumer side
+    // ------------------------------------------------------------------
+
     /**
      * Remove element from buffer (consumer operation)
      * @param item Reference to store the removed element
      * @return true if successful, false if buffer empty
-     * @note ISR-safe, constant time O(1)
+     * @note Lock-free, constant time O(1)
      */
     bool pop(T& item) {
-        // Check if buffer is empty
-        if (count == 0) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+
+        if (h == t) {
             return false;  // Buffer underflow
         }
-        
-        // Get item from tail position
-        item = buffer[tail];
-        
-        // Advance tail with wrap-around
-        tail = (tail + 1) & mask;
-        
-        // Update count atomically
-        count--;
-        
+
+        item = buffer[t & mask];
+        tail.store(t + 1, std::memory_order_release);
         return true;
     }
-    
+
+    /**
+     * Remove up to n elements in one operation (consumer operation)
+     * @param items Destination array
+     * @param n Maximum number of elements to remove
+     * @return Number of elements actually removed
+     */
+    size_t popN(T* items, size_t n) {
+        n = peekN(items, n);
+        if (n > 0) {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            tail.store(t + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * Copy up to n elements without removing them (consumer operation)
+     * @param items Destination array
+     * @param n Maximum number of elements to copy
+     * @return Number of elements copied
+     * @note Unlike peekSpan() this also reads across the end of storage;
+     *       release the elements with consume() once they are handled
+     */
+    size_t peekN(T* items, size_t n) const {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+
+        size_t available = h - t;
+        if (n > available) n = available;
+        if (n == 0) return 0;
+
+        size_t start = t & mask;
+        size_t first = N - start;
+        if (first > n) first = n;
+        for (size_t i = 0; i < first; i++) {
+            items[i] = buffer[start + i];
+        }
+        for (size_t i = first; i < n; i++) {
+            items[i] = buffer[i - first];
+        }
+        return n;
+    }
+
+    /**
+     * Get a contiguous readable region for zero-copy consumption (consumer operation)
+     * @param len Receives number of readable elements (0 if empty)
+     * @return Pointer to oldest element
+     * @note Elements stay owned by the buffer until consume() is called
+     */
+    const T* peekSpan(size_t& len) const {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+
+        size_t available = h - t;
+        size_t start = t & mask;
+        size_t contiguous = N - start;
+        len = (available < contiguous) ? available : contiguous;
+        return &buffer[start];
+    }
+
+    /**
+     * Release n elements previously read through peekSpan() (consumer operation)
+     * @param n Number of elements to release (must not exceed last peekSpan() length)
+     */
+    void consume(size_t n) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        tail.store(t + n, std::memory_order_release);
+    }
+
     /**
-     * Peek at front element without removing it
+     * Peek at front element without removing it (consumer operation)
      * @param item Reference to store the front element
      * @return true if successful, false if buffer empty
-     * @note ISR-safe, constant time O(1)
      */
     bool front(T& item) const {
-        if (count == 0) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+
+        if (h == t) {
             return false;
         }
-        
-        item = buffer[tail];
+
+        item = buffer[t & mask];
         return true;
     }
-    
+
+    /**
+     * Discard all elements currently in the buffer (consumer operation)
+     * @note Safe while the producer is running - only moves tail up to head
+     */
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // ------------------------------------------------------------------
+    // Either side (snapshots - may be stale by the time they are used)
+    // ------------------------------------------------------------------
+
     /**
      * Check if buffer is empty
      * @return true if empty
-     * @note ISR-safe, constant time O(1)
      */
     bool empty() const {
-        return count == 0;
+        return size() == 0;
     }
-    
+
     /**
      * Check if buffer is full
      * @return true if full
-     * @note ISR-safe, constant time O(1)
      */
     bool full() const {
-        return count >= N;
+        return size() >= N;
     }
-    
+
     /**
      * Get current number of elements
      * @return Number of elements in buffer
-     * @note ISR-safe, constant time O(1)
      */
     size_t size() const {
-        return count;
+        const size_t t = tail.load(std::memory_order_acquire);
+        const size_t h = head.load(std::memory_order_acquire);
+        return h - t;
     }
-    
+
+    /**
+     * Get free space
+     * @return Number of elements that can be pushed right now
+     */
+    size_t available() const {
+        return N - size();
+    }
+
     /**
      * Get maximum buffer capacity
      * @return Maximum number of elements
@@ -141,26 +298,16 @@ public:
     static constexpr size_t capacity() {
         return N;
     }
-    
-    /**
-     * Clear all elements from buffer
-     * @note ISR-safe, constant time O(1)
-     */
-    void clear() {
-        head = 0;
-        tail = 0;
-        count = 0;
-    }
-    
+
     /**
      * Get buffer utilization percentage
      * @return Utilization as percentage (0-100)
      * @note Useful for monitoring and tuning
      */
     float utilization() const {
-        return (static_cast<float>(count) / N) * 100.0f;
+        return (static_cast<float>(size()) / N) * 100.0f;
     }
-    
+
     /**
      * Get peak utilization since last reset
      * @return Peak utilization count
@@ -169,7 +316,7 @@ public:
     size_t getPeakUtilization() const {
         return peakCount;
     }
-    
+
     /**
      * Reset peak utilization counter
      */
@@ -178,11 +325,8 @@ public:
     }
 
 private:
-    // Performance monitoring
-    mutable size_t peakCount = 0;
-    
-    // Update peak count (called internally)
-    void updatePeakCount() const {
+    // Update peak count (producer side only)
+    void updatePeakCount(size_t count) {
         if (count > peakCount) {
             peakCount = count;
         }
@@ -202,4 +346,4 @@ using CircularBuffer64 = CircularBuffer<T, 64>;
 template<typename T>
 using CircularBuffer128 = CircularBuffer<T, 128>;
 
-#endif // CIRCULARBUFFER_H
\ No newline at end of file
+#endif // CIRCULARBUFFER_H
@@ -0,0 +1,150 @@
+#include "CycleEstimator.h"
+#include <math.h>
+#include <stdlib.h>
+
+CycleEstimator::CycleEstimator() {
+    reset();
+}
+
+void CycleEstimator::reset() {
+    for (int g = 0; g < CYCLE_GROUPS; g++) {
+        factor[g] = 1.0f;
+    }
+    passesLearnt = 0;
+    beginPass();
+}
+
+float CycleEstimator::moveSeconds(float steps, float startSpeed, float maxSpeed, float acceleration) {
+    // The controller ramps up at the acceleration and stops at the target
+    // without a down ramp, so a move is a ramp and a cruise
+    if (steps <= 0) {
+        return 0;
+    }
+    if (maxSpeed < startSpeed) {
+        maxSpeed = startSpeed;
+    }
+    if (acceleration <= 0 || maxSpeed == startSpeed) {
+        return steps / maxSpeed;
+    }
+    float rampSteps = (maxSpeed * maxSpeed - startSpeed * startSpeed) / (2 * acceleration);
+    if (steps >= rampSteps) {
+        return (maxSpeed - startSpeed) / acceleration + (steps - rampSteps) / maxSpeed;
+    }
+    return (sqrtf(startSpeed * startSpeed + 2 * acceleration * steps) - startSpeed) / acceleration;
+}
+
+float CycleEstimator::phaseSeconds(const CyclePhase& phase, const int32_t from[2], const CycleMachine& machine) {
+    switch (phase.kind) {
+        case CYCLE_POSITION: {
+            // Both axes move at once, the longer one decides
+            float scale = phase.group == CYCLE_GROUP_CUT ? fminf(machine.feedScale, 1.0f) : machine.rapidScale;
+            float seconds = 0;
+            for (int axis = 0; axis < 2; axis++) {
+                if (!phase.moves[axis]) continue;
+                float steps = fabsf((float)(phase.target[axis] - from[axis]));
+                float t = moveSeconds(steps, machine.startSpeed[axis], machine.maxSpeed[axis] * scale,
+                                      machine.acceleration[axis]);
+                seconds = fmaxf(seconds, t);
+            }
+            return seconds;
+        }
+
+        case CYCLE_SPINDLE_WAIT:
+            return machine.rpm > 0 ? 30.0f / machine.rpm : CYCLE_UNKNOWN;
+
+        case CYCLE_GEARED: {
+            float seconds = 0;
+            for (int axis = 0; axis < 2; axis++) {
+                if (!phase.moves[axis]) continue;
+                float steps = fabsf((float)(phase.target[axis] - from[axis]));
+                if (steps == 0) continue;
+                float speed = labs(machine.dupr) * machine.rpm / 60.0f * machine.feedScale / machine.duPerStep[axis];
+                if (speed <= 0) {
+                    return CYCLE_UNKNOWN;
+                }
+                // Faster than the axis can go it lags behind at its limit
+                seconds = fmaxf(seconds, steps / fminf(speed, machine.maxSpeed[axis]));
+            }
+            return seconds;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+float CycleEstimator::remaining(const CyclePhase* phases, int first, int count, int32_t pos[2],
+                                const CycleMachine& machine) const {
+    float total = 0;
+    bool known = true;
+    for (int i = first; i < count; i++) {
+        const CyclePhase& phase = phases[i];
+        float seconds = phaseSeconds(phase, pos, machine);
+        if (seconds < 0) {
+            known = false;
+        } else {
+            total += seconds * factor[phase.group];
+        }
+        for (int axis = 0; axis < 2; axis++) {
+            if (phase.moves[axis]) pos[axis] = phase.target[axis];
+        }
+    }
+    return known ? total : CYCLE_UNKNOWN;
+}
+
+int32_t CycleEstimator::maxRpm(const CyclePhase& phase, const CycleMachine& machine) {
+    if (phase.kind != CYCLE_GEARED || machine.dupr == 0 || machine.feedScale <= 0) {
+        return 0;
+    }
+    float rpm = 0;
+    for (int axis = 0; axis < 2; axis++) {
+        if (!phase.moves[axis]) continue;
+        float axisRpm = machine.maxSpeed[axis] * machine.duPerStep[axis] * 60.0f / (labs(machine.dupr) * machine.feedScale);
+        rpm = rpm == 0 ? axisRpm : fminf(rpm, axisRpm);
+    }
+    return (int32_t)rpm;
+}
+
+void CycleEstimator::beginPass() {
+    for (int g = 0; g < CYCLE_GROUPS; g++) {
+        measured[g] = 0;
+        predicted[g] = 0;
+    }
+    phaseOpen = false;
+}
+
+void CycleEstimator::closePhase(uint32_t nowMs) {
+    if (!phaseOpen) {
+        return;
+    }
+    // Phases the model could not predict teach nothing
+    if (phasePredicted >= 0) {
+        measured[phaseGroup] += (nowMs - phaseStartMs) * 0.001f;
+        predicted[phaseGroup] += phasePredicted;
+    }
+    phaseOpen = false;
+}
+
+void CycleEstimator::beginPhase(CycleGroup group, float predictedSeconds, uint32_t nowMs) {
+    closePhase(nowMs);
+    phaseOpen = true;
+    phaseGroup = group;
+    phasePredicted = predictedSeconds;
+    phaseStartMs = nowMs;
+}
+
+void CycleEstimator::endPass(uint32_t nowMs) {
+    closePhase(nowMs);
+    bool learnt = false;
+    for (int g = 0; g < CYCLE_GROUPS; g++) {
+        if (predicted[g] < CYCLE_LEARN_MIN_S) continue;
+        float ratio = measured[g] / predicted[g];
+        float f = factor[g] + CYCLE_LEARN_WEIGHT * (ratio - factor[g]);
+        factor[g] = fminf(fmaxf(f, CYCLE_FACTOR_MIN), CYCLE_FACTOR_MAX);
+        learnt = true;
+    }
+    if (learnt && passesLearnt < UINT16_MAX) {
+        passesLearnt++;
+    }
+    beginPass();
+}
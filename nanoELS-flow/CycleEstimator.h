@@ -0,0 +1,121 @@
+#ifndef CYCLEESTIMATOR_H
+#define CYCLEESTIMATOR_H
+
+#include <stdint.h>
+
+/**
+ * CycleEstimator - Remaining time of multi-pass operations
+ *
+ * OperationManager describes every pass as five phases in PassSubState
+ * order (move to start, spindle sync, cut, retract, return), each with
+ * the axis positions it ends at. The estimator turns a phase into time:
+ * positioning moves ramp from the start speed at the axis acceleration
+ * up to the (rapid override scaled) speed limit, exactly like
+ * MinimalMotionControl, geared moves travel dupr per spindle turn at the
+ * current RPM and the spindle sync waits half a turn on average.
+ *
+ * Predictions are corrected by two factors, one for positioning and one
+ * for cutting, learnt from the measured phase durations of every finished
+ * pass. They absorb what the model leaves out: the loop rate dependent
+ * ramp, following error and spindle speed dips under load.
+ *
+ * The cut phase also gives the highest RPM the geared axis can follow at
+ * the current pitch; above it the axis falls behind the spindle.
+ *
+ * Features:
+ * - No heap, no Arduino dependencies
+ * - Unknown (negative) while a cut needs the spindle and it stands still
+ */
+
+#define CYCLE_PHASES 5                // Per pass, in PassSubState order
+#define CYCLE_UNKNOWN -1.0f           // Time that cannot be predicted
+#define CYCLE_LEARN_WEIGHT 0.3f       // Weight of the newest pass in a factor
+#define CYCLE_FACTOR_MIN 0.5f
+#define CYCLE_FACTOR_MAX 4.0f
+#define CYCLE_LEARN_MIN_S 0.2f        // Shorter predictions are too noisy to learn from
+#define CYCLE_UPDATE_MS 100           // Estimate refresh interval while running
+
+enum CyclePhaseKind : uint8_t {
+    CYCLE_NONE,            // Skipped in this mode
+    CYCLE_POSITION,        // Moves at the axis speed limit
+    CYCLE_SPINDLE_WAIT,    // Waits for the start angle
+    CYCLE_GEARED           // Follows the spindle, dupr per turn
+};
+
+enum CycleGroup : uint8_t {
+    CYCLE_GROUP_MOVE,      // Positioning and spindle sync
+    CYCLE_GROUP_CUT,       // Cutting phase
+    CYCLE_GROUPS
+};
+
+struct CyclePhase {
+    CyclePhaseKind kind;
+    CycleGroup group;
+    bool moves[2];         // Axes the phase drives, X then Z
+    int32_t target[2];     // Steps, where the moved axes end up
+};
+
+// Axis limits and the spindle and overrides right now
+struct CycleMachine {
+    float duPerStep[2];
+    float maxSpeed[2];     // Steps/s
+    float startSpeed[2];
+    float acceleration[2]; // Steps/s²
+    float rpm;             // Spindle speed, magnitude
+    int32_t dupr;          // Pitch of geared moves
+    float feedScale;       // Feed override on geared moves, 1 when locked
+    float rapidScale;      // Rapid override on positioning moves
+};
+
+// What the display and the web UI show
+struct CycleEstimate {
+    float passSeconds;       // Remaining in the current pass, CYCLE_UNKNOWN if not known
+    float totalSeconds;      // Remaining in the operation
+    int32_t maxRpm;          // Fastest spindle the geared axis can follow, 0 = no geared cut
+    float factor[CYCLE_GROUPS];
+    uint16_t passesLearnt;
+    bool valid;              // An operation is ready or running
+};
+
+class CycleEstimator {
+private:
+    float factor[CYCLE_GROUPS];
+    uint16_t passesLearnt;
+
+    // Current pass measurement
+    float measured[CYCLE_GROUPS];
+    float predicted[CYCLE_GROUPS];
+    bool phaseOpen;
+    CycleGroup phaseGroup;
+    float phasePredicted;
+    uint32_t phaseStartMs;
+
+    void closePhase(uint32_t nowMs);
+
+public:
+    CycleEstimator();
+
+    // Forget the learnt factors (other mode, other machine setup)
+    void reset();
+
+    // Raw model time of one phase starting from the given axis positions
+    static float phaseSeconds(const CyclePhase& phase, const int32_t from[2], const CycleMachine& machine);
+    static float moveSeconds(float steps, float startSpeed, float maxSpeed, float acceleration);
+
+    // Corrected time of the phases [first, count), following on from pos;
+    // pos is advanced to where they end. CYCLE_UNKNOWN if any is unknown.
+    float remaining(const CyclePhase* phases, int first, int count, int32_t pos[2], const CycleMachine& machine) const;
+
+    // Highest RPM the axis of a geared phase can follow, 0 for other phases
+    static int32_t maxRpm(const CyclePhase& phase, const CycleMachine& machine);
+
+    // Measurement: a phase starts (closing the previous one), a pass ends
+    void beginPass();
+    void beginPhase(CycleGroup group, float predictedSeconds, uint32_t nowMs);
+    void endPass(uint32_t nowMs);
+
+    float getFactor(CycleGroup group) const { return factor[group]; }
+    uint16_t getPassesLearnt() const { return passesLearnt; }
+};
+
+#endif // CYCLEESTIMATOR_H
@@ -0,0 +1,54 @@
+#include "FeedOverride.h"
+#include "MinimalMotionControl.h"
+
+// Global instance
+FeedOverride feedOverride;
+
+FeedOverride::FeedOverride()
+    : feedPercent(100), rapidPercent(100), feedScale(1.0f), rapidScale(1.0f), lastUs(0) {
+    mpgPulses[0] = mpgPulses[1] = 0;
+}
+
+void FeedOverride::setFeed(int percent) {
+    feedPercent = constrain(percent, OVERRIDE_MIN_PERCENT, OVERRIDE_FEED_MAX_PERCENT);
+}
+
+void FeedOverride::setRapid(int percent) {
+    rapidPercent = constrain(percent, OVERRIDE_MIN_PERCENT, OVERRIDE_RAPID_MAX_PERCENT);
+}
+
+void FeedOverride::addMPGPulses(int axis, int32_t pulses) {
+    if (axis < 0 || axis >= 2) return;
+    mpgPulses[axis] += pulses;
+    int32_t percent = mpgPulses[axis] / OVERRIDE_MPG_PULSES;
+    if (percent == 0) return;
+    mpgPulses[axis] -= percent * OVERRIDE_MPG_PULSES;
+    if (axis == AXIS_Z) {
+        adjustFeed(percent);
+    } else {
+        adjustRapid(percent);
+    }
+}
+
+void FeedOverride::reset() {
+    feedPercent = 100;
+    rapidPercent = 100;
+    mpgPulses[0] = mpgPulses[1] = 0;
+}
+
+float FeedOverride::ramp(float scale, int16_t percent, float step) {
+    float target = percent * 0.01f;
+    if (scale < target) {
+        return min(scale + step, target);
+    }
+    return max(scale - step, target);
+}
+
+void FeedOverride::update() {
+    uint32_t now = micros();
+    uint32_t elapsedUs = now - lastUs;
+    lastUs = now;
+    float step = min(elapsedUs, (uint32_t)OVERRIDE_MAX_TICK_US) * 1e-6f * OVERRIDE_RAMP_PER_S;
+    feedScale = ramp(feedScale, feedPercent, step);
+    rapidScale = ramp(rapidScale, rapidPercent, step);
+}
@@ -0,0 +1,71 @@
+#ifndef FEEDOVERRIDE_H
+#define FEEDOVERRIDE_H
+
+#include <Arduino.h>
+
+/**
+ * FeedOverride - Live feed and rapid override percentages
+ *
+ * The operator sets the requested percentages from the +/- keys (feed),
+ * the MPGs while an operation runs (Z = feed, X = rapid) or the web UI.
+ * Every controller tick the effective scales ramp towards the request, so
+ * a change reaches the motion within one tick and the speed never jumps:
+ * GCodePlanner re-plans its queued segments with the new scales, and
+ * OperationManager integrates the spindle travel it follows with the feed
+ * scale and limits axis speed on positioning moves with the rapid scale.
+ *
+ * Spindle-synchronised motion (threading mode, G33/G76 passes) ignores
+ * the feed override: the lead must match the spindle exactly. Rapids
+ * cannot go faster than the axis limits, so the rapid override stops at
+ * 100%.
+ *
+ * Features:
+ * - Controller task only; the web task goes through WebBridge commands
+ * - Request kept across operations and shown on the display and telemetry
+ * - MPG pulses short of a whole percent are kept, not lost
+ */
+
+#define OVERRIDE_MIN_PERCENT 10
+#define OVERRIDE_FEED_MAX_PERCENT 200
+#define OVERRIDE_RAPID_MAX_PERCENT 100     // Axis speed limits are the ceiling
+#define OVERRIDE_KEY_STEP_PERCENT 10       // One +/- key press
+#define OVERRIDE_MPG_PULSES 4              // MPG pulses (one detent) per percent
+#define OVERRIDE_RAMP_PER_S 1.0f           // Effective scale change per second (100%/s)
+#define OVERRIDE_MAX_TICK_US 100000        // Longer gaps ramp as this much
+
+class FeedOverride {
+private:
+    int16_t feedPercent;         // Requested
+    int16_t rapidPercent;
+    float feedScale;             // Effective, ramping towards the request
+    float rapidScale;
+    int32_t mpgPulses[2];        // Pulses short of a whole percent, X then Z
+    uint32_t lastUs;
+
+    static float ramp(float scale, int16_t percent, float step);
+
+public:
+    FeedOverride();
+
+    // Requests are clamped to the allowed range
+    void setFeed(int percent);
+    void setRapid(int percent);
+    void adjustFeed(int delta) { setFeed(feedPercent + delta); }
+    void adjustRapid(int delta) { setRapid(rapidPercent + delta); }
+    void addMPGPulses(int axis, int32_t pulses);  // AXIS_X = rapid, AXIS_Z = feed
+    void reset();                                 // Both back to 100%
+
+    // Ramp the effective scales, call every controller tick
+    void update();
+
+    int getFeedPercent() const { return feedPercent; }
+    int getRapidPercent() const { return rapidPercent; }
+    float getFeedScale() const { return feedScale; }
+    float getRapidScale() const { return rapidScale; }
+    bool isActive() const { return feedPercent != 100 || rapidPercent != 100; }
+};
+
+// Global instance
+extern FeedOverride feedOverride;
+
+#endif // FEEDOVERRIDE_H
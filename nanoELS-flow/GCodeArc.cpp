@@ -0,0 +1,116 @@
+#include "GCodeArc.h"
+#include <math.h>
+#include <stdlib.h>
+
+static const int FRACTION_BITS = 8;       // Q8 positions
+static const int ROTATION_BITS = 30;      // Q30 sine/cosine
+
+static int64_t roundShift(int64_t value, int bits) {
+    return value >= 0 ? (value + (1LL << (bits - 1))) >> bits
+                      : -((-value + (1LL << (bits - 1))) >> bits);
+}
+
+GCodeArc::GCodeArc()
+    : cosStep(1LL << ROTATION_BITS), sinStep(0), startRadius(0), endRadius(0),
+      chords(0), done(0) {
+    center[0] = center[1] = 0;
+    end[0] = end[1] = 0;
+    vector[0] = vector[1] = 0;
+}
+
+uint64_t GCodeArc::isqrt(uint64_t value) {
+    // Bit by bit, exact floor
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+bool GCodeArc::begin(const int32_t centerDu[2], const int32_t endDu[2], bool clockwise) {
+    chords = 0;
+    done = 0;
+
+    int64_t start[2] = {-(int64_t)centerDu[0], -(int64_t)centerDu[1]};
+    int64_t finish[2] = {(int64_t)endDu[0] - centerDu[0], (int64_t)endDu[1] - centerDu[1]};
+    for (int axis = 0; axis < 2; axis++) {
+        if (llabs(start[axis]) > GCODE_ARC_RADIUS_MAX_DU || llabs(finish[axis]) > GCODE_ARC_RADIUS_MAX_DU) {
+            return false;
+        }
+    }
+    uint64_t r0 = isqrt(start[0] * start[0] + start[1] * start[1]);
+    uint64_t r1 = isqrt(finish[0] * finish[0] + finish[1] * finish[1]);
+    if (r0 == 0 || r1 == 0 || r0 > GCODE_ARC_RADIUS_MAX_DU || r1 > GCODE_ARC_RADIUS_MAX_DU) {
+        return false;
+    }
+
+    // Swept angle in the ZX plane, Z first: positive from +Z towards +X
+    float cross = (float)start[1] * finish[0] - (float)start[0] * finish[1];
+    float dot = (float)start[1] * finish[1] + (float)start[0] * finish[0];
+    float angle = atan2f(cross, dot);
+    if (clockwise) {
+        if (angle >= 0) angle -= 2.0f * (float)M_PI;
+    } else {
+        if (angle <= 0) angle += 2.0f * (float)M_PI;
+    }
+
+    // Longest chord within tolerance: sagitta = r - sqrt(r^2 - (c/2)^2)
+    float radius = (float)(r0 > r1 ? r0 : r1);
+    float chordLength = 2.0f * sqrtf(2.0f * radius * GCODE_ARC_TOLERANCE_DU);
+    float count = ceilf(fabsf(angle) * radius / chordLength);
+    chords = count < 1 ? 1 : (uint32_t)count;
+
+    float step = angle / chords;
+    cosStep = (int64_t)lroundf(cosf(step) * (float)(1L << ROTATION_BITS));
+    sinStep = (int64_t)lroundf(sinf(step) * (float)(1L << ROTATION_BITS));
+
+    center[0] = centerDu[0];
+    center[1] = centerDu[1];
+    end[0] = endDu[0];
+    end[1] = endDu[1];
+    vector[0] = start[0] << FRACTION_BITS;
+    vector[1] = start[1] << FRACTION_BITS;
+    startRadius = (int64_t)r0 << FRACTION_BITS;
+    endRadius = (int64_t)r1 << FRACTION_BITS;
+    return true;
+}
+
+bool GCodeArc::next(int32_t pointDu[2]) {
+    if (done >= chords) {
+        return false;
+    }
+    done++;
+    if (done == chords) {
+        pointDu[0] = end[0];
+        pointDu[1] = end[1];
+        return true;
+    }
+
+    // Rotate in the (Z, X) plane
+    int64_t z = vector[1];
+    int64_t x = vector[0];
+    vector[1] = roundShift(z * cosStep - x * sinStep, ROTATION_BITS);
+    vector[0] = roundShift(z * sinStep + x * cosStep, ROTATION_BITS);
+
+    // Hold the radius: quantised sine/cosine would otherwise let it drift
+    int64_t target = startRadius + (endRadius - startRadius) * done / chords;
+    int64_t length = (int64_t)isqrt((uint64_t)(vector[0] * vector[0] + vector[1] * vector[1]));
+    if (length > 0) {
+        vector[0] = vector[0] * target / length;
+        vector[1] = vector[1] * target / length;
+    }
+
+    pointDu[0] = center[0] + (int32_t)roundShift(vector[0], FRACTION_BITS);
+    pointDu[1] = center[1] + (int32_t)roundShift(vector[1], FRACTION_BITS);
+    return true;
+}
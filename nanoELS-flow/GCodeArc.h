@@ -0,0 +1,62 @@
+#ifndef GCODEARC_H
+#define GCODEARC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * GCodeArc - Chord generator for G2/G3 arcs
+ *
+ * An arc is cut as a series of chords short enough that none strays more
+ * than GCODE_ARC_TOLERANCE_DU from the true circle; GCodePlanner then
+ * blends the chords, which meet at almost straight angles, at the
+ * programmed feed. Chords are produced one at a time as the planner has
+ * room, so an arc costs two records in the program whatever its length.
+ *
+ * The chord end points come from rotating the radius vector by a fixed
+ * angle in integer fixed point (Q30 rotation, Q8 deci-microns). Sine and
+ * cosine are evaluated once per arc; per chord there is only integer
+ * multiply, an integer square root to hold the radius, and no trig.
+ *
+ * Features:
+ * - Positions relative to the arc start, axes 0 = X and 1 = Z
+ * - ZX plane (G18): counter-clockwise turns from +Z towards +X
+ * - Start and end radius may differ slightly (rounded end points); the
+ *   radius is blended linearly along the arc
+ * - Last point is exactly the programmed end
+ * - No Arduino dependencies (also built on the host by tools/gcode_arc_test.cpp)
+ */
+
+#define GCODE_ARC_TOLERANCE_DU 1          // Max chord deviation from the circle
+#define GCODE_ARC_RADIUS_MAX_DU 4000000   // 400mm, keeps fixed point within int64
+
+class GCodeArc {
+private:
+    int32_t center[2];       // du from the arc start
+    int32_t end[2];          // du from the arc start
+    int64_t vector[2];       // Current point from the centre, Q8 du
+    int64_t cosStep;         // Q30 rotation per chord
+    int64_t sinStep;
+    int64_t startRadius;     // Q8 du
+    int64_t endRadius;
+    uint32_t chords;
+    uint32_t done;
+
+public:
+    GCodeArc();
+
+    // Plan an arc from the origin to endDu around centerDu. False when the
+    // radius is zero or above GCODE_ARC_RADIUS_MAX_DU. Equal start and end
+    // make a full circle.
+    bool begin(const int32_t centerDu[2], const int32_t endDu[2], bool clockwise);
+
+    // Next chord end point (du from the arc start). False when finished.
+    bool next(int32_t pointDu[2]);
+
+    bool isDone() const { return done >= chords; }
+    uint32_t getChords() const { return chords; }
+
+    static uint64_t isqrt(uint64_t value);
+};
+
+#endif // GCODEARC_H
@@ -0,0 +1,287 @@
+#include "GCodeBinary.h"
+#include "MinimalMotionControl.h"
+
+// Compiler output, buffered and written GCODE_BINARY_RECORDS at a time
+class BinaryWriter : public GCodeRecordSink {
+public:
+    fs::File file;
+    GCodeRecord buffer[GCODE_BINARY_RECORDS];
+    uint8_t count;
+    uint32_t written;
+    GCodeFileStats payload;   // CRC over the records
+    bool writeFailed;
+
+    void begin() {
+        count = 0;
+        written = 0;
+        writeFailed = false;
+        GCodeIndex::begin(payload);
+    }
+
+    bool flush() {
+        if (count == 0) {
+            return !writeFailed;
+        }
+        size_t bytes = count * sizeof(GCodeRecord);
+        if (file.write((const uint8_t*)buffer, bytes) != bytes) {
+            writeFailed = true;
+        }
+        GCodeIndex::update(payload, (const uint8_t*)buffer, bytes);
+        written += count;
+        count = 0;
+        return !writeFailed;
+    }
+
+    bool put(const GCodeRecord& record) override {
+        if (count == GCODE_BINARY_RECORDS && !flush()) {
+            return false;
+        }
+        buffer[count++] = record;
+        return true;
+    }
+};
+
+// Only the web task compiles, so the working state can live here instead
+// of on its stack
+static GCodeCompiler compiler;
+static BinaryWriter writer;
+static char readBuffer[GCODE_READ_BUFFER];
+static GCodeRecord playBuffer[GCODE_BINARY_RECORDS];
+static char line[GCODE_LINE_MAX + 1];
+
+static bool compileLine(uint32_t lineNumber, size_t lineLen, bool& lineTooLong,
+                        char* error, size_t errorLen) {
+    if (lineTooLong) {
+        lineTooLong = false;
+        snprintf(error, errorLen, "L%lu: longer than %d chars", (unsigned long)lineNumber, GCODE_LINE_MAX);
+        return false;
+    }
+    bool ok = compiler.compileLine(line, lineLen, lineNumber, writer);
+    while (ok && compiler.isExpanding()) {
+        ok = compiler.expand(writer);
+    }
+    if (!ok) {
+        snprintf(error, errorLen, "%s", writer.writeFailed ? "write failed (filesystem full?)" : compiler.getError());
+    }
+    return ok;
+}
+
+GCodeAxisScale GCodeBinary::machineScale() {
+    GCodeAxisScale scale;
+    for (int axis = 0; axis < 2; axis++) {
+        scale.motorSteps[axis] = motionControl.getMotorSteps(axis);
+        scale.screwPitch[axis] = motionControl.getScrewPitch(axis);
+    }
+    return scale;
+}
+
+void GCodeBinary::pathFor(const char* name, char* path, size_t len) {
+    snprintf(path, len, "/%s.bin", name);
+}
+
+bool GCodeBinary::headerValid(const GCodeBinaryHeader& header) {
+    GCodeAxisScale scale = machineScale();
+    return header.magic == GCODE_BINARY_MAGIC &&
+           header.version == GCODE_BINARY_VERSION &&
+           header.recordSize == sizeof(GCodeRecord) &&
+           memcmp(&header.scale, &scale, sizeof(scale)) == 0;
+}
+
+bool GCodeBinary::compile(fs::FS& fs, const char* sourcePath, char* error, size_t errorLen) {
+    fs::File source = fs.open(sourcePath, "r");
+    if (!source) {
+        snprintf(error, errorLen, "cannot open source");
+        return false;
+    }
+    writer.file = fs.open(GCODE_BINARY_TEMP, "w");
+    if (!writer.file) {
+        source.close();
+        snprintf(error, errorLen, "cannot create binary");
+        return false;
+    }
+
+    // Header is rewritten once the counts and CRCs are known
+    GCodeBinaryHeader header = {};
+    header.magic = GCODE_BINARY_MAGIC;
+    header.version = GCODE_BINARY_VERSION;
+    header.recordSize = sizeof(GCodeRecord);
+    header.scale = machineScale();
+    writer.file.write((const uint8_t*)&header, sizeof(header));
+    writer.begin();
+    compiler.reset(header.scale);
+
+    GCodeFileStats sourceStats;
+    GCodeIndex::begin(sourceStats);
+    uint32_t lineNumber = 0;
+    size_t lineLen = 0;
+    bool lineTooLong = false;
+    bool ok = true;
+    int n;
+    while (ok && (n = source.read((uint8_t*)readBuffer, sizeof(readBuffer))) > 0) {
+        GCodeIndex::update(sourceStats, (const uint8_t*)readBuffer, n);
+        size_t pos = 0;
+        while (ok && pos < (size_t)n) {
+            const char* start = readBuffer + pos;
+            const char* newline = (const char*)memchr(start, '\n', n - pos);
+            size_t take = newline ? newline - start : n - pos;
+            size_t room = GCODE_LINE_MAX - lineLen;
+            if (take > room) {
+                lineTooLong = true;
+            }
+            size_t copy = take < room ? take : room;
+            memcpy(line + lineLen, start, copy);
+            lineLen += copy;
+            pos += take;
+            if (!newline) {
+                break;  // Line continues in the next read
+            }
+            pos++;
+
+            ok = compileLine(++lineNumber, lineLen, lineTooLong, error, errorLen);
+            lineLen = 0;
+        }
+    }
+
+    // Last line without a newline
+    if (ok && (lineLen > 0 || lineTooLong)) {
+        ok = compileLine(++lineNumber, lineLen, lineTooLong, error, errorLen);
+    }
+
+    if (ok && !compiler.finishProgram(lineNumber)) {
+        snprintf(error, errorLen, "%s", compiler.getError());
+        ok = false;
+    }
+
+    // Running off the end stops like M2, so the executor always sees an end
+    if (ok && !compiler.isEnded()) {
+        GCodeRecord end = {GCODE_REC_END, 0, 0, lineNumber, 0, 0};
+        writer.put(end);  // A failed write shows in the flush below
+    }
+    if (ok && !writer.flush()) {
+        snprintf(error, errorLen, "write failed (filesystem full?)");
+        ok = false;
+    }
+    source.close();
+
+    if (ok) {
+        GCodeIndex::finish(sourceStats);
+        GCodeIndex::finish(writer.payload);
+        header.sourceCrc = sourceStats.crc;
+        header.sourceSize = sourceStats.size;
+        header.recordCount = writer.written;
+        header.payloadCrc = writer.payload.crc;
+        ok = writer.file.seek(0) &&
+             writer.file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+        if (!ok) {
+            snprintf(error, errorLen, "write failed (filesystem full?)");
+        }
+    }
+    writer.file.close();
+    if (!ok) {
+        fs.remove(GCODE_BINARY_TEMP);
+        return false;
+    }
+    Serial.printf("GCode compiled %s: %lu lines, %lu records\n", sourcePath,
+                  (unsigned long)lineNumber, (unsigned long)header.recordCount);
+    return true;
+}
+
+bool GCodeBinary::commit(fs::FS& fs, const char* name) {
+    char path[GCODE_INDEX_NAME_LEN + 8];
+    pathFor(name, path, sizeof(path));
+    if (fs.rename(GCODE_BINARY_TEMP, path)) {
+        return true;
+    }
+
+    // Some VFS layers refuse to rename over an existing file
+    fs.remove(path);
+    return fs.rename(GCODE_BINARY_TEMP, path);
+}
+
+void GCodeBinary::remove(fs::FS& fs, const char* name) {
+    char path[GCODE_INDEX_NAME_LEN + 8];
+    pathFor(name, path, sizeof(path));
+    fs.remove(path);
+}
+
+bool GCodeBinary::isCurrent(fs::FS& fs, const char* name, uint32_t sourceCrc, bool verifyRecords) {
+    char path[GCODE_INDEX_NAME_LEN + 8];
+    pathFor(name, path, sizeof(path));
+    fs::File file = fs.open(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    GCodeBinaryHeader header;
+    bool ok = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+              headerValid(header) && header.sourceCrc == sourceCrc &&
+              file.size() == sizeof(header) + header.recordCount * sizeof(GCodeRecord);
+    if (ok && verifyRecords) {
+        GCodeFileStats payload;
+        GCodeIndex::begin(payload);
+        int n;
+        while ((n = file.read((uint8_t*)readBuffer, sizeof(readBuffer))) > 0) {
+            GCodeIndex::update(payload, (const uint8_t*)readBuffer, n);
+        }
+        GCodeIndex::finish(payload);
+        ok = payload.crc == header.payloadCrc;
+    }
+    file.close();
+    return ok;
+}
+
+bool GCodeBinary::ensure(fs::FS& fs, const GCodeIndexEntry& entry, bool verifyRecords,
+                         char* error, size_t errorLen) {
+    if (isCurrent(fs, entry.name, entry.stats.crc, verifyRecords)) {
+        return true;
+    }
+
+    char sourcePath[GCODE_INDEX_NAME_LEN + 8];
+    snprintf(sourcePath, sizeof(sourcePath), "/%s.gcode", entry.name);
+    if (!compile(fs, sourcePath, error, errorLen)) {
+        remove(fs, entry.name);  // A stale binary must not run instead
+        return false;
+    }
+    if (!commit(fs, entry.name)) {
+        snprintf(error, errorLen, "cannot store binary");
+        return false;
+    }
+    return true;
+}
+
+bool GCodeBinary::play(fs::FS& fs, const char* name, GCodeRecordSink& sink, char* error, size_t errorLen) {
+    char path[GCODE_INDEX_NAME_LEN + 8];
+    pathFor(name, path, sizeof(path));
+    fs::File file = fs.open(path, "r");
+    if (!file) {
+        snprintf(error, errorLen, "not compiled");
+        return false;
+    }
+    GCodeBinaryHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) || !headerValid(header)) {
+        file.close();
+        snprintf(error, errorLen, "bad binary");
+        return false;
+    }
+
+    uint32_t left = header.recordCount;
+    bool ok = true;
+    while (ok && left > 0) {
+        size_t count = left < GCODE_BINARY_RECORDS ? left : GCODE_BINARY_RECORDS;
+        size_t bytes = count * sizeof(GCodeRecord);
+        if (file.read((uint8_t*)playBuffer, bytes) != bytes) {
+            snprintf(error, errorLen, "binary truncated");
+            ok = false;
+            break;
+        }
+        for (size_t i = 0; ok && i < count; i++) {
+            if (!sink.put(playBuffer[i])) {
+                snprintf(error, errorLen, "L%lu: bad record %u", (unsigned long)playBuffer[i].line, playBuffer[i].type);
+                ok = false;
+            }
+        }
+        left -= count;
+    }
+    file.close();
+    return ok;
+}
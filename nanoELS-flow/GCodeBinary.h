@@ -0,0 +1,78 @@
+#ifndef GCODEBINARY_H
+#define GCODEBINARY_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "GCodeCompiler.h"
+#include "GCodeIndex.h"
+
+/**
+ * GCodeBinary - Compiled form of stored G-code programs
+ *
+ * Every "/name.gcode" has a "/name.bin" beside it: a header followed by
+ * GCodeRecords with targets already in motor steps. Programs are compiled
+ * when they are saved, so syntax and range errors are reported to the
+ * uploader instead of stopping a cut halfway, and MODE_GCODE executes the
+ * records without parsing anything.
+ *
+ * The header carries the CRC-32 and size of the source it was built from
+ * and the axis scale it was built for; a binary whose source or machine
+ * changed is stale and gets rebuilt (at startup and when selected).
+ *
+ * Features:
+ * - Built into a temp file and renamed, like uploads
+ * - CRC-32 over the records, checked before a program is selected
+ * - Fixed buffers only, no heap
+ * - Web task only; running programs get their records through GCodeFeed
+ */
+
+#define GCODE_BINARY_MAGIC 0x42434E47         // "GNCB"
+#define GCODE_BINARY_VERSION 1
+#define GCODE_BINARY_TEMP "/gcode-compile.tmp"
+#define GCODE_BINARY_RECORDS 16               // Records per file read/write
+#define GCODE_READ_BUFFER 256                 // Source bytes read at a time
+#define GCODE_LINE_MAX 96                     // Longest program line
+
+struct GCodeBinaryHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t sourceCrc;
+    uint32_t sourceSize;
+    GCodeAxisScale scale;
+    uint32_t recordCount;
+    uint32_t payloadCrc;
+};
+
+class GCodeBinary {
+public:
+    // Axis scale of this machine, which binaries are compiled for
+    static GCodeAxisScale machineScale();
+
+    // "/name.bin"
+    static void pathFor(const char* name, char* path, size_t len);
+
+    // Compile sourcePath into GCODE_BINARY_TEMP. On failure error holds
+    // "L<line>: reason" and the temp file is gone.
+    static bool compile(fs::FS& fs, const char* sourcePath, char* error, size_t errorLen);
+
+    // Move GCODE_BINARY_TEMP into place for name
+    static bool commit(fs::FS& fs, const char* name);
+    static void remove(fs::FS& fs, const char* name);
+
+    // Header matches this machine and version
+    static bool headerValid(const GCodeBinaryHeader& header);
+
+    // Binary exists, matches source and machine; optionally re-check the records
+    static bool isCurrent(fs::FS& fs, const char* name, uint32_t sourceCrc, bool verifyRecords);
+
+    // Rebuild name's binary unless it is current
+    static bool ensure(fs::FS& fs, const GCodeIndexEntry& entry, bool verifyRecords,
+                       char* error, size_t errorLen);
+
+    // Feed every record of a current binary to sink (dry runs). False with
+    // error on a bad file or a record the sink refuses.
+    static bool play(fs::FS& fs, const char* name, GCodeRecordSink& sink, char* error, size_t errorLen);
+};
+
+#endif // GCODEBINARY_H
@@ -0,0 +1,671 @@
+#include "GCodeCompiler.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// Words the compiler understands; anything else is an error rather
+// than silently ignored
+static const uint32_t SUPPORTED_WORDS =
+    GCODE_WORD('D') | GCODE_WORD('F') | GCODE_WORD('H') | GCODE_WORD('I') |
+    GCODE_WORD('J') | GCODE_WORD('K') | GCODE_WORD('L') | GCODE_WORD('M') |
+    GCODE_WORD('N') | GCODE_WORD('P') | GCODE_WORD('Q') | GCODE_WORD('R') |
+    GCODE_WORD('T') | GCODE_WORD('U') | GCODE_WORD('W') | GCODE_WORD('X') |
+    GCODE_WORD('Z');
+
+// Parameter words and the motion or cycle that takes them
+static const uint32_t PARAMETER_WORDS =
+    GCODE_WORD('D') | GCODE_WORD('H') | GCODE_WORD('I') | GCODE_WORD('J') |
+    GCODE_WORD('K') | GCODE_WORD('L') | GCODE_WORD('P') | GCODE_WORD('Q') |
+    GCODE_WORD('R') | GCODE_WORD('U') | GCODE_WORD('W');
+static const uint32_t ARC_WORDS = GCODE_WORD('I') | GCODE_WORD('K') | GCODE_WORD('R');
+static const uint32_t SYNC_WORDS = GCODE_WORD('K') | GCODE_WORD('Q');
+static const uint32_t THREAD_WORDS =
+    GCODE_WORD('H') | GCODE_WORD('I') | GCODE_WORD('J') | GCODE_WORD('K') |
+    GCODE_WORD('L') | GCODE_WORD('P') | GCODE_WORD('Q') | GCODE_WORD('R');
+static const uint32_t ROUGH_WORDS =
+    GCODE_WORD('D') | GCODE_WORD('P') | GCODE_WORD('Q') | GCODE_WORD('R') |
+    GCODE_WORD('U') | GCODE_WORD('W');
+static const uint32_t FINISH_WORDS = GCODE_WORD('P') | GCODE_WORD('Q');
+static const uint32_t PROFILE_WORDS =
+    GCODE_WORD('I') | GCODE_WORD('K') | GCODE_WORD('N') | GCODE_WORD('R') |
+    GCODE_WORD('X') | GCODE_WORD('Z');
+
+GCodeCompiler::GCodeCompiler() {
+    GCodeAxisScale unit = {{1, 1}, {1, 1}};
+    reset(unit);
+}
+
+void GCodeCompiler::reset(const GCodeAxisScale& axisScale) {
+    scale = axisScale;
+    absolute = true;
+    inch = false;
+    motionMode = 0;
+    feedDuPerSec = GCODE_FEED_DEFAULT_DU_SEC;
+    positionDu[0] = positionDu[1] = 0;
+    known[0] = known[1] = false;
+    ended = false;
+    expanding = GCODE_CYCLE_NONE;
+    capturing = false;
+    profile.count = 0;
+    profile.complete = false;
+    errorText[0] = '\0';
+}
+
+bool GCodeCompiler::fail(uint32_t line, const char* format, ...) {
+    int n = snprintf(errorText, sizeof(errorText), "L%lu", (unsigned long)line);
+    if (n < 0 || n >= (int)sizeof(errorText)) {
+        return false;
+    }
+    va_list args;
+    va_start(args, format);
+    vsnprintf(errorText + n, sizeof(errorText) - n, format, args);
+    va_end(args);
+    return false;
+}
+
+int32_t GCodeCompiler::toDu(int32_t fixed) const {
+    // Fixed point is 1/10000 of a unit: mm -> du as is, inch -> x25.4
+    return inch ? (int32_t)((int64_t)fixed * 254 / 10) : fixed;
+}
+
+// Rounded to nearest, symmetric around zero so mirrored paths stay mirrored
+static int32_t divideRounded(int64_t num, int64_t den) {
+    return (int32_t)(num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den));
+}
+
+int32_t GCodeCompiler::duToSteps(const GCodeAxisScale& scale, int axis, int32_t du) {
+    return divideRounded((int64_t)du * scale.motorSteps[axis], scale.screwPitch[axis]);
+}
+
+int32_t GCodeCompiler::stepsToDu(const GCodeAxisScale& scale, int axis, int32_t steps) {
+    return divideRounded((int64_t)steps * scale.screwPitch[axis], scale.motorSteps[axis]);
+}
+
+bool GCodeCompiler::arcCenter(uint32_t line, const int32_t startDu[2], const int32_t endDu[2],
+                              bool clockwise, int32_t centerDu[2]) {
+    // Arc geometry relative to the start
+    double dx = (double)endDu[0] - startDu[0];
+    double dz = (double)endDu[1] - startDu[1];
+    if (fabs(dx) > 2.0 * GCODE_ARC_RADIUS_MAX_DU || fabs(dz) > 2.0 * GCODE_ARC_RADIUS_MAX_DU) {
+        return fail(line, ": bad arc radius");
+    }
+
+    if (block.has('R')) {
+        if (block.has('I') || block.has('K')) {
+            return fail(line, ": R with I/K");
+        }
+        // Centre on the perpendicular bisector; negative R takes the long way
+        double r = toDu(block.get('R'));
+        double d2 = dx * dx + dz * dz;
+        if (d2 == 0) {
+            return fail(line, ": R full circle");
+        }
+        double h2 = 4.0 * r * r - d2;
+        if (h2 < -4.0 * GCODE_ARC_RADIUS_ERROR_DU * GCODE_ARC_RADIUS_ERROR_DU) {
+            return fail(line, ": R too small");
+        }
+        double h = -sqrt(h2 > 0 ? h2 : 0) / sqrt(d2);
+        if (!clockwise) h = -h;
+        if (r < 0) h = -h;
+        // Z first: the ZX plane is (Z, X) like XY is (X, Y)
+        centerDu[1] = (int32_t)lround(0.5 * (dz - dx * h));
+        centerDu[0] = (int32_t)lround(0.5 * (dx + dz * h));
+    } else if (block.has('I') || block.has('K')) {
+        centerDu[0] = block.has('I') ? toDu(block.get('I')) : 0;
+        centerDu[1] = block.has('K') ? toDu(block.get('K')) : 0;
+        double r0 = sqrt((double)centerDu[0] * centerDu[0] + (double)centerDu[1] * centerDu[1]);
+        double r1 = sqrt((dx - centerDu[0]) * (dx - centerDu[0]) + (dz - centerDu[1]) * (dz - centerDu[1]));
+        if (fabs(r0 - r1) > GCODE_ARC_RADIUS_ERROR_DU && fabs(r0 - r1) > 0.001 * r0) {
+            return fail(line, ": arc end off radius");
+        }
+    } else {
+        return fail(line, ": arc needs I/K or R");
+    }
+
+    int32_t end[2] = {(int32_t)dx, (int32_t)dz};
+    GCodeArc arc;
+    if (!arc.begin(centerDu, end, clockwise)) {
+        return fail(line, ": bad arc radius");
+    }
+    return true;
+}
+
+bool GCodeCompiler::putMove(GCodeRecordType type, uint32_t line, int32_t xDu, int32_t zDu,
+                            GCodeRecordSink& sink) {
+    positionDu[0] = xDu;
+    positionDu[1] = zDu;
+    GCodeRecord record = {type, 0, 0, line, duToSteps(scale, 0, xDu), duToSteps(scale, 1, zDu)};
+    record.flags = (known[0] ? 0 : GCODE_REC_X_FROM_START) | (known[1] ? 0 : GCODE_REC_Z_FROM_START);
+    if (!sink.put(record)) {
+        return fail(line, ": no room");
+    }
+    return true;
+}
+
+bool GCodeCompiler::putThread(uint32_t line, int32_t leadDu, int32_t startMillideg, GCodeRecordSink& sink) {
+    GCodeRecord record = {GCODE_REC_THREAD, 0, 0, line, leadDu, startMillideg};
+    if (!sink.put(record)) {
+        return fail(line, ": no room");
+    }
+    return true;
+}
+
+bool GCodeCompiler::beginThreadCycle(uint32_t line) {
+    // Drive line and start Z are where the tool is now
+    const char required[] = "PZIJK";
+    for (const char* word = required; *word; word++) {
+        if (!block.has(*word)) {
+            return fail(line, ": G76 needs %c", *word);
+        }
+    }
+    if (block.has('X')) {
+        return fail(line, ": G76 X is the drive line");
+    }
+    if (absolute && !known[1]) {
+        return fail(line, ": cycle from unknown start");
+    }
+
+    GCodeThreadCycle& c = thread;
+    c.line = line;
+    c.driveX = positionDu[0];
+    c.startZ = positionDu[1];
+    c.endZ = absolute ? toDu(block.get('Z')) : positionDu[1] + toDu(block.get('Z'));
+    int32_t pitch = toDu(block.get('P'));
+    int32_t crest = toDu(block.get('I'));
+    c.firstDepth = toDu(block.get('J'));
+    c.fullDepth = toDu(block.get('K'));
+    int32_t spring = block.has('H') ? block.getInt('H') : 0;
+    int32_t starts = block.has('L') ? block.getInt('L') : 1;
+    float degression = block.has('R') ? (float)block.get('R') / GCODE_FIXED_ONE : 1.0f;
+    float angle = block.has('Q') ? (float)block.get('Q') / GCODE_FIXED_ONE : 0.0f;
+    if (c.endZ == c.startZ) {
+        return fail(line, ": G76 without length");
+    }
+    if (pitch <= 0 || crest == 0 || c.firstDepth <= 0 || c.fullDepth <= 0) {
+        return fail(line, ": bad G76 P/I/J/K");
+    }
+    if (degression < 1.0f || angle < 0 || angle > 60.0f || spring < 0 || starts < 1) {
+        return fail(line, ": bad G76 R/Q/H/L");
+    }
+
+    // Pass n cuts J * n^(1/R) deep, so K is reached at n = (K/J)^R
+    float depthPasses = ceilf(powf((float)c.fullDepth / c.firstDepth, degression));
+    if (depthPasses < 1) depthPasses = 1;
+    if ((depthPasses + spring) * starts > GCODE_CYCLE_PASSES_MAX) {
+        return fail(line, ": G76 over %d passes", GCODE_CYCLE_PASSES_MAX);
+    }
+    c.depthPasses = (uint16_t)depthPasses;
+    c.totalPasses = c.depthPasses + spring;
+    c.starts = (uint8_t)starts;
+    c.lead = pitch * starts;
+    c.crestX = c.driveX + crest;
+    c.depthSign = crest < 0 ? -1 : 1;
+    c.degression = degression;
+    c.compoundTan = tanf(angle * (float)M_PI / 180.0f);
+    c.pass = 0;
+    expanding = GCODE_CYCLE_THREAD;
+    return true;
+}
+
+bool GCodeCompiler::expand(GCodeRecordSink& sink) {
+    bool ok = true;
+    switch (expanding) {
+        case GCODE_CYCLE_NONE:   break;
+        case GCODE_CYCLE_THREAD: ok = expandThread(sink); break;
+        default:                 ok = expandProfile(sink); break;
+    }
+    if (!ok) {
+        expanding = GCODE_CYCLE_NONE;
+    }
+    return ok;
+}
+
+bool GCodeCompiler::finishProgram(uint32_t line) {
+    if (capturing) {
+        capturing = false;
+        return fail(line, ": no profile end N%lu", (unsigned long)profile.last);
+    }
+    return true;
+}
+
+bool GCodeCompiler::expandThread(GCodeRecordSink& sink) {
+    // Every start at one depth before going deeper, spring passes at K
+    GCodeThreadCycle& c = thread;
+    uint16_t depthIndex = c.pass / c.starts;
+    uint8_t start = c.pass % c.starts;
+    int32_t depth = c.fullDepth;
+    if (depthIndex < c.depthPasses) {
+        float d = c.firstDepth * powf((float)(depthIndex + 1), 1.0f / c.degression);
+        if (d < depth) depth = (int32_t)lroundf(d);
+    }
+
+    // Compound infeed: the pass moves back along Z so only the leading
+    // flank cuts
+    int32_t shift = (int32_t)lroundf(depth * c.compoundTan);
+    if (c.endZ > c.startZ) shift = -shift;
+    int32_t startZ = c.startZ + shift;
+    int32_t endZ = c.endZ + shift;
+    int32_t cutX = c.crestX + c.depthSign * depth;
+    int32_t angle = (int32_t)((int64_t)GCODE_TURN_MILLIDEG * start / c.starts);
+
+    if (!putMove(GCODE_REC_RAPID, c.line, c.driveX, startZ, sink) ||
+        !putMove(GCODE_REC_RAPID, c.line, cutX, startZ, sink) ||
+        !putThread(c.line, c.lead, angle, sink) ||
+        !putMove(GCODE_REC_SYNC, c.line, cutX, endZ, sink) ||
+        !putMove(GCODE_REC_RAPID, c.line, c.driveX, endZ, sink)) {
+        return false;
+    }
+
+    if (++c.pass == c.totalPasses * c.starts) {
+        expanding = GCODE_CYCLE_NONE;
+        return putMove(GCODE_REC_RAPID, c.line, c.driveX, c.startZ, sink);
+    }
+    return true;
+}
+
+bool GCodeCompiler::beginProfileCycle(uint32_t line, bool roughing) {
+    int code = roughing ? 71 : 70;
+    if (!block.has('P') || !block.has('Q') || block.get('P') <= 0 || block.get('Q') <= 0) {
+        return fail(line, ": G%d needs P and Q", code);
+    }
+    if (block.has('X') || block.has('Z')) {
+        return fail(line, ": G%d starts where the tool is", code);
+    }
+    if (!known[0] || !known[1]) {
+        return fail(line, ": cycle from unknown start");
+    }
+    uint32_t first = block.getInt('P');
+    uint32_t last = block.getInt('Q');
+
+    GCodeProfileCycle& c = profileCycle;
+    c.line = line;
+    c.start[0] = positionDu[0];
+    c.start[1] = positionDu[1];
+    c.offset[0] = c.offset[1] = 0;
+    c.contour = !roughing;
+    c.segment = 0;
+    if (!roughing) {
+        if (!profile.complete || profile.first != first || profile.last != last) {
+            return fail(line, ": no G71 profile N%lu-N%lu", (unsigned long)first, (unsigned long)last);
+        }
+        expanding = GCODE_CYCLE_FINISH;
+        return true;
+    }
+
+    c.depth = block.has('D') ? toDu(block.get('D')) : 0;
+    c.retract = block.has('R') ? toDu(block.get('R')) : GCODE_ROUGH_RETRACT_DU;
+    // U/W are sizes here, the side comes from the profile
+    c.offset[0] = block.has('U') ? toDu(block.get('U')) : 0;
+    c.offset[1] = block.has('W') ? toDu(block.get('W')) : 0;
+    if (c.depth <= 0 || c.retract < 0 || c.offset[0] < 0 || c.offset[1] < 0) {
+        return fail(line, ": bad G71 D/R/U/W");
+    }
+
+    // The profile blocks follow and are only stored
+    profile.first = first;
+    profile.last = last;
+    profile.count = 0;
+    profile.complete = false;
+    capturing = true;
+    return true;
+}
+
+bool GCodeCompiler::captureProfile(uint32_t line) {
+    uint32_t number = block.has('N') ? block.getInt('N') : 0;
+    if (profile.count == 0 && number != profile.first) {
+        return fail(line, ": profile must start at N%lu", (unsigned long)profile.first);
+    }
+    uint32_t unsupported = block.words & ~PROFILE_WORDS;
+    if (unsupported) {
+        return fail(line, ": %c in profile", 'A' + __builtin_ctz(unsupported));
+    }
+
+    int motion = profile.count > 0 ? profile.segments[profile.count - 1].motion : -1;
+    for (int i = 0; i < block.gCount; i++) {
+        if (block.g[i] < 0 || block.g[i] > 3) {
+            return fail(line, ": G%d in profile", block.g[i]);
+        }
+        motion = block.g[i];
+    }
+    if (motion < 0 || (profile.count == 0 && motion > 1)) {
+        return fail(line, ": profile starts without G0/G1");
+    }
+    if (motion < 2 && (block.words & ARC_WORDS)) {
+        return fail(line, ": %c not valid in G%d", 'A' + __builtin_ctz(block.words & ARC_WORDS), motion);
+    }
+
+    if (block.has('X') || block.has('Z')) {
+        if (profile.count == GCODE_PROFILE_SEGMENTS) {
+            return fail(line, ": profile over %d blocks", GCODE_PROFILE_SEGMENTS);
+        }
+        const int32_t* from = profile.count > 0 ? profile.segments[profile.count - 1].end : profileCycle.start;
+        GCodeProfileSegment& segment = profile.segments[profile.count];
+        const char letters[2] = {'X', 'Z'};
+        for (int axis = 0; axis < 2; axis++) {
+            segment.end[axis] = from[axis];
+            if (block.has(letters[axis])) {
+                int32_t du = toDu(block.get(letters[axis]));
+                segment.end[axis] = absolute ? du : from[axis] + du;
+            }
+        }
+        segment.motion = motion;
+        if (motion >= 2) {
+            int32_t centerDu[2];
+            if (!arcCenter(line, from, segment.end, motion == 2, centerDu)) {
+                return false;
+            }
+            segment.center[0] = from[0] + centerDu[0];
+            segment.center[1] = from[1] + centerDu[1];
+        }
+        profile.count++;
+    }
+
+    if (number == profile.last) {
+        capturing = false;
+        profile.complete = true;
+        if (!checkProfile(line)) {
+            profile.complete = false;
+            return false;
+        }
+        return startRoughing(line);
+    }
+    return true;
+}
+
+bool GCodeCompiler::checkProfile(uint32_t line) {
+    GCodeProfileCycle& c = profileCycle;
+    if (profile.count < 2) {
+        return fail(line, ": profile needs 2 moves");
+    }
+    const int32_t* tip = profile.segments[0].end;
+    const int32_t* end = profile.segments[profile.count - 1].end;
+    c.xSign = c.start[0] > tip[0] ? 1 : c.start[0] < tip[0] ? -1 : 0;
+    c.zSign = end[1] > c.start[1] ? 1 : end[1] < c.start[1] ? -1 : 0;
+    if (c.xSign == 0 || c.zSign == 0) {
+        return fail(line, ": profile from the cycle start");
+    }
+
+    // Type I: after the approach X runs back towards the start and Z
+    // away from it, so each pass level meets the profile once
+    for (int i = 1; i < profile.count; i++) {
+        const GCodeProfileSegment& s = profile.segments[i];
+        const int32_t* from = profile.segments[i - 1].end;
+        if ((int64_t)(s.end[0] - from[0]) * c.xSign < 0 || (int64_t)(s.end[1] - from[1]) * c.zSign < 0 ||
+            (int64_t)(c.start[0] - s.end[0]) * c.xSign < 0) {
+            return fail(line, ": profile not monotonic");
+        }
+        if (s.motion >= 2) {
+            // Within one quadrant of its centre, at most a quarter turn
+            double sx = from[0] - s.center[0], sz = from[1] - s.center[1];
+            double ex = s.end[0] - s.center[0], ez = s.end[1] - s.center[1];
+            double cross = sz * ex - sx * ez;
+            bool clockwise = s.motion == 2;
+            if (sx * ex < 0 || sz * ez < 0 || (clockwise ? cross > 0 : cross < 0)) {
+                return fail(line, ": profile arc not monotonic");
+            }
+        }
+    }
+    return true;
+}
+
+bool GCodeCompiler::startRoughing(uint32_t line) {
+    GCodeProfileCycle& c = profileCycle;
+    // Allowance leaves stock on the side the tool comes from
+    c.offset[0] *= c.xSign;
+    c.offset[1] *= -c.zSign;
+    int32_t span = (c.start[0] - profile.segments[0].end[0] - c.offset[0]) * c.xSign;
+    if (span <= 0) {
+        return fail(line, ": allowance beyond the start");
+    }
+    if ((span - 1) / c.depth > GCODE_CYCLE_PASSES_MAX) {
+        return fail(line, ": G71 over %d passes", GCODE_CYCLE_PASSES_MAX);
+    }
+    c.level = c.start[0];
+    expanding = GCODE_CYCLE_ROUGH;
+    return true;
+}
+
+int32_t GCodeCompiler::profileZ(int32_t x) const {
+    // First segment to reach level x, on the profile shifted by the allowance
+    const GCodeProfileCycle& c = profileCycle;
+    for (int i = 1; i < profile.count; i++) {
+        const GCodeProfileSegment& s = profile.segments[i];
+        int32_t from[2] = {profile.segments[i - 1].end[0] + c.offset[0], profile.segments[i - 1].end[1] + c.offset[1]};
+        int32_t to[2] = {s.end[0] + c.offset[0], s.end[1] + c.offset[1]};
+        if ((int64_t)(to[0] - x) * c.xSign < 0) {
+            continue;
+        }
+        if (s.motion < 2) {
+            if (to[0] == from[0]) {
+                return from[1];
+            }
+            return from[1] + (int32_t)((int64_t)(x - from[0]) * (to[1] - from[1]) / (to[0] - from[0]));
+        }
+        double cx = s.center[0] + c.offset[0];
+        double cz = s.center[1] + c.offset[1];
+        double r2 = (from[0] - cx) * (from[0] - cx) + (from[1] - cz) * (from[1] - cz);
+        double h2 = r2 - (x - cx) * (x - cx);
+        double side = from[1] != cz ? from[1] - cz : to[1] - cz;
+        double h = h2 > 0 ? sqrt(h2) : 0;
+        return (int32_t)lround(side < 0 ? cz - h : cz + h);
+    }
+    return profile.segments[profile.count - 1].end[1] + c.offset[1];
+}
+
+bool GCodeCompiler::expandProfile(GCodeRecordSink& sink) {
+    GCodeProfileCycle& c = profileCycle;
+    if (!c.contour) {
+        // One roughing pass per call: in at the start Z, along Z to the
+        // profile, out at 45 degrees, back to the start Z
+        int32_t tipX = profile.segments[0].end[0] + c.offset[0];
+        int32_t x = c.level - c.xSign * c.depth;
+        if ((int64_t)(x - tipX) * c.xSign > 0) {
+            c.level = x;
+            int32_t z = profileZ(x);
+            if ((int64_t)(z - c.start[1]) * c.zSign <= 0) {
+                return true;  // Profile starts beyond this level
+            }
+            int32_t outX = x + c.xSign * c.retract;
+            int32_t backZ = z - c.zSign * c.retract;
+            if ((int64_t)(backZ - c.start[1]) * c.zSign < 0) backZ = c.start[1];
+            return putMove(GCODE_REC_RAPID, c.line, x, c.start[1], sink) &&
+                   putMove(GCODE_REC_LINE, c.line, x, z, sink) &&
+                   putMove(GCODE_REC_RAPID, c.line, outX, backZ, sink) &&
+                   putMove(GCODE_REC_RAPID, c.line, outX, c.start[1], sink);
+        }
+        c.contour = true;
+        return putMove(GCODE_REC_RAPID, c.line, c.start[0], c.start[1], sink);
+    }
+
+    // Then one profile block per call, shifted by the allowance (none for G70)
+    if (c.segment < profile.count) {
+        const GCodeProfileSegment& s = profile.segments[c.segment++];
+        int32_t x = s.end[0] + c.offset[0];
+        int32_t z = s.end[1] + c.offset[1];
+        if (s.motion >= 2) {
+            GCodeRecord record = {GCODE_REC_ARC_CENTER, 0, 0, c.line,
+                                  s.center[0] + c.offset[0] - positionDu[0],
+                                  s.center[1] + c.offset[1] - positionDu[1]};
+            if (!sink.put(record)) {
+                return fail(c.line, ": no room");
+            }
+            return putMove(s.motion == 2 ? GCODE_REC_ARC_CW : GCODE_REC_ARC_CCW, c.line, x, z, sink);
+        }
+        return putMove(s.motion == 0 ? GCODE_REC_RAPID : GCODE_REC_LINE, c.line, x, z, sink);
+    }
+
+    // Back to the start, X first and only outwards to clear the part
+    expanding = GCODE_CYCLE_NONE;
+    int32_t clearX = (int64_t)(positionDu[0] - c.start[0]) * c.xSign > 0 ? positionDu[0] : c.start[0];
+    return putMove(GCODE_REC_RAPID, c.line, clearX, positionDu[1], sink) &&
+           putMove(GCODE_REC_RAPID, c.line, clearX, c.start[1], sink) &&
+           putMove(GCODE_REC_RAPID, c.line, c.start[0], c.start[1], sink);
+}
+
+bool GCodeCompiler::compileLine(const char* text, size_t len, uint32_t line, GCodeRecordSink& sink) {
+    if (!GCodeParser::parse(text, len, block)) {
+        return fail(line, ":%u %s", block.errorColumn + 1, GCodeParser::errorText(block.error));
+    }
+    if (block.tapeMarker || block.isEmpty()) {
+        return true;
+    }
+    if (ended) {
+        return true;  // Anything after M2/M30 never runs
+    }
+    if (capturing) {
+        return captureProfile(line);
+    }
+
+    uint32_t unsupported = block.words & ~SUPPORTED_WORDS;
+    if (unsupported) {
+        return fail(line, ": %c not supported", 'A' + __builtin_ctz(unsupported));
+    }
+
+    // Modal G words first, so units and distance mode apply to this line
+    int motion = -1;
+    int cycleCode = -1;
+    for (int i = 0; i < block.gCount; i++) {
+        switch (block.g[i]) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            case 33: motion = block.g[i]; break;
+            case 70:
+            case 71:
+            case 76: cycleCode = block.g[i]; break;  // Not modal
+            case 18: break;                   // ZX plane - the only one a lathe has
+            case 20: inch = true; break;
+            case 21: inch = false; break;
+            case 90: absolute = true; break;
+            case 91: absolute = false; break;
+            case 94: break;                   // Units per minute - the only feed mode
+            default:
+                return fail(line, ": G%d not supported", block.g[i]);
+        }
+    }
+
+    GCodeRecord record = {0, 0, 0, line, 0, 0};
+
+    if (block.has('F')) {
+        if (block.get('F') <= 0) {
+            return fail(line, ": bad feed");
+        }
+        int32_t feed = toDu(block.get('F')) / 60;
+        feedDuPerSec = feed < GCODE_FEED_MIN_DU_SEC ? GCODE_FEED_MIN_DU_SEC : feed;
+        record.type = GCODE_REC_FEED;
+        record.a = feedDuPerSec;
+        if (!sink.put(record)) {
+            return fail(line, ": no room");
+        }
+    }
+
+    if (cycleCode >= 0 && (motion >= 0 || block.has('M'))) {
+        return fail(line, ": G%d shares the line", cycleCode);
+    }
+    if (motion >= 0) {
+        motionMode = motion;
+    }
+    int mode = cycleCode >= 0 ? cycleCode : motionMode;
+    bool arc = mode == 2 || mode == 3;
+    uint32_t allowed = 0;
+    switch (mode) {
+        case 2:
+        case 3:  allowed = ARC_WORDS; break;
+        case 33: allowed = SYNC_WORDS; break;
+        case 70: allowed = FINISH_WORDS; break;
+        case 71: allowed = ROUGH_WORDS; break;
+        case 76: allowed = THREAD_WORDS; break;
+    }
+    uint32_t misplaced = block.words & PARAMETER_WORDS & ~allowed;
+    if (misplaced) {
+        return fail(line, ": %c not valid in G%d", 'A' + __builtin_ctz(misplaced), mode);
+    }
+    if (cycleCode == 76) {
+        return beginThreadCycle(line);
+    }
+    if (cycleCode >= 0) {
+        return beginProfileCycle(line, cycleCode == 71);
+    }
+
+    // I/K alone is a full circle
+    if (block.has('X') || block.has('Z') || (arc && (block.has('I') || block.has('K')))) {
+        int32_t startDu[2] = {positionDu[0], positionDu[1]};
+        int32_t endDu[2] = {positionDu[0], positionDu[1]};
+        bool wasKnown[2] = {known[0], known[1]};
+        const char letters[2] = {'X', 'Z'};
+        for (int axis = 0; axis < 2; axis++) {
+            if (block.has(letters[axis])) {
+                int32_t du = toDu(block.get(letters[axis]));
+                if (absolute) {
+                    endDu[axis] = du;
+                    known[axis] = true;
+                } else {
+                    endDu[axis] += du;
+                }
+            }
+        }
+        positionDu[0] = endDu[0];
+        positionDu[1] = endDu[1];
+
+        if (arc) {
+            // Start and end must be in the same frame for the geometry
+            if (known[0] != wasKnown[0] || known[1] != wasKnown[1]) {
+                return fail(line, ": arc from unknown start");
+            }
+            int32_t centerDu[2];
+            if (!arcCenter(line, startDu, endDu, motionMode == 2, centerDu)) {
+                return false;
+            }
+            record.type = GCODE_REC_ARC_CENTER;
+            record.a = centerDu[0];
+            record.b = centerDu[1];
+            if (!sink.put(record)) {
+                return fail(line, ": no room");
+            }
+            record.a = record.b = 0;
+        }
+
+        GCodeRecordType type = motionMode == 0 ? GCODE_REC_RAPID : GCODE_REC_LINE;
+        if (arc) {
+            type = motionMode == 2 ? GCODE_REC_ARC_CW : GCODE_REC_ARC_CCW;
+        } else if (motionMode == 33) {
+            // Lead per move as in LinuxCNC; the start angle lets passes
+            // and starts meet the same groove
+            if (!block.has('K') || block.get('K') <= 0) {
+                return fail(line, ": G33 needs K");
+            }
+            int32_t angle = block.has('Q') ? block.get('Q') / (GCODE_FIXED_ONE / 1000) : 0;
+            angle %= GCODE_TURN_MILLIDEG;
+            if (angle < 0) angle += GCODE_TURN_MILLIDEG;
+            if (!putThread(line, toDu(block.get('K')), angle, sink)) {
+                return false;
+            }
+            type = GCODE_REC_SYNC;
+        }
+        if (!putMove(type, line, endDu[0], endDu[1], sink)) {
+            return false;
+        }
+    } else if (motionMode == 33 && (block.words & SYNC_WORDS)) {
+        return fail(line, ": G33 without X/Z");
+    }
+
+    // Program stops act after the motion on the same line
+    if (block.has('M')) {
+        if (block.get('M') % GCODE_FIXED_ONE != 0) {
+            return fail(line, ": bad M");
+        }
+        switch (block.getInt('M')) {
+            case 0:
+            case 1:  record.type = GCODE_REC_PAUSE; break;    // Optional stop always on
+            case 2:
+            case 30: record.type = GCODE_REC_END; ended = true; break;
+            default:
+                return fail(line, ": M%ld not supported", (long)block.getInt('M'));
+        }
+        if (!sink.put(record)) {
+            return fail(line, ": no room");
+        }
+    }
+    return true;
+}
@@ -0,0 +1,211 @@
+#ifndef GCODECOMPILER_H
+#define GCODECOMPILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "GCodeParser.h"
+#include "GCodeArc.h"
+
+/**
+ * GCodeCompiler - Turns G-code lines into motion records
+ *
+ * Holds the modal state (units, distance mode, motion mode, feed) and
+ * emits fixed 16-byte records with targets already in motor steps. Stored
+ * programs are compiled once when uploaded (GCodeBinary), streamed lines
+ * one at a time while running, so both run the same semantics and the
+ * executor never parses.
+ *
+ * Supported: G0 G1 G2 G3 G18 G20 G21 G33 G70 G71 G76 G90 G91 G94, M0 M1
+ * M2 M30, D F H I J K L N P Q R U W X Z T, comments, block delete and "%"
+ * tape markers.
+ * X is the radial axis in the same units as Z, measured from the work
+ * zero. Arc centres (I, K) are always relative to the arc start.
+ *
+ * G33 X Z K<lead> [Q<start angle, degrees>] is a spindle-synchronised
+ * move. G76 P<pitch> Z I J K [R Q H L] is the LinuxCNC threading cycle
+ * started from the drive line, except that L is the number of starts
+ * (tapered ends are not supported); every depth is cut on each start
+ * before going deeper.
+ *
+ * G71 P<ns> Q<nf> D<depth> [R<retract> U<X allowance> W<Z allowance>]
+ * roughs in the Fanuc one-line form: the profile is the blocks numbered
+ * N<ns> to N<nf> right after it, which are stored (not run) and must be
+ * monotonic in X and Z after the first, approach block (type I). Passes
+ * step from the cycle start X by D, retract by R at 45 degrees, and a last
+ * pass follows the profile shifted by U/W. G70 P<ns> Q<nf> then finishes
+ * along the stored profile. Profile blocks take G0-G3 X Z I K R only.
+ *
+ * Features:
+ * - Exact integer unit conversion, rounded to the nearest step
+ * - Until an axis gets an absolute coordinate its targets are relative to
+ *   wherever the program starts (flagged per record)
+ * - Arcs stay one record pair, expanded into chords by GCodeArc when run
+ * - Cycles are expanded one pass per expand() call, so a small record
+ *   buffer can take a cycle of any length
+ * - First error stops compilation with line number and reason
+ * - No Arduino dependencies
+ */
+
+#define GCODE_COMPILER_ERROR_MAX 40
+#define GCODE_FEED_DEFAULT_DU_SEC 20000   // Feed until the program sets F (h5.ino)
+#define GCODE_FEED_MIN_DU_SEC 167         // F1 mm/min floor (h5.ino)
+#define GCODE_ARC_RADIUS_ERROR_DU 50      // I/K start and end radius may differ this much
+#define GCODE_CYCLE_PASSES_MAX 200        // Passes one cycle may expand to
+#define GCODE_EXPAND_RECORDS_MAX 8        // Records one expand() call emits at most
+#define GCODE_TURN_MILLIDEG 360000        // Start angle units per revolution
+#define GCODE_PROFILE_SEGMENTS 32         // G71/G70 profile blocks kept
+#define GCODE_ROUGH_RETRACT_DU 5000       // G71 retract without R
+
+enum GCodeRecordType : uint8_t {
+    GCODE_REC_RAPID = 1,     // a, b = X, Z target steps
+    GCODE_REC_LINE,          // a, b = X, Z target steps at the current feed
+    GCODE_REC_FEED,          // a = path feed in du/s
+    GCODE_REC_PAUSE,         // M0/M1 once motion is done
+    GCODE_REC_END,           // M2/M30
+    GCODE_REC_ARC_CENTER,    // a, b = X, Z centre in du from the arc start; an arc follows
+    GCODE_REC_ARC_CW,        // G2, a, b = X, Z end target steps at the current feed
+    GCODE_REC_ARC_CCW,       // G3
+    GCODE_REC_THREAD,        // a = lead in du/rev, b = start angle in millidegrees; a sync move follows
+    GCODE_REC_SYNC           // G33, a, b = X, Z end target steps locked to the spindle
+};
+
+// Record flags: target relative to the program start position
+#define GCODE_REC_X_FROM_START 0x01
+#define GCODE_REC_Z_FROM_START 0x02
+
+struct GCodeRecord {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t reserved;
+    uint32_t line;           // Source line, 1-based
+    int32_t a;
+    int32_t b;
+};
+
+// Steps per lead screw turn and screw pitch (du), X then Z
+struct GCodeAxisScale {
+    int32_t motorSteps[2];
+    int32_t screwPitch[2];
+};
+
+// Receives compiled records; false aborts compilation
+class GCodeRecordSink {
+public:
+    virtual bool put(const GCodeRecord& record) = 0;
+};
+
+// G76 being expanded, positions in du in the compiler's frame
+struct GCodeThreadCycle {
+    uint32_t line;
+    int32_t driveX;          // Retract line = X at the cycle start
+    int32_t startZ;
+    int32_t endZ;
+    int32_t crestX;          // Drive line + I
+    int8_t depthSign;        // -1 external (I < 0), +1 internal
+    int32_t lead;            // Pitch x starts, du/rev
+    int32_t firstDepth;      // J
+    int32_t fullDepth;       // K
+    float degression;        // R
+    float compoundTan;       // tan(Q)
+    uint16_t depthPasses;    // Passes up to full depth
+    uint16_t totalPasses;    // Including spring passes, per start
+    uint8_t starts;          // L
+    uint16_t pass;           // Next pass x starts + start
+};
+
+// G71/G70 profile: segment 0 is the approach from the cycle start
+struct GCodeProfileSegment {
+    int32_t end[2];          // du, X then Z
+    int32_t center[2];       // Arcs, du
+    uint8_t motion;          // 0-3 as in G0-G3
+};
+
+struct GCodeProfile {
+    uint32_t first;          // N of the first and last block
+    uint32_t last;
+    uint8_t count;
+    bool complete;           // Last block seen
+    GCodeProfileSegment segments[GCODE_PROFILE_SEGMENTS];
+};
+
+// G71/G70 being expanded, positions in du
+struct GCodeProfileCycle {
+    uint32_t line;
+    int32_t start[2];        // Cycle start, also the retract point
+    int32_t offset[2];       // Finishing allowance, applied to the profile
+    int32_t depth;           // D
+    int32_t retract;         // R
+    int8_t xSign;            // Side of the profile the start is on
+    int8_t zSign;            // Cut direction along Z
+    int32_t level;           // X of the last roughing pass
+    bool contour;            // Roughing done, following the profile
+    uint8_t segment;         // Next profile segment
+};
+
+enum GCodeCycleType : uint8_t {
+    GCODE_CYCLE_NONE,
+    GCODE_CYCLE_THREAD,      // G76
+    GCODE_CYCLE_ROUGH,       // G71
+    GCODE_CYCLE_FINISH       // G70
+};
+
+class GCodeCompiler {
+private:
+    GCodeAxisScale scale;
+    GCodeBlock block;
+    GCodeThreadCycle thread;
+    GCodeProfileCycle profileCycle;
+    GCodeProfile profile;
+    GCodeCycleType expanding;
+    bool capturing;          // Reading G71 profile blocks
+
+    // Modal state
+    bool absolute;
+    bool inch;
+    uint8_t motionMode;
+    int32_t feedDuPerSec;
+    int32_t positionDu[2];   // Programmed position
+    bool known[2];           // Axis had an absolute coordinate
+    bool ended;              // M2/M30 seen
+
+    char errorText[GCODE_COMPILER_ERROR_MAX];
+
+    bool fail(uint32_t line, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    int32_t toDu(int32_t fixed) const;
+    bool arcCenter(uint32_t line, const int32_t startDu[2], const int32_t endDu[2], bool clockwise,
+                   int32_t centerDu[2]);
+    bool putMove(GCodeRecordType type, uint32_t line, int32_t xDu, int32_t zDu, GCodeRecordSink& sink);
+    bool putThread(uint32_t line, int32_t leadDu, int32_t startMillideg, GCodeRecordSink& sink);
+    bool beginThreadCycle(uint32_t line);
+    bool expandThread(GCodeRecordSink& sink);
+    bool beginProfileCycle(uint32_t line, bool roughing);
+    bool captureProfile(uint32_t line);
+    bool checkProfile(uint32_t line);
+    bool startRoughing(uint32_t line);
+    int32_t profileZ(int32_t x) const;
+    bool expandProfile(GCodeRecordSink& sink);
+
+public:
+    GCodeCompiler();
+
+    void reset(const GCodeAxisScale& axisScale);
+
+    // Compile one source line. False on error, see getError(). A cycle
+    // leaves isExpanding() set: call expand() until it clears before the
+    // next line.
+    bool compileLine(const char* text, size_t len, uint32_t line, GCodeRecordSink& sink);
+    bool isExpanding() const { return expanding != GCODE_CYCLE_NONE; }
+    bool expand(GCodeRecordSink& sink);
+
+    // Source ended: false if a G71 profile is still open
+    bool finishProgram(uint32_t line);
+
+    bool isEnded() const { return ended; }
+    const char* getError() const { return errorText; }
+
+    // Nearest step for a distance in du, and back
+    static int32_t duToSteps(const GCodeAxisScale& scale, int axis, int32_t du);
+    static int32_t stepsToDu(const GCodeAxisScale& scale, int axis, int32_t steps);
+};
+
+#endif // GCODECOMPILER_H
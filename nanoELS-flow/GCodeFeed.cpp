@@ -0,0 +1,137 @@
+#include "GCodeFeed.h"
+#include "GCodeBinary.h"
+
+// Global instance
+GCodeFeed gcodeFeed;
+
+GCodeFeed::GCodeFeed()
+    : request(0), served(0), reading(false), pendingError(GCODE_FEED_RECORD),
+      generation(0), answered(false), starved(false), openMs(0), underruns(0) {
+    requestName[0] = '\0';
+}
+
+void GCodeFeed::open(const char* name) {
+    // Closed generation first: the web task drops a name copied meanwhile
+    request.store(++generation << 1, std::memory_order_release);
+    strncpy(requestName, name, sizeof(requestName) - 1);
+    requestName[sizeof(requestName) - 1] = '\0';
+    request.store((++generation << 1) | 1, std::memory_order_release);
+    answered = false;
+    starved = false;
+    openMs = millis();
+}
+
+void GCodeFeed::close() {
+    request.store(++generation << 1, std::memory_order_release);
+}
+
+bool GCodeFeed::next(GCodeRecord& record, GCodeFeedStatus& status) {
+    GCodeFeedItem item;
+    while (items.pop(item)) {
+        if (item.generation != (uint16_t)generation) {
+            continue;  // Left over from an earlier program
+        }
+        answered = true;
+        starved = false;
+        record = item.record;
+        status = (GCodeFeedStatus)item.status;
+        return true;
+    }
+
+    // Ran dry after the program started: the web task fell behind
+    if (answered && !starved) {
+        starved = true;
+        underruns = underruns + 1;
+    }
+    return false;
+}
+
+void GCodeFeed::service(fs::FS& fs) {
+    uint32_t current = request.load(std::memory_order_acquire);
+    if (current != served) {
+        if (file) {
+            file.close();
+        }
+        reading = false;
+        pendingError = GCODE_FEED_RECORD;
+        if (current & 1) {
+            char name[GCODE_INDEX_NAME_LEN];
+            memcpy(name, requestName, sizeof(name));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (request.load(std::memory_order_relaxed) != current) {
+                return;  // Renamed while copying, next pass
+            }
+            name[sizeof(name) - 1] = '\0';
+            served = current;
+            openBinary(fs, name);
+        } else {
+            served = current;
+        }
+    }
+
+    if (pendingError != GCODE_FEED_RECORD) {
+        pushError();
+    } else if (reading) {
+        readAhead();
+    }
+}
+
+void GCodeFeed::openBinary(fs::FS& fs, const char* name) {
+    // The web task compiled it when it was saved or selected; only check
+    // that it was built for this machine
+    char path[GCODE_INDEX_NAME_LEN + 8];
+    GCodeBinary::pathFor(name, path, sizeof(path));
+    file = fs.open(path, "r");
+    if (!file) {
+        pendingError = GCODE_FEED_NOT_COMPILED;
+        return;
+    }
+    GCodeBinaryHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        !GCodeBinary::headerValid(header)) {
+        file.close();
+        pendingError = GCODE_FEED_BAD_BINARY;
+        return;
+    }
+    reading = true;
+}
+
+void GCodeFeed::readAhead() {
+    static GCodeRecord chunk[GCODE_FEED_READ_RECORDS];
+    size_t room = items.available();
+    if (room == 0) {
+        return;
+    }
+    if (room > GCODE_FEED_READ_RECORDS) {
+        room = GCODE_FEED_READ_RECORDS;
+    }
+
+    // Every binary ends with an END record, so running out is damage
+    int n = file.read((uint8_t*)chunk, room * sizeof(GCodeRecord));
+    if (n <= 0 || n % sizeof(GCodeRecord) != 0) {
+        file.close();
+        reading = false;
+        pendingError = GCODE_FEED_TRUNCATED;
+        pushError();
+        return;
+    }
+
+    // Only this task produces, so the room checked above is still there
+    GCodeFeedItem item = {(uint16_t)(served >> 1), GCODE_FEED_RECORD, 0, {}};
+    for (int i = 0; i < n / (int)sizeof(GCodeRecord); i++) {
+        item.record = chunk[i];
+        items.push(item);
+        if (chunk[i].type == GCODE_REC_END) {
+            file.close();
+            reading = false;
+            return;
+        }
+    }
+}
+
+void GCodeFeed::pushError() {
+    GCodeFeedItem item = {(uint16_t)(served >> 1), pendingError, 0, {}};
+    if (items.push(item)) {
+        pendingError = GCODE_FEED_RECORD;
+    }
+}
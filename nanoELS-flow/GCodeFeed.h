@@ -0,0 +1,98 @@
+#ifndef GCODEFEED_H
+#define GCODEFEED_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <atomic>
+#include "CircularBuffer.h"
+#include "GCodeCompiler.h"
+#include "GCodeIndex.h"
+
+/**
+ * GCodeFeed - Records of a stored program, read ahead by the web task
+ *
+ * The controller never touches LittleFS while a program runs: a flash
+ * write from the web task (upload, compile, job save) holds the
+ * filesystem lock long enough to stall motion mid-cut. Instead the
+ * controller asks for a program by name, and the web task opens its
+ * binary, checks the header and keeps a ring of records topped up, the
+ * way GCodeStream carries streamed lines.
+ *
+ * Every open and close starts a new generation. Items carry the
+ * generation they were read for, so records of a stopped program still
+ * in the ring are dropped by the consumer; the producer never has to
+ * clear the ring under it.
+ *
+ * Features:
+ * - Lock-free SPSC ring of records, no heap
+ * - Open errors and truncated files arrive in order as ring items
+ * - Underruns (ring ran dry while the program still had records) counted
+ * - Gives up if the web task does not answer an open (not running)
+ */
+
+#define GCODE_FEED_RECORDS 128            // Records read ahead (power of 2)
+#define GCODE_FEED_READ_RECORDS 16        // Records per file read
+#define GCODE_FEED_OPEN_TIMEOUT_MS 2000   // First item overdue, web task not serving
+
+enum GCodeFeedStatus : uint8_t {
+    GCODE_FEED_RECORD,          // item.record is the next record
+    GCODE_FEED_NOT_COMPILED,    // No binary for the program
+    GCODE_FEED_BAD_BINARY,      // Built for another machine or version
+    GCODE_FEED_TRUNCATED        // File ended before the END record
+};
+
+struct GCodeFeedItem {
+    uint16_t generation;
+    uint8_t status;             // GCodeFeedStatus
+    uint8_t reserved;
+    GCodeRecord record;
+};
+
+class GCodeFeed {
+private:
+    CircularBuffer<GCodeFeedItem, GCODE_FEED_RECORDS> items;
+
+    // Controller to web task: generation << 1, | 1 while a program is open.
+    // The name is written between a closed and an open generation, so a
+    // copy taken while the request did not change is complete.
+    std::atomic<uint32_t> request;
+    char requestName[GCODE_INDEX_NAME_LEN];
+
+    // Producer (web task) state
+    uint32_t served;                 // Request acted on
+    fs::File file;
+    bool reading;                    // Binary open, END record not read yet
+    GCodeFeedStatus pendingError;    // Waiting for ring space, RECORD = none
+
+    // Consumer (controller) state
+    uint32_t generation;
+    bool answered;                   // First item of this generation arrived
+    bool starved;                    // Already counted the current underrun
+    uint32_t openMs;
+    volatile uint32_t underruns;
+
+    void openBinary(fs::FS& fs, const char* name);
+    void readAhead();
+    void pushError();
+
+public:
+    GCodeFeed();
+
+    // Consumer interface - controller only
+    void open(const char* name);
+    void close();
+    bool next(GCodeRecord& record, GCodeFeedStatus& status);  // false while waiting
+    bool isOverdue() const { return !answered && millis() - openMs > GCODE_FEED_OPEN_TIMEOUT_MS; }
+
+    // Producer interface - web task only, every loop pass
+    void service(fs::FS& fs);
+
+    // Statistics
+    size_t buffered() const { return items.size(); }
+    uint32_t getUnderruns() const { return underruns; }
+};
+
+// Global record feed
+extern GCodeFeed gcodeFeed;
+
+#endif // GCODEFEED_H
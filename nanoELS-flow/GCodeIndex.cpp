@@ -0,0 +1,149 @@
+#include "GCodeIndex.h"
+
+// Global instance
+GCodeIndex gcodeIndex;
+
+// Nibble table for CRC-32 (reflected 0xEDB88320) - small enough for RAM
+static const uint32_t crcNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+GCodeIndex::GCodeIndex() : entryCount(0), listLength(0) {
+    listBuffer[0] = '\0';
+}
+
+void GCodeIndex::begin(GCodeFileStats& stats) {
+    stats.size = 0;
+    stats.lines = 0;
+    stats.crc = 0xFFFFFFFF;
+    stats.lastWasNewline = true;
+}
+
+void GCodeIndex::update(GCodeFileStats& stats, const uint8_t* data, size_t len) {
+    uint32_t crc = stats.crc;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        crc = (crc >> 4) ^ crcNibble[(crc ^ b) & 0x0F];
+        crc = (crc >> 4) ^ crcNibble[(crc ^ (b >> 4)) & 0x0F];
+        if (b == '\n') {
+            stats.lines++;
+        }
+    }
+    stats.crc = crc;
+    stats.size += len;
+    if (len > 0) {
+        stats.lastWasNewline = (data[len - 1] == '\n');
+    }
+}
+
+void GCodeIndex::finish(GCodeFileStats& stats) {
+    // Last line without a trailing newline still counts
+    if (!stats.lastWasNewline) {
+        stats.lines++;
+        stats.lastWasNewline = true;
+    }
+    stats.crc ^= 0xFFFFFFFF;
+}
+
+void GCodeIndex::rebuild(fs::FS& fs) {
+    uint8_t buffer[256];
+    entryCount = 0;
+
+    File root = fs.open("/");
+    File file = root.openNextFile();
+    while (file) {
+        String fileName = file.name();
+        if (fileName.startsWith("/")) {
+            fileName = fileName.substring(1);
+        }
+        if (fileName.endsWith(".gcode")) {
+            GCodeFileStats stats;
+            begin(stats);
+            size_t n;
+            while ((n = file.read(buffer, sizeof(buffer))) > 0) {
+                update(stats, buffer, n);
+            }
+            finish(stats);
+
+            fileName = fileName.substring(0, fileName.length() - 6);
+            if (!put(fileName.c_str(), stats)) {
+                Serial.printf("GCode index full, skipping %s\n", fileName.c_str());
+            }
+        }
+        file = root.openNextFile();
+    }
+
+    rebuildList();
+    Serial.printf("GCode index: %d programs\n", entryCount);
+}
+
+int GCodeIndex::findSlot(const char* name) const {
+    for (int i = 0; i < entryCount; i++) {
+        if (strcmp(entries[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const GCodeIndexEntry* GCodeIndex::find(const char* name) const {
+    int slot = findSlot(name);
+    return slot >= 0 ? &entries[slot] : nullptr;
+}
+
+bool GCodeIndex::put(const char* name, const GCodeFileStats& stats) {
+    if (strlen(name) >= GCODE_INDEX_NAME_LEN) {
+        return false;
+    }
+
+    int slot = findSlot(name);
+    if (slot < 0) {
+        if (entryCount >= GCODE_INDEX_MAX) {
+            return false;
+        }
+        slot = entryCount++;
+        strcpy(entries[slot].name, name);
+    }
+    entries[slot].stats = stats;
+
+    rebuildList();
+    return true;
+}
+
+bool GCodeIndex::remove(const char* name) {
+    int slot = findSlot(name);
+    if (slot < 0) {
+        return false;
+    }
+
+    // Keep entries packed; order is not significant
+    entries[slot] = entries[entryCount - 1];
+    entryCount--;
+
+    rebuildList();
+    return true;
+}
+
+void GCodeIndex::clear() {
+    entryCount = 0;
+    rebuildList();
+}
+
+void GCodeIndex::rebuildList() {
+    size_t len = 0;
+    for (int i = 0; i < entryCount; i++) {
+        const GCodeIndexEntry& e = entries[i];
+        int n = snprintf(listBuffer + len, sizeof(listBuffer) - len, "%s%s\t%u\t%u\t%08x",
+                         len > 0 ? "\n" : "", e.name,
+                         (unsigned)e.stats.size, (unsigned)e.stats.lines, (unsigned)e.stats.crc);
+        if (n < 0 || (size_t)n >= sizeof(listBuffer) - len) {
+            break;  // Cannot happen with LIST_LINE_MAX sizing, but never overrun
+        }
+        len += n;
+    }
+    listBuffer[len] = '\0';
+    listLength = len;
+}
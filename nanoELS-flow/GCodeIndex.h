@@ -0,0 +1,79 @@
+#ifndef GCODEINDEX_H
+#define GCODEINDEX_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+/**
+ * GCodeIndex - In-RAM directory of stored G-code programs
+ *
+ * The LittleFS root is scanned once when the web task starts; afterwards
+ * the index is kept in step by the upload and remove paths, so listing
+ * never touches the filesystem.
+ *
+ * Features:
+ * - Fixed-size entry table (no dynamic memory)
+ * - Name, size, line count and CRC-32 per program
+ * - Listing prebuilt into one buffer, regenerated only when the index changes
+ * - Statistics can be accumulated chunk by chunk while a file streams in
+ * - Programs beyond GCODE_INDEX_MAX are refused, never stored unlisted
+ */
+
+#define GCODE_INDEX_MAX 32           // Programs tracked
+#define GCODE_INDEX_NAME_LEN 33      // Name without "/" and ".gcode", incl. terminator
+
+// Running statistics for one program
+struct GCodeFileStats {
+    uint32_t size;
+    uint32_t lines;
+    uint32_t crc;        // CRC-32 (IEEE), finalised by finish()
+    bool lastWasNewline;
+};
+
+struct GCodeIndexEntry {
+    char name[GCODE_INDEX_NAME_LEN];
+    GCodeFileStats stats;
+};
+
+class GCodeIndex {
+private:
+    // One line per program: name \t size \t lines \t crc(hex) \n
+    static const size_t LIST_LINE_MAX = GCODE_INDEX_NAME_LEN + 32;
+
+    GCodeIndexEntry entries[GCODE_INDEX_MAX];
+    int entryCount;
+
+    char listBuffer[GCODE_INDEX_MAX * LIST_LINE_MAX];
+    size_t listLength;
+
+    int findSlot(const char* name) const;
+    void rebuildList();
+
+public:
+    GCodeIndex();
+
+    // Streaming statistics
+    static void begin(GCodeFileStats& stats);
+    static void update(GCodeFileStats& stats, const uint8_t* data, size_t len);
+    static void finish(GCodeFileStats& stats);
+
+    // Scan every *.gcode file in the filesystem root
+    void rebuild(fs::FS& fs);
+
+    // Maintenance from the add/remove paths
+    bool put(const char* name, const GCodeFileStats& stats);
+    bool remove(const char* name);
+    void clear();
+
+    // Queries
+    int count() const { return entryCount; }
+    const GCodeIndexEntry* get(int i) const { return (i >= 0 && i < entryCount) ? &entries[i] : nullptr; }
+    const GCodeIndexEntry* find(const char* name) const;
+    bool hasRoomFor(const char* name) const { return entryCount < GCODE_INDEX_MAX || findSlot(name) >= 0; }
+    const char* getListText(size_t& len) const { len = listLength; return listBuffer; }
+};
+
+// Global program index
+extern GCodeIndex gcodeIndex;
+
+#endif // GCODEINDEX_H
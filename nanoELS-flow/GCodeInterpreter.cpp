@@ -0,0 +1,398 @@
+#include "GCodeInterpreter.h"
+#include "FeedOverride.h"
+#include "GCodeBinary.h"
+#include "GCodeFeed.h"
+#include "GCodeStream.h"
+#include "MinimalMotionControl.h"
+#include <stdarg.h>
+
+// Global instance
+GCodeInterpreter gcodeInterpreter;
+
+GCodeInterpreter::GCodeInterpreter()
+    : source(GCODE_SOURCE_NONE), streamStarted(false), streamLines(0),
+      feedDuPerSec(GCODE_FEED_DEFAULT_DU_SEC), arcActive(false), syncActive(false),
+      syncArmed(false), syncWaiting(false), syncLead(0), syncAngle(0), syncReference(0),
+      syncSpindle(0), syncDirection(1), lastTickUs(0),
+      afterMove(GCODE_STATE_RUNNING), state(GCODE_STATE_IDLE), lineNumber(0),
+      recordsExecuted(0) {
+    programName[0] = '\0';
+    errorText[0] = '\0';
+    startSteps[0] = startSteps[1] = 0;
+    lastTarget[0] = lastTarget[1] = 0;
+    arcCenter[0] = arcCenter[1] = 0;
+    pending.clear();
+}
+
+bool GCodeInterpreter::selectProgram(const char* name) {
+    if (isActive() || strlen(name) >= GCODE_INDEX_NAME_LEN) {
+        return false;
+    }
+    strcpy(programName, name);
+    return true;
+}
+
+bool GCodeInterpreter::start() {
+    if (isActive()) {
+        return false;
+    }
+
+    errorText[0] = '\0';
+    if (programName[0] != '\0') {
+        // The web task opens the binary; a missing or bad one fails the
+        // program as soon as its answer arrives
+        gcodeFeed.open(programName);
+        source = GCODE_SOURCE_FILE;
+    } else {
+        source = GCODE_SOURCE_STREAM;
+        streamStarted = false;
+        streamLines = 0;
+    }
+    scale = GCodeBinary::machineScale();
+    compiler.reset(scale);
+    pending.clear();
+
+    // Start from wherever the axes are now
+    feedDuPerSec = GCODE_FEED_DEFAULT_DU_SEC;
+    arcActive = false;
+    syncActive = false;
+    syncLead = 0;
+    syncAngle = 0;
+    syncReference = motionControl.getSpindlePositionAvg();
+    for (int axis = 0; axis < 2; axis++) {
+        startSteps[axis] = motionControl.getPosition(axis);
+        lastTarget[axis] = startSteps[axis];
+        limits.maxSpeed[axis] = motionControl.stepsToDu(axis, motionControl.getMaxSpeed(axis));
+        limits.acceleration[axis] = motionControl.stepsToDu(axis, motionControl.getAcceleration(axis));
+        limits.duPerStep[axis] = (float)scale.screwPitch[axis] / scale.motorSteps[axis];
+    }
+    limits.junctionDeviation = GCODE_JUNCTION_DEVIATION_DU;
+    planner.reset(startSteps, limits);
+    planner.setOverride(feedOverride.getFeedScale(), feedOverride.getRapidScale());
+
+    lastTickUs = micros();
+    afterMove = GCODE_STATE_RUNNING;
+    lineNumber = 0;
+    recordsExecuted = 0;
+    state = GCODE_STATE_RUNNING;
+    return true;
+}
+
+void GCodeInterpreter::stop() {
+    if (isActive()) {
+        finish(GCODE_STATE_IDLE);
+    }
+}
+
+void GCodeInterpreter::resume() {
+    if (state == GCODE_STATE_PAUSED) {
+        state = GCODE_STATE_RUNNING;
+        lastTickUs = micros();
+    }
+}
+
+void GCodeInterpreter::finish(GCodeRunState endState) {
+    if (source == GCODE_SOURCE_FILE) {
+        gcodeFeed.close();
+    } else if (source == GCODE_SOURCE_STREAM && endState != GCODE_STATE_FINISHED) {
+        gcodeStream.abort();  // Whatever follows a failed line must not run later
+    }
+    source = GCODE_SOURCE_NONE;
+    afterMove = GCODE_STATE_RUNNING;
+    state = endState;
+}
+
+void GCodeInterpreter::fail(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vsnprintf(errorText, sizeof(errorText), format, args);
+    va_end(args);
+    Serial.printf("GCode: %s\n", errorText);
+    finish(GCODE_STATE_ERROR);
+}
+
+const GCodeRecord* GCodeInterpreter::nextRecord() {
+    if (pending.pos < pending.count) {
+        return &pending.records[pending.pos++];
+    }
+    pending.clear();
+
+    if (source == GCODE_SOURCE_FILE) {
+        // Read ahead by the web task; waits (motion keeps running) while empty
+        GCodeFeedStatus status;
+        if (!gcodeFeed.next(pending.records[0], status)) {
+            if (gcodeFeed.isOverdue()) {
+                fail("%s: no reader", programName);
+            }
+            return nullptr;
+        }
+        switch (status) {
+            case GCODE_FEED_RECORD:
+                pending.count = 1;
+                return &pending.records[pending.pos++];
+            case GCODE_FEED_NOT_COMPILED:
+                fail("%s not compiled", programName);
+                return nullptr;
+            case GCODE_FEED_BAD_BINARY:
+                fail("%s: bad binary", programName);
+                return nullptr;
+            default:
+                // Every binary ends with an END record, so running out is damage
+                fail("L%lu: binary truncated", (unsigned long)lineNumber);
+                return nullptr;
+        }
+    }
+
+    // Streamed program: finish a cycle one pass at a time, then compile
+    // lines until one produces records, wait for the first line, end with
+    // the stream
+    if (compiler.isExpanding()) {
+        if (!compiler.expand(pending)) {
+            fail("%s", compiler.getError());
+            return nullptr;
+        }
+        return pending.count > 0 ? &pending.records[pending.pos++] : nullptr;
+    }
+    size_t len;
+    const char* text;
+    while ((text = gcodeStream.nextLine(len)) != nullptr) {
+        streamStarted = true;
+        if (!compiler.compileLine(text, len, ++streamLines, pending)) {
+            fail("%s", compiler.getError());
+            return nullptr;
+        }
+        if (compiler.isExpanding() && pending.count == 0 && !compiler.expand(pending)) {
+            fail("%s", compiler.getError());
+            return nullptr;
+        }
+        if (pending.count > 0) {
+            return &pending.records[pending.pos++];
+        }
+    }
+    if (streamStarted && !gcodeStream.isActive()) {
+        if (!compiler.finishProgram(streamLines)) {
+            fail("%s", compiler.getError());
+            return nullptr;
+        }
+        afterMove = GCODE_STATE_FINISHED;
+    }
+    return nullptr;
+}
+
+bool GCodeInterpreter::motionDone() {
+    return planner.isEmpty() &&
+           motionControl.getPosition(AXIS_X) == motionControl.getTargetPosition(AXIS_X) &&
+           motionControl.getPosition(AXIS_Z) == motionControl.getTargetPosition(AXIS_Z);
+}
+
+void GCodeInterpreter::update() {
+    if (state != GCODE_STATE_RUNNING) {
+        return;
+    }
+    if (motionControl.getEmergencyStop()) {
+        fail("L%lu: emergency stop", (unsigned long)lineNumber);
+        return;
+    }
+
+    // Axes follow the planned path, like threading follows the spindle
+    uint32_t now = micros();
+    uint32_t elapsedUs = now - lastTickUs;
+    lastTickUs = now;
+    int32_t steps[2];
+    planner.setOverride(feedOverride.getFeedScale(), feedOverride.getRapidScale());
+    if (planner.advance((elapsedUs < GCODE_MAX_TICK_US ? elapsedUs : GCODE_MAX_TICK_US) * 1e-6f, steps)) {
+        motionControl.setTargetPosition(AXIS_X, steps[AXIS_X]);
+        motionControl.setTargetPosition(AXIS_Z, steps[AXIS_Z]);
+    }
+
+    if (syncActive) {
+        followSpindle();
+        return;
+    }
+
+    if (afterMove != GCODE_STATE_RUNNING) {
+        if (!motionDone()) {
+            return;
+        }
+        if (afterMove == GCODE_STATE_PAUSED) {
+            afterMove = GCODE_STATE_RUNNING;
+            state = GCODE_STATE_PAUSED;
+        } else {
+            finish(afterMove);
+        }
+        return;
+    }
+
+    // Queue ahead while the planner has room
+    for (int i = 0; i < GCODE_RECORDS_PER_UPDATE && state == GCODE_STATE_RUNNING &&
+                    afterMove == GCODE_STATE_RUNNING && !syncActive && !planner.isFull(); i++) {
+        if (arcActive) {
+            queueArcChord();
+            continue;
+        }
+        const GCodeRecord* record = nextRecord();
+        if (!record || !executeRecord(*record)) {
+            return;
+        }
+        recordsExecuted++;
+    }
+}
+
+bool GCodeInterpreter::executeRecord(const GCodeRecord& record) {
+    lineNumber = record.line;
+    switch (record.type) {
+        case GCODE_REC_FEED:
+            feedDuPerSec = record.a;
+            break;
+
+        case GCODE_REC_RAPID:
+        case GCODE_REC_LINE: {
+            int32_t target[2] = {record.a, record.b};
+            if (record.flags & GCODE_REC_X_FROM_START) target[AXIS_X] += startSteps[AXIS_X];
+            if (record.flags & GCODE_REC_Z_FROM_START) target[AXIS_Z] += startSteps[AXIS_Z];
+            queueMove(target, record.type == GCODE_REC_RAPID ? 0 : (float)feedDuPerSec);
+            break;
+        }
+
+        case GCODE_REC_ARC_CENTER:
+            arcCenter[AXIS_X] = record.a;
+            arcCenter[AXIS_Z] = record.b;
+            break;
+
+        case GCODE_REC_ARC_CW:
+        case GCODE_REC_ARC_CCW:
+            return beginArc(record);
+
+        case GCODE_REC_THREAD:
+            syncLead = record.a;
+            syncAngle = record.b;
+            break;
+
+        case GCODE_REC_SYNC:
+            if (syncLead <= 0) {
+                fail("L%lu: sync move without lead", (unsigned long)record.line);
+                return false;
+            }
+            beginSync(record);
+            break;
+
+        case GCODE_REC_PAUSE:
+            afterMove = GCODE_STATE_PAUSED;
+            break;
+
+        case GCODE_REC_END:
+            afterMove = GCODE_STATE_FINISHED;
+            break;
+
+        default:
+            fail("L%lu: bad record %u", (unsigned long)record.line, record.type);
+            return false;
+    }
+    return true;
+}
+
+void GCodeInterpreter::queueMove(const int32_t target[2], float speedDuPerSec) {
+    // Only called while the planner has room
+    planner.addLine(target, speedDuPerSec);
+    lastTarget[AXIS_X] = target[AXIS_X];
+    lastTarget[AXIS_Z] = target[AXIS_Z];
+}
+
+bool GCodeInterpreter::beginArc(const GCodeRecord& record) {
+    arcEnd[AXIS_X] = record.a;
+    arcEnd[AXIS_Z] = record.b;
+    if (record.flags & GCODE_REC_X_FROM_START) arcEnd[AXIS_X] += startSteps[AXIS_X];
+    if (record.flags & GCODE_REC_Z_FROM_START) arcEnd[AXIS_Z] += startSteps[AXIS_Z];
+
+    // Geometry in du from the arc start; the end is as close as the step
+    // grid allows, GCodeArc blends the small radius difference
+    int32_t endDu[2];
+    for (int axis = 0; axis < 2; axis++) {
+        arcOrigin[axis] = lastTarget[axis];
+        endDu[axis] = GCodeCompiler::stepsToDu(scale, axis, arcEnd[axis] - arcOrigin[axis]);
+    }
+    if (!arc.begin(arcCenter, endDu, record.type == GCODE_REC_ARC_CW)) {
+        fail("L%lu: bad arc", (unsigned long)record.line);
+        return false;
+    }
+    arcActive = true;
+    return true;
+}
+
+void GCodeInterpreter::queueArcChord() {
+    int32_t pointDu[2];
+    arc.next(pointDu);
+    if (arc.isDone()) {
+        arcActive = false;
+        queueMove(arcEnd, (float)feedDuPerSec);
+        return;
+    }
+
+    // Chord ends stay in substeps, so they are rounded to steps only once
+    // when the planner outputs a position
+    GCodeAxisScale substeps = scale;
+    int32_t target[2];
+    for (int axis = 0; axis < 2; axis++) {
+        substeps.motorSteps[axis] *= 1 << GCODE_SUBSTEP_BITS;
+        target[axis] = arcOrigin[axis] * (1 << GCODE_SUBSTEP_BITS) +
+                       GCodeCompiler::duToSteps(substeps, axis, pointDu[axis]);
+    }
+    planner.addLineSubsteps(target, (float)feedDuPerSec);
+}
+
+void GCodeInterpreter::beginSync(const GCodeRecord& record) {
+    syncEnd[AXIS_X] = record.a;
+    syncEnd[AXIS_Z] = record.b;
+    if (record.flags & GCODE_REC_X_FROM_START) syncEnd[AXIS_X] += startSteps[AXIS_X];
+    if (record.flags & GCODE_REC_Z_FROM_START) syncEnd[AXIS_Z] += startSteps[AXIS_Z];
+    syncStart[AXIS_X] = lastTarget[AXIS_X];
+    syncStart[AXIS_Z] = lastTarget[AXIS_Z];
+    syncActive = true;
+    syncArmed = false;
+    syncWaiting = false;
+}
+
+void GCodeInterpreter::followSpindle() {
+    if (!syncArmed) {
+        // Queued moves end at the start point first
+        if (!motionDone()) {
+            return;
+        }
+        int32_t rpm = motionControl.getSpindleRPM();
+        syncWaiting = rpm == 0;
+        if (syncWaiting) {
+            return;
+        }
+
+        // Next time the spindle passes the start angle, in the way it turns
+        syncDirection = rpm > 0 ? 1 : -1;
+        int32_t now = motionControl.getSpindlePositionAvg();
+        int32_t angle = syncReference + (int32_t)((int64_t)syncAngle * ENCODER_STEPS_INT / GCODE_TURN_MILLIDEG);
+        int32_t ahead = ((angle - now) * syncDirection) % ENCODER_STEPS_INT;
+        if (ahead < 0) ahead += ENCODER_STEPS_INT;
+        syncSpindle = now + ahead * syncDirection;
+        syncArmed = true;
+    }
+
+    // The longer axis is geared to the spindle, the other follows it, so a
+    // taper keeps its lead along the major axis as in threading mode
+    int32_t delta[2] = {syncEnd[AXIS_X] - syncStart[AXIS_X], syncEnd[AXIS_Z] - syncStart[AXIS_Z]};
+    int major = abs(delta[AXIS_Z]) >= abs(delta[AXIS_X]) ? AXIS_Z : AXIS_X;
+    int32_t length = abs(delta[major]);
+    int32_t counts = (motionControl.getSpindlePositionAvg() - syncSpindle) * syncDirection;
+    int32_t travel = counts > 0 ? motionControl.spindleToSteps(major, counts, syncLead) : 0;
+    bool done = travel >= length;
+    if (done) travel = length;
+    for (int axis = 0; axis < 2; axis++) {
+        int32_t target = length == 0 ? syncEnd[axis]
+                                     : syncStart[axis] + (int32_t)((int64_t)delta[axis] * travel / length);
+        motionControl.setTargetPosition(axis, target);
+    }
+
+    if (done) {
+        syncActive = false;
+        lastTarget[AXIS_X] = syncEnd[AXIS_X];
+        lastTarget[AXIS_Z] = syncEnd[AXIS_Z];
+        planner.reset(syncEnd, limits);  // Planned moves carry on from the end
+    }
+}
@@ -0,0 +1,157 @@
+#ifndef GCODEINTERPRETER_H
+#define GCODEINTERPRETER_H
+
+#include <Arduino.h>
+#include "GCodeCompiler.h"
+#include "GCodePlanner.h"
+#include "GCodeIndex.h"
+
+/**
+ * GCodeInterpreter - Runs G-code programs in MODE_GCODE
+ *
+ * Stored programs run from their compiled binary (GCodeBinary): the web
+ * task reads its records ahead into GCodeFeed and they go straight to
+ * GCodePlanner, so nothing is parsed and no file is read during the cut.
+ * Streamed programs (GCodeStream) are compiled one line at a time by the
+ * same GCodeCompiler, so both sources execute identical records. Arcs
+ * arrive as a centre and an end and are cut into chords by GCodeArc as
+ * the planner has room. Synchronised moves (G33, G76 passes) bypass the
+ * planner: once queued motion has stopped they wait for the spindle to
+ * reach the start angle, then the axes follow it with the gearing
+ * threading mode uses.
+ *
+ * Features:
+ * - No heap: record buffer and compiler state are fixed members
+ * - Moves relative to the start position resolved when queued
+ * - Several records per tick while the planner has room
+ * - Axis targets follow the planned path every tick, no stop between moves
+ * - Start angles are measured from the spindle position at program start,
+ *   so every pass of a thread meets the same groove
+ * - Feed and rapid override (FeedOverride) re-plan queued moves every
+ *   tick; synchronised moves always run at the programmed lead
+ * - First error stops the program and is kept for display
+ */
+
+#define GCODE_RECORD_BUFFER 16            // Records from one streamed line or cycle pass
+#define GCODE_RECORDS_PER_UPDATE 8        // Records queued per tick at most
+#define GCODE_ERROR_TEXT_MAX 40
+#define GCODE_MAX_TICK_US 5000            // Longer gaps are not made up in one jump
+
+enum GCodeSource : uint8_t {
+    GCODE_SOURCE_NONE,
+    GCODE_SOURCE_FILE,
+    GCODE_SOURCE_STREAM
+};
+
+enum GCodeRunState : uint8_t {
+    GCODE_STATE_IDLE,
+    GCODE_STATE_RUNNING,
+    GCODE_STATE_PAUSED,      // M0/M1, waiting for resume()
+    GCODE_STATE_FINISHED,    // M2/M30, end of file or end of stream
+    GCODE_STATE_ERROR
+};
+
+// Records waiting to be executed
+class GCodeRecordBuffer : public GCodeRecordSink {
+public:
+    GCodeRecord records[GCODE_RECORD_BUFFER];
+    uint8_t pos;
+    uint8_t count;
+
+    void clear() { pos = count = 0; }
+    bool put(const GCodeRecord& record) override {
+        if (count >= GCODE_RECORD_BUFFER) {
+            return false;
+        }
+        records[count++] = record;
+        return true;
+    }
+};
+
+class GCodeInterpreter {
+private:
+    // Program source
+    GCodeSource source;
+    char programName[GCODE_INDEX_NAME_LEN];
+    GCodeRecordBuffer pending;
+    GCodeCompiler compiler;  // Stream source only
+    bool streamStarted;
+    uint32_t streamLines;
+
+    // Execution state
+    GCodeAxisScale scale;
+    int32_t startSteps[2];   // Axis positions at start, for relative moves
+    int32_t lastTarget[2];   // End of the last queued move (steps)
+    int32_t feedDuPerSec;
+
+    // Arc being cut into chords
+    GCodeArc arc;
+    bool arcActive;
+    int32_t arcCenter[2];    // From GCODE_REC_ARC_CENTER, du from the arc start
+    int32_t arcOrigin[2];    // Arc start (steps)
+    int32_t arcEnd[2];       // Arc end (steps)
+
+    // Spindle-synchronised move
+    bool syncActive;
+    bool syncArmed;          // Start angle found, axes follow the spindle
+    bool syncWaiting;        // Spindle stopped, nothing to follow
+    int32_t syncLead;        // du/rev from GCODE_REC_THREAD
+    int32_t syncAngle;       // Start angle, millidegrees
+    int32_t syncReference;   // Spindle position at program start = angle 0
+    int32_t syncSpindle;     // Spindle position where the move starts
+    int8_t syncDirection;    // Spindle direction when armed
+    int32_t syncStart[2];    // Steps
+    int32_t syncEnd[2];
+
+    // Motion
+    GCodePlanner planner;
+    PlannerLimits limits;
+    uint32_t lastTickUs;
+    GCodeRunState afterMove;  // M0/M2 and end of program wait for queued motion
+
+    // Progress and errors
+    GCodeRunState state;
+    uint32_t lineNumber;     // Source line of the last queued record, 1-based
+    uint32_t recordsExecuted;
+    char errorText[GCODE_ERROR_TEXT_MAX];
+
+    const GCodeRecord* nextRecord();
+    bool executeRecord(const GCodeRecord& record);
+    void queueMove(const int32_t target[2], float speedDuPerSec);
+    bool beginArc(const GCodeRecord& record);
+    void queueArcChord();
+    void beginSync(const GCodeRecord& record);
+    void followSpindle();
+    bool motionDone();
+    void fail(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    void finish(GCodeRunState endState);
+
+public:
+    GCodeInterpreter();
+
+    // Program to run on the next start; empty name runs the stream
+    bool selectProgram(const char* name);
+    const char* getProgramName() const { return programName; }
+
+    // Control - controller task only
+    bool start();
+    void stop();
+    void resume();            // Continue after M0/M1
+    void update();            // Call every operation tick while running
+
+    // Status
+    GCodeRunState getState() const { return state; }
+    GCodeSource getSource() const { return source; }
+    bool isActive() const { return state == GCODE_STATE_RUNNING || state == GCODE_STATE_PAUSED; }
+    uint32_t getLineNumber() const { return lineNumber; }
+    uint32_t getRecordsExecuted() const { return recordsExecuted; }
+    uint8_t getQueuedMoves() const { return planner.getQueued(); }
+    bool isWaitingForSpindle() const { return syncActive && syncWaiting; }
+    bool isSynchronised() const { return syncActive; }
+    const char* getErrorText() const { return errorText; }
+};
+
+// Global interpreter
+extern GCodeInterpreter gcodeInterpreter;
+
+#endif // GCODEINTERPRETER_H
@@ -0,0 +1,160 @@
+#include "GCodeParser.h"
+
+static inline bool isDigitChar(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Reads [+-]digits[.digits] at line[i], advances i. Decimals past the
+// fixed point precision are rounded into the last kept digit.
+static bool parseFixed(const char* line, size_t len, size_t& i, int32_t& out) {
+    bool negative = false;
+    if (i < len && (line[i] == '-' || line[i] == '+')) {
+        negative = line[i] == '-';
+        i++;
+    }
+
+    int32_t whole = 0;
+    bool anyDigit = false;
+    while (i < len && isDigitChar(line[i])) {
+        whole = whole * 10 + (line[i] - '0');
+        if (whole > GCODE_FIXED_MAX) {
+            return false;
+        }
+        anyDigit = true;
+        i++;
+    }
+
+    int32_t fraction = 0;
+    int32_t scale = GCODE_FIXED_ONE;
+    if (i < len && line[i] == '.') {
+        i++;
+        while (i < len && isDigitChar(line[i])) {
+            if (scale > 1) {
+                scale /= 10;
+                fraction += (line[i] - '0') * scale;
+            } else if (scale == 1) {
+                if (line[i] >= '5') {
+                    fraction++;
+                }
+                scale = 0;  // Rounded once, ignore the rest
+            }
+            anyDigit = true;
+            i++;
+        }
+    }
+
+    if (!anyDigit) {
+        return false;
+    }
+    int32_t v = whole * GCODE_FIXED_ONE + fraction;
+    out = negative ? -v : v;
+    return true;
+}
+
+bool GCodeParser::parse(const char* line, size_t len, GCodeBlock& block) {
+    block.words = 0;
+    block.gCount = 0;
+    block.tapeMarker = false;
+    block.error = GCODE_OK;
+    block.errorColumn = 0;
+
+    size_t i = 0;
+    while (i < len && isBlank(line[i])) {
+        i++;
+    }
+    if (i < len && line[i] == '/') {
+        return true;  // Block delete - always skipped
+    }
+    if (i < len && line[i] == '%') {
+        block.tapeMarker = true;
+        return true;
+    }
+
+    while (i < len) {
+        char c = line[i];
+        if (isBlank(c)) {
+            i++;
+            continue;
+        }
+        if (c == ';') {
+            break;
+        }
+        if (c == '(') {
+            while (i < len && line[i] != ')') {
+                i++;
+            }
+            if (i == len) {
+                block.error = GCODE_ERR_COMMENT;
+                break;
+            }
+            i++;
+            continue;
+        }
+
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        }
+        if (c < 'A' || c > 'Z') {
+            block.error = GCODE_ERR_LETTER;
+            break;
+        }
+
+        size_t wordStart = i++;
+        while (i < len && isBlank(line[i])) {
+            i++;  // "X 10" is legal RS274
+        }
+        int32_t v;
+        if (!parseFixed(line, len, i, v)) {
+            block.error = GCODE_ERR_NUMBER;
+            i = wordStart;
+            break;
+        }
+
+        if (c == 'G') {
+            if (v % GCODE_FIXED_ONE != 0) {
+                block.error = GCODE_ERR_RANGE;
+                i = wordStart;
+                break;
+            }
+            if (block.gCount == GCODE_MAX_G_WORDS) {
+                block.error = GCODE_ERR_TOO_MANY_G;
+                i = wordStart;
+                break;
+            }
+            block.g[block.gCount++] = v / GCODE_FIXED_ONE;
+            continue;
+        }
+
+        uint32_t bit = GCODE_WORD(c);
+        if (block.words & bit) {
+            block.error = GCODE_ERR_DUPLICATE;
+            i = wordStart;
+            break;
+        }
+        block.words |= bit;
+        block.value[c - 'A'] = v;
+    }
+
+    if (block.error != GCODE_OK) {
+        block.errorColumn = i > 255 ? 255 : i;
+        return false;
+    }
+    return true;
+}
+
+const char* GCodeParser::errorText(GCodeParseError error) {
+    switch (error) {
+        case GCODE_OK: return "ok";
+        case GCODE_ERR_LETTER: return "unexpected character";
+        case GCODE_ERR_NUMBER: return "bad number";
+        case GCODE_ERR_RANGE: return "number out of range";
+        case GCODE_ERR_DUPLICATE: return "repeated word";
+        case GCODE_ERR_TOO_MANY_G: return "too many G words";
+        case GCODE_ERR_COMMENT: return "unclosed comment";
+    }
+    return "unknown";
+}
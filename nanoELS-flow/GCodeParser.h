@@ -0,0 +1,61 @@
+#ifndef GCODEPARSER_H
+#define GCODEPARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * GCodeParser - One-pass G-code line tokenizer
+ *
+ * A line is scanned once, left to right, into a fixed GCodeBlock. Numbers
+ * are converted to fixed point on the fly, so there is no String, no
+ * float parsing and no rescanning per letter.
+ *
+ * Features:
+ * - Fixed point values with 4 decimals (mm * 10000 = deci-microns)
+ * - Up to GCODE_MAX_G_WORDS G words per line, one of every other letter
+ * - ";" and "(...)" comments, "/" block delete, "%" tape marker
+ * - Case insensitive, whitespace anywhere between words
+ * - No Arduino dependencies (also built on the host by tools/gcode_parse_bench.cpp)
+ */
+
+#define GCODE_FIXED_ONE 10000        // Fixed point scale of word values
+#define GCODE_FIXED_MAX 200000       // Largest integer part accepted
+#define GCODE_MAX_G_WORDS 4          // G words on one line
+
+#define GCODE_WORD(letter) (1UL << ((letter) - 'A'))
+
+enum GCodeParseError : uint8_t {
+    GCODE_OK = 0,
+    GCODE_ERR_LETTER,        // Character that does not start a word
+    GCODE_ERR_NUMBER,        // Letter without a valid number
+    GCODE_ERR_RANGE,         // Number out of range or fractional where integer needed
+    GCODE_ERR_DUPLICATE,     // Same letter twice
+    GCODE_ERR_TOO_MANY_G,
+    GCODE_ERR_COMMENT        // "(" without ")"
+};
+
+struct GCodeBlock {
+    uint32_t words;                   // GCODE_WORD() bit for each letter present, G excluded
+    int32_t value[26];                // Fixed point value per letter, valid where has()
+    int16_t g[GCODE_MAX_G_WORDS];     // G numbers in line order
+    uint8_t gCount;
+    bool tapeMarker;                  // Line is a lone "%"
+    GCodeParseError error;
+    uint8_t errorColumn;
+
+    bool has(char letter) const { return words & GCODE_WORD(letter); }
+    int32_t get(char letter) const { return value[letter - 'A']; }
+    int32_t getInt(char letter) const { return value[letter - 'A'] / GCODE_FIXED_ONE; }
+    bool isEmpty() const { return words == 0 && gCount == 0; }
+};
+
+class GCodeParser {
+public:
+    // Parse len characters of line (no terminator needed). Returns false
+    // with block.error set on a malformed line.
+    static bool parse(const char* line, size_t len, GCodeBlock& block);
+    static const char* errorText(GCodeParseError error);
+};
+
+#endif // GCODEPARSER_H
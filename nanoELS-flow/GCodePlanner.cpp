@@ -0,0 +1,203 @@
+#include "GCodePlanner.h"
+#include <math.h>
+
+// Within this distance of the segment end the executor snaps to it, so
+// braking towards zero speed can never stall just short of the end
+static const float END_SNAP_DU = 0.5f;
+static const float SUBSTEPS = (float)(1 << GCODE_SUBSTEP_BITS);
+
+static int32_t substepsToSteps(int32_t substeps) {
+    return (substeps + (1 << (GCODE_SUBSTEP_BITS - 1))) >> GCODE_SUBSTEP_BITS;
+}
+
+GCodePlanner::GCodePlanner()
+    : head(0), count(0), lastNominal(0), lastAcceleration(0), haveLast(false),
+      progress(0), speed(0), segmentsDone(0) {
+    feedScale = 1.0f;
+    rapidScale = 1.0f;
+    limits = {{0, 0}, {0, 0}, GCODE_JUNCTION_DEVIATION_DU, {1, 1}};
+    queuedEnd[0] = queuedEnd[1] = 0;
+    lastUnit[0] = lastUnit[1] = 0;
+}
+
+void GCodePlanner::reset(const int32_t startSteps[2], const PlannerLimits& planLimits) {
+    limits = planLimits;
+    head = 0;
+    count = 0;
+    queuedEnd[0] = startSteps[0] * (1 << GCODE_SUBSTEP_BITS);
+    queuedEnd[1] = startSteps[1] * (1 << GCODE_SUBSTEP_BITS);
+    haveLast = false;
+    progress = 0;
+    speed = 0;
+    segmentsDone = 0;
+}
+
+bool GCodePlanner::addLine(const int32_t endSteps[2], float speedDuPerSec) {
+    int32_t end[2] = {endSteps[0] * (1 << GCODE_SUBSTEP_BITS), endSteps[1] * (1 << GCODE_SUBSTEP_BITS)};
+    return addLineSubsteps(end, speedDuPerSec);
+}
+
+bool GCodePlanner::addLineSubsteps(const int32_t endSubsteps[2], float speedDuPerSec) {
+    if (isFull()) {
+        return false;
+    }
+
+    float delta[2] = {(endSubsteps[0] - queuedEnd[0]) * limits.duPerStep[0] / SUBSTEPS,
+                      (endSubsteps[1] - queuedEnd[1]) * limits.duPerStep[1] / SUBSTEPS};
+    float length = sqrtf(delta[0] * delta[0] + delta[1] * delta[1]);
+    if (endSubsteps[0] == queuedEnd[0] && endSubsteps[1] == queuedEnd[1]) {
+        return true;  // Nothing to move, keep the previous direction for the next junction
+    }
+
+    PlannerSegment& s = segments[(head + count) % GCODE_PLANNER_SEGMENTS];
+    s.start[0] = queuedEnd[0];
+    s.start[1] = queuedEnd[1];
+    s.length = length;
+
+    // Project axis limits onto the direction of travel
+    float axisSpeed = INFINITY;
+    float acceleration = INFINITY;
+    for (int axis = 0; axis < 2; axis++) {
+        s.unit[axis] = delta[axis] / length;
+        float share = fabsf(s.unit[axis]);
+        if (share > 1e-6f) {
+            axisSpeed = fminf(axisSpeed, limits.maxSpeed[axis] / share);
+            acceleration = fminf(acceleration, limits.acceleration[axis] / share);
+        }
+    }
+    s.programmedSpeed = speedDuPerSec > 0 ? speedDuPerSec : 0;
+    s.axisSpeed = axisSpeed;
+    s.acceleration = acceleration;
+    float nominal = nominalFor(s);
+    s.nominalSpeed = nominal;
+
+    // Junction speed: the largest speed at which a circle of radius set by
+    // the junction deviation, tangent to both segments, stays within the
+    // acceleration limit. Straight on is capped by the nominal speeds only,
+    // a reversal stops.
+    s.junctionSpeed = 0;
+    s.maxEntrySpeed = 0;
+    if (haveLast) {
+        float cosTheta = -(lastUnit[0] * s.unit[0] + lastUnit[1] * s.unit[1]);
+        if (cosTheta < -0.9999f) {
+            s.junctionSpeed = INFINITY;
+        } else if (cosTheta < 0.9999f) {
+            float sinHalf = sqrtf(0.5f * (1.0f - cosTheta));
+            float a = fminf(lastAcceleration, acceleration);
+            s.junctionSpeed = sqrtf(a * limits.junctionDeviation * sinHalf / (1.0f - sinHalf));
+        }
+        s.maxEntrySpeed = fminf(s.junctionSpeed, fminf(lastNominal, nominal));
+    }
+    s.entrySpeed = 0;
+
+    queuedEnd[0] = endSubsteps[0];
+    queuedEnd[1] = endSubsteps[1];
+    lastUnit[0] = s.unit[0];
+    lastUnit[1] = s.unit[1];
+    lastNominal = nominal;
+    lastAcceleration = acceleration;
+    haveLast = true;
+    count++;
+
+    recalculate();
+    return true;
+}
+
+float GCodePlanner::nominalFor(const PlannerSegment& s) const {
+    if (s.programmedSpeed <= 0) {
+        return s.axisSpeed * fminf(rapidScale, 1.0f);
+    }
+    return fminf(s.programmedSpeed * feedScale, s.axisSpeed);
+}
+
+void GCodePlanner::setOverride(float feed, float rapid) {
+    if (feed == feedScale && rapid == rapidScale) {
+        return;
+    }
+    feedScale = feed;
+    rapidScale = rapid;
+    for (uint8_t i = 0; i < count; i++) {
+        PlannerSegment& s = at(i);
+        s.nominalSpeed = nominalFor(s);
+        if (i > 0) {
+            s.maxEntrySpeed = fminf(s.junctionSpeed, fminf(at(i - 1).nominalSpeed, s.nominalSpeed));
+        }
+    }
+    if (count > 0) {
+        lastNominal = at(count - 1).nominalSpeed;
+    }
+    recalculate();
+}
+
+void GCodePlanner::recalculate() {
+    // Backward pass: every segment must be able to brake to the next
+    // entry speed, the last one to rest
+    float next = 0;
+    for (int i = count - 1; i >= 1; i--) {
+        PlannerSegment& s = at(i);
+        s.entrySpeed = fminf(s.maxEntrySpeed, sqrtf(next * next + 2.0f * s.acceleration * s.length));
+        next = s.entrySpeed;
+    }
+
+    // Forward pass: entry speeds must be reachable from the actual state of
+    // the executing segment
+    PlannerSegment& current = at(0);
+    current.entrySpeed = speed;
+    float reachable = sqrtf(speed * speed + 2.0f * current.acceleration * (current.length - progress));
+    for (int i = 1; i < count; i++) {
+        PlannerSegment& s = at(i);
+        if (s.entrySpeed > reachable) {
+            s.entrySpeed = reachable;
+        }
+        reachable = sqrtf(s.entrySpeed * s.entrySpeed + 2.0f * s.acceleration * s.length);
+    }
+}
+
+bool GCodePlanner::advance(float dt, int32_t positionSteps[2]) {
+    if (count == 0) {
+        speed = 0;
+        positionSteps[0] = substepsToSteps(queuedEnd[0]);
+        positionSteps[1] = substepsToSteps(queuedEnd[1]);
+        return false;
+    }
+
+    PlannerSegment* s = &at(0);
+    float remaining = s->length - progress;
+    float exit = exitSpeed(0);
+
+    // Trapezoid, evaluated live: accelerate towards nominal but never
+    // faster than still allows braking to the exit speed. Above nominal
+    // (override lowered, or entered faster than this segment's feed) slow
+    // down at the segment's acceleration instead of jumping.
+    float brake = sqrtf(exit * exit + 2.0f * s->acceleration * remaining);
+    float v;
+    if (speed > s->nominalSpeed) {
+        v = fmaxf(speed - s->acceleration * dt, s->nominalSpeed);
+    } else {
+        v = fminf(speed + s->acceleration * dt, s->nominalSpeed);
+    }
+    v = fminf(v, brake);
+    progress += 0.5f * (speed + v) * dt;
+    speed = v;
+
+    if (progress >= s->length - END_SNAP_DU) {
+        // Carry the overshoot into the next segment
+        float overshoot = fmaxf(progress - s->length, 0.0f);
+        head = (head + 1) % GCODE_PLANNER_SEGMENTS;
+        count--;
+        segmentsDone++;
+        if (count == 0) {
+            progress = 0;
+            speed = 0;
+            positionSteps[0] = substepsToSteps(queuedEnd[0]);
+            positionSteps[1] = substepsToSteps(queuedEnd[1]);
+            return true;
+        }
+        s = &at(0);
+        progress = fminf(overshoot, s->length);
+    }
+
+    positionSteps[0] = substepsToSteps(s->start[0] + (int32_t)lroundf(s->unit[0] * progress * SUBSTEPS / limits.duPerStep[0]));
+    positionSteps[1] = substepsToSteps(s->start[1] + (int32_t)lroundf(s->unit[1] * progress * SUBSTEPS / limits.duPerStep[1]));
+    return true;
+}
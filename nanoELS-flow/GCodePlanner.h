@@ -0,0 +1,112 @@
+#ifndef GCODEPLANNER_H
+#define GCODEPLANNER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * GCodePlanner - Look-ahead motion planner for G-code moves
+ *
+ * Straight segments are queued in a window of GCODE_PLANNER_SEGMENTS. Each
+ * junction gets a maximum speed from the angle between the two segments and
+ * the acceleration limit (junction deviation model), and every time a
+ * segment is added a backward then forward pass assigns entry speeds that
+ * can always be reached and braked from within the queued distance. The
+ * last queued segment always ends at rest, so a starved queue stops safely.
+ *
+ * The executor advances a trapezoidal velocity profile by dt and returns
+ * the commanded position in steps, which the caller sets as axis targets
+ * every tick, the same way threading drives targets from the spindle.
+ *
+ * Feed and rapid overrides scale the nominal speeds of every queued
+ * segment, including the one executing, and re-plan the window; the
+ * executor then accelerates or brakes towards the new speed at the
+ * segment's acceleration, never in a jump.
+ *
+ * Features:
+ * - Axis speed and acceleration limits projected onto each segment
+ * - No stop between segments unless the path reverses or the queue runs dry
+ * - Overrides applied to queued motion, not only to moves queued later
+ * - Endpoints in motor steps (exact) or substeps (arc chords, rounded only
+ *   once on output), geometry and speeds in deci-microns
+ * - Axes 0 = X and 1 = Z
+ * - No Arduino dependencies (also built on the host by tools/gcode_planner_sim.cpp)
+ */
+
+#define GCODE_PLANNER_SEGMENTS 16           // Look-ahead window
+#define GCODE_JUNCTION_DEVIATION_DU 100     // 0.01mm corner rounding allowance
+#define GCODE_SUBSTEP_BITS 8                // Substep = 1/256 step
+
+struct PlannerLimits {
+    float maxSpeed[2];           // du/s per axis
+    float acceleration[2];       // du/s^2 per axis
+    float junctionDeviation;     // du, 0 = stop at every corner
+    float duPerStep[2];          // Screw pitch / motor steps per axis
+};
+
+struct PlannerSegment {
+    int32_t start[2];            // Substeps
+    float unit[2];               // Direction, unit length
+    float length;                // du
+    float programmedSpeed;       // du/s as queued, 0 = rapid
+    float axisSpeed;             // Fastest the axes allow along the segment
+    float nominalSpeed;          // du/s, programmed x override within axis limits
+    float acceleration;          // du/s^2 along the segment
+    float junctionSpeed;         // Corner limit from the geometry alone
+    float maxEntrySpeed;         // Junction limit with the previous segment
+    float entrySpeed;            // Planned
+};
+
+class GCodePlanner {
+private:
+    PlannerSegment segments[GCODE_PLANNER_SEGMENTS];
+    uint8_t head;                // Executing segment
+    uint8_t count;
+    PlannerLimits limits;
+    float feedScale;             // Overrides, 1 = as programmed
+    float rapidScale;
+
+    // End of the last queued segment, where the next one starts (substeps)
+    int32_t queuedEnd[2];
+    float lastUnit[2];
+    float lastNominal;
+    float lastAcceleration;
+    bool haveLast;
+
+    // Executor state within segments[head]
+    float progress;              // du from the segment start
+    float speed;                 // du/s
+    uint32_t segmentsDone;
+
+    PlannerSegment& at(uint8_t i) { return segments[(head + i) % GCODE_PLANNER_SEGMENTS]; }
+    float exitSpeed(uint8_t i) { return i + 1 < count ? at(i + 1).entrySpeed : 0.0f; }
+    float nominalFor(const PlannerSegment& s) const;
+    void recalculate();
+
+public:
+    GCodePlanner();
+
+    // Empty the queue and restart from a known position (steps)
+    void reset(const int32_t startSteps[2], const PlannerLimits& planLimits);
+
+    // Queue a straight move to a step target; path speed in du/s,
+    // 0 = as fast as the axes allow
+    bool addLine(const int32_t endSteps[2], float speedDuPerSec);
+    bool addLineSubsteps(const int32_t endSubsteps[2], float speedDuPerSec);
+
+    // Scale programmed feeds and rapids of queued and later segments;
+    // rapids never exceed the axis limits
+    void setOverride(float feed, float rapid);
+
+    // Advance by dt seconds, writes the commanded position in steps.
+    // False when idle.
+    bool advance(float dt, int32_t positionSteps[2]);
+
+    bool isFull() const { return count == GCODE_PLANNER_SEGMENTS; }
+    bool isEmpty() const { return count == 0; }
+    uint8_t getQueued() const { return count; }
+    float getSpeed() const { return speed; }
+    uint32_t getSegmentsDone() const { return segmentsDone; }
+};
+
+#endif // GCODEPLANNER_H
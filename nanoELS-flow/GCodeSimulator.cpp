@@ -0,0 +1,270 @@
+#include "GCodeSimulator.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+GCodeSimulator::GCodeSimulator()
+    : feedDuPerSec(GCODE_FEED_DEFAULT_DU_SEC), syncLead(0), operationStart(0), operationOpen(false) {
+    memset(&setup, 0, sizeof(setup));
+    memset(&result, 0, sizeof(result));
+    lastTarget[0] = lastTarget[1] = 0;
+    arcCenter[0] = arcCenter[1] = 0;
+}
+
+void GCodeSimulator::begin(const GCodeSimSetup& simSetup) {
+    setup = simSetup;
+    memset(&result, 0, sizeof(result));
+    for (int axis = 0; axis < 2; axis++) {
+        lastTarget[axis] = setup.startSteps[axis];
+        result.minSteps[axis] = INT32_MAX;
+        result.maxSteps[axis] = INT32_MIN;
+    }
+    result.feedMin = INT32_MAX;
+    feedDuPerSec = GCODE_FEED_DEFAULT_DU_SEC;
+    syncLead = 0;
+    operationStart = 0;
+    operationOpen = false;
+    planner.reset(setup.startSteps, setup.limits);
+}
+
+void GCodeSimulator::runUntilRoom() {
+    int32_t steps[2];
+    while (planner.isFull()) {
+        planner.advance(GCODE_SIM_TICK_S, steps);
+        result.seconds += GCODE_SIM_TICK_S;
+    }
+}
+
+void GCodeSimulator::drain() {
+    int32_t steps[2];
+    while (!planner.isEmpty()) {
+        planner.advance(GCODE_SIM_TICK_S, steps);
+        result.seconds += GCODE_SIM_TICK_S;
+    }
+}
+
+void GCodeSimulator::endOperation() {
+    drain();
+    if (operationOpen) {
+        result.operations[result.operationCount - 1].seconds += result.seconds - operationStart;
+        operationOpen = false;
+    }
+}
+
+void GCodeSimulator::track(const int32_t target[2], uint32_t line) {
+    bool outside = false;
+    for (int axis = 0; axis < 2; axis++) {
+        if (target[axis] < result.minSteps[axis]) result.minSteps[axis] = target[axis];
+        if (target[axis] > result.maxSteps[axis]) result.maxSteps[axis] = target[axis];
+        outside = outside || target[axis] < setup.minSteps[axis] || target[axis] > setup.maxSteps[axis];
+    }
+    if (outside) {
+        if (result.limitViolations == 0) {
+            result.firstViolationLine = line;
+        }
+        result.limitViolations++;
+    }
+}
+
+void GCodeSimulator::account(const int32_t target[2], bool rapid) {
+    float dx = (target[0] - lastTarget[0]) * setup.limits.duPerStep[0];
+    float dz = (target[1] - lastTarget[1]) * setup.limits.duPerStep[1];
+    double length = sqrt((double)dx * dx + (double)dz * dz);
+    lastTarget[0] = target[0];
+    lastTarget[1] = target[1];
+    if (rapid) {
+        result.rapidDu += length;
+        return;
+    }
+    result.feedDu += length;
+    if (length > 0) {
+        result.feedWeighted += length * feedDuPerSec;
+        if (feedDuPerSec < result.feedMin) result.feedMin = feedDuPerSec;
+        if (feedDuPerSec > result.feedMax) result.feedMax = feedDuPerSec;
+    }
+}
+
+void GCodeSimulator::queue(const int32_t target[2], bool rapid, uint32_t line) {
+    track(target, line);
+    account(target, rapid);
+    runUntilRoom();
+    planner.addLine(target, rapid ? 0 : (float)feedDuPerSec);
+}
+
+void GCodeSimulator::cutArc(const GCodeRecord& record, const int32_t end[2]) {
+    // Same chords as GCodeInterpreter::queueArcChord()
+    int32_t origin[2] = {lastTarget[0], lastTarget[1]};
+    int32_t endDu[2];
+    for (int axis = 0; axis < 2; axis++) {
+        endDu[axis] = GCodeCompiler::stepsToDu(setup.scale, axis, end[axis] - origin[axis]);
+    }
+    if (!arc.begin(arcCenter, endDu, record.type == GCODE_REC_ARC_CW)) {
+        queue(end, false, record.line);
+        return;
+    }
+
+    GCodeAxisScale substeps = setup.scale;
+    for (int axis = 0; axis < 2; axis++) {
+        substeps.motorSteps[axis] *= 1 << GCODE_SUBSTEP_BITS;
+    }
+    int32_t pointDu[2];
+    while (arc.next(pointDu)) {
+        if (arc.isDone()) {
+            queue(end, false, record.line);
+            return;
+        }
+        int32_t target[2];
+        int32_t rounded[2];
+        for (int axis = 0; axis < 2; axis++) {
+            target[axis] = origin[axis] * (1 << GCODE_SUBSTEP_BITS) +
+                           GCodeCompiler::duToSteps(substeps, axis, pointDu[axis]);
+            rounded[axis] = origin[axis] + GCodeCompiler::duToSteps(setup.scale, axis, pointDu[axis]);
+        }
+        track(rounded, record.line);
+        account(rounded, false);
+        runUntilRoom();
+        planner.addLineSubsteps(target, (float)feedDuPerSec);
+    }
+}
+
+bool GCodeSimulator::put(const GCodeRecord& record) {
+    if (!operationOpen) {
+        if (result.operationCount < GCODE_SIM_OPERATIONS) {
+            GCodeSimOperation& op = result.operations[result.operationCount++];
+            op.firstLine = record.line;
+            op.seconds = 0;
+        }
+        operationStart = result.seconds;
+        operationOpen = true;
+    }
+    result.operations[result.operationCount - 1].lastLine = record.line;
+    result.records++;
+
+    int32_t target[2] = {record.a, record.b};
+    if (record.flags & GCODE_REC_X_FROM_START) target[0] += setup.startSteps[0];
+    if (record.flags & GCODE_REC_Z_FROM_START) target[1] += setup.startSteps[1];
+
+    switch (record.type) {
+        case GCODE_REC_FEED:
+            feedDuPerSec = record.a;
+            break;
+
+        case GCODE_REC_RAPID:
+        case GCODE_REC_LINE:
+            queue(target, record.type == GCODE_REC_RAPID, record.line);
+            break;
+
+        case GCODE_REC_ARC_CENTER:
+            arcCenter[0] = record.a;
+            arcCenter[1] = record.b;
+            break;
+
+        case GCODE_REC_ARC_CW:
+        case GCODE_REC_ARC_CCW:
+            cutArc(record, target);
+            break;
+
+        case GCODE_REC_THREAD:
+            syncLead = record.a;
+            break;
+
+        case GCODE_REC_SYNC: {
+            // Axes stop, wait half a turn on average for the start angle,
+            // then travel one lead per turn along the longer axis
+            if (syncLead <= 0) {
+                return false;
+            }
+            drain();
+            double length[2];
+            for (int axis = 0; axis < 2; axis++) {
+                length[axis] = fabs((double)(target[axis] - lastTarget[axis]) * setup.limits.duPerStep[axis]);
+            }
+            double major = length[0] > length[1] ? length[0] : length[1];
+            int32_t rpm = setup.spindleRpm > 0 ? setup.spindleRpm : GCODE_SIM_RPM_DEFAULT;
+            result.seconds += (float)((major / syncLead + 0.5) * 60.0 / rpm);
+            result.syncDu += sqrt(length[0] * length[0] + length[1] * length[1]);
+            track(target, record.line);
+            lastTarget[0] = target[0];
+            lastTarget[1] = target[1];
+            planner.reset(target, setup.limits);
+            break;
+        }
+
+        case GCODE_REC_PAUSE:
+            endOperation();
+            break;
+
+        case GCODE_REC_END:
+            endOperation();
+            result.ended = true;
+            break;
+
+        default:
+            return false;
+    }
+    return true;
+}
+
+const GCodeSimResult& GCodeSimulator::finish() {
+    endOperation();
+    return result;
+}
+
+// snprintf that keeps appending at pos and never runs past len
+static void append(char* text, size_t len, size_t& pos, const char* format, ...) {
+    if (pos >= len) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(text + pos, len - pos, format, args);
+    va_end(args);
+    if (n > 0) {
+        pos = pos + n < len ? pos + n : len - 1;
+    }
+}
+
+size_t GCodeSimulator::format(const GCodeSimResult& result, const GCodeAxisScale& scale, char* text, size_t len) {
+    size_t pos = 0;
+    if (len == 0) {
+        return 0;
+    }
+    text[0] = '\0';
+    append(text, len, pos, "time %.1f s\n", result.seconds);
+    for (int i = 0; i < result.operationCount; i++) {
+        const GCodeSimOperation& op = result.operations[i];
+        append(text, len, pos, "op %d L%lu-L%lu %.1f s\n", i + 1, (unsigned long)op.firstLine,
+               (unsigned long)op.lastLine, op.seconds);
+    }
+    append(text, len, pos, "travel rapid %.1f mm, feed %.1f mm", result.rapidDu / 10000.0, result.feedDu / 10000.0);
+    if (result.syncDu > 0) {
+        append(text, len, pos, ", threading %.1f mm", result.syncDu / 10000.0);
+    }
+    append(text, len, pos, "\n");
+
+    const char letters[2] = {'X', 'Z'};
+    for (int axis = 0; axis < 2; axis++) {
+        if (result.minSteps[axis] > result.maxSteps[axis]) {
+            append(text, len, pos, "%c no moves\n", letters[axis]);
+            continue;
+        }
+        append(text, len, pos, "%c %.3f..%.3f mm\n", letters[axis],
+               GCodeCompiler::stepsToDu(scale, axis, result.minSteps[axis]) / 10000.0,
+               GCodeCompiler::stepsToDu(scale, axis, result.maxSteps[axis]) / 10000.0);
+    }
+
+    if (result.feedMax > 0) {
+        // du/s -> mm/min is x60/10000
+        append(text, len, pos, "feed %.0f..%.0f mm/min, avg %.0f\n", result.feedMin * 0.006,
+               result.feedMax * 0.006, result.feedWeighted / result.feedDu * 0.006);
+    }
+    if (result.limitViolations > 0) {
+        append(text, len, pos, "limits %lu points outside, first L%lu\n",
+               (unsigned long)result.limitViolations, (unsigned long)result.firstViolationLine);
+    } else {
+        append(text, len, pos, "limits ok\n");
+    }
+    append(text, len, pos, "%lu records%s\n", (unsigned long)result.records, result.ended ? "" : ", no M2/M30");
+    return pos;
+}
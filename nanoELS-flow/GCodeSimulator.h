@@ -0,0 +1,107 @@
+#ifndef GCODESIMULATOR_H
+#define GCODESIMULATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "GCodeCompiler.h"
+#include "GCodePlanner.h"
+#include "GCodeArc.h"
+
+/**
+ * GCodeSimulator - Dry run of compiled G-code against a virtual clock
+ *
+ * Takes the same records GCodeInterpreter executes (it is a record sink,
+ * so the compiler or a binary reader can feed it directly) and runs them
+ * through GCodePlanner and GCodeArc exactly as the controller would, but
+ * advances the planner by a fixed virtual tick instead of waiting for
+ * real time and never touches the axes. A program of several minutes
+ * simulates in a few ten thousand planner ticks.
+ *
+ * Reports the estimated cycle time in total and per operation (program
+ * sections separated by M0/M1), rapid and feed travel, X/Z extents of
+ * every commanded point, moves outside the soft limits and the range of
+ * feeds used. Synchronised moves (G33, G76 passes) take the time the
+ * spindle needs at the given RPM plus half a turn to find the start angle.
+ *
+ * Features:
+ * - No heap, no Arduino dependencies (also built on the host by
+ *   tools/gcode_sim.cpp)
+ * - Relative-to-start records resolved against a given start position
+ * - Plain text report shared by the web UI, the serial console and the
+ *   host tool
+ */
+
+#define GCODE_SIM_TICK_S 0.005f           // Virtual planner tick
+#define GCODE_SIM_OPERATIONS 8            // Operations reported separately, the rest add to the last
+#define GCODE_SIM_RPM_DEFAULT 300         // Spindle speed for synchronised moves when stopped
+
+struct GCodeSimSetup {
+    GCodeAxisScale scale;
+    PlannerLimits limits;
+    int32_t startSteps[2];   // Axis positions the program starts from
+    int32_t minSteps[2];     // Soft limits, steps
+    int32_t maxSteps[2];
+    int32_t spindleRpm;      // For synchronised moves, 0 = default
+};
+
+struct GCodeSimOperation {
+    uint32_t firstLine;
+    uint32_t lastLine;
+    float seconds;
+};
+
+struct GCodeSimResult {
+    double seconds;          // Virtual clock
+    double rapidDu;          // Travel
+    double feedDu;
+    double syncDu;           // G33/G76, not part of the feed statistics
+    double feedWeighted;     // Sum of feed x distance, for the average
+    int32_t minSteps[2];     // Extents of commanded points
+    int32_t maxSteps[2];
+    int32_t feedMin;         // du/s over feed moves
+    int32_t feedMax;
+    uint32_t records;
+    uint32_t limitViolations;
+    uint32_t firstViolationLine;
+    uint8_t operationCount;
+    GCodeSimOperation operations[GCODE_SIM_OPERATIONS];
+    bool ended;              // Program reached M2/M30
+};
+
+class GCodeSimulator : public GCodeRecordSink {
+private:
+    GCodeSimSetup setup;
+    GCodeSimResult result;
+    GCodePlanner planner;
+    GCodeArc arc;
+    int32_t lastTarget[2];   // Steps
+    int32_t arcCenter[2];    // du from the arc start
+    int32_t feedDuPerSec;
+    int32_t syncLead;        // du/rev
+    double operationStart;   // Clock at the start of the current operation
+    bool operationOpen;
+
+    void track(const int32_t target[2], uint32_t line);
+    void account(const int32_t target[2], bool rapid);
+    void queue(const int32_t target[2], bool rapid, uint32_t line);
+    void cutArc(const GCodeRecord& record, const int32_t end[2]);
+    void runUntilRoom();
+    void drain();
+    void endOperation();
+
+public:
+    GCodeSimulator();
+
+    void begin(const GCodeSimSetup& simSetup);
+
+    // Execute one record in virtual time; false for a record it cannot run
+    bool put(const GCodeRecord& record) override;
+
+    // Let queued motion finish and return the totals
+    const GCodeSimResult& finish();
+
+    // Human readable report, one item per line; returns the length written
+    static size_t format(const GCodeSimResult& result, const GCodeAxisScale& scale, char* text, size_t len);
+};
+
+#endif // GCODESIMULATOR_H
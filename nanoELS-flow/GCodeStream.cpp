@@ -0,0 +1,124 @@
+#include "GCodeStream.h"
+
+// Global instance
+GCodeStream gcodeStream;
+
+GCodeStream::GCodeStream()
+    : owner(GCODE_STREAM_NO_OWNER), linesQueued(0), linesInStream(0),
+      lineLen(0), lineTooLong(false), active(false), linesConsumed(0),
+      underruns(0), starved(false), firstLineUs(0), lastLineUs(0),
+      rateLines(0), sustainedMilliLps(0) {
+    line[0] = '\0';
+}
+
+bool GCodeStream::claim(uint8_t client) {
+    if (owner != GCODE_STREAM_NO_OWNER && owner != client) {
+        return false;
+    }
+    owner = client;
+    return true;
+}
+
+void GCodeStream::release(uint8_t client) {
+    if (owner != client) {
+        return;
+    }
+    // Whatever is buffered still runs; the end marker stops underrun counting
+    if (linesInStream > 0) {
+        pushLine("%", 1);
+    }
+    owner = GCODE_STREAM_NO_OWNER;
+}
+
+bool GCodeStream::pushLine(const char* text, size_t len) {
+    if (len + 1 > buffer.available()) {
+        return false;
+    }
+
+    bool endMarker = (len == 1 && text[0] == '%');
+    if (endMarker && linesInStream == 0) {
+        return true;  // Leading tape marker, nothing to end yet
+    }
+
+    // Only this task produces, so the space checked above is still there
+    buffer.pushN(text, len);
+    buffer.push('\n');
+
+    if (endMarker) {
+        linesInStream = 0;
+    } else {
+        linesInStream++;
+        linesQueued++;
+    }
+    return true;
+}
+
+const char* GCodeStream::nextLine(size_t& len) {
+    char c;
+    while (buffer.pop(c)) {
+        if (c == '\r') {
+            continue;
+        }
+        if (c != '\n') {
+            if (lineLen < GCODE_STREAM_LINE_MAX) {
+                line[lineLen++] = c;
+            } else {
+                lineTooLong = true;
+            }
+            continue;
+        }
+
+        // Whole line in
+        line[lineLen] = '\0';
+        len = lineLen;
+        lineLen = 0;
+        if (len == 0) {
+            continue;
+        }
+
+        if (len == 1 && line[0] == '%') {
+            active = false;
+            rateLines = 0;
+            continue;
+        }
+
+        if (lineTooLong) {
+            lineTooLong = false;
+            Serial.printf("GCodeStream: line longer than %d chars truncated\n", GCODE_STREAM_LINE_MAX);
+        }
+
+        uint32_t now = micros();
+        if (!active) {
+            active = true;
+            rateLines = 0;
+        }
+        if (rateLines == 0) {
+            firstLineUs = now;
+        }
+        rateLines++;
+        lastLineUs = now;
+        if (rateLines > 1 && lastLineUs != firstLineUs) {
+            sustainedMilliLps = (uint32_t)((uint64_t)(rateLines - 1) * 1000000000ULL / (lastLineUs - firstLineUs));
+        }
+
+        starved = false;
+        linesConsumed = linesConsumed + 1;
+        return line;
+    }
+
+    // Ran dry while the sender still has more to give
+    if (active && !starved) {
+        starved = true;
+        underruns = underruns + 1;
+    }
+    len = 0;
+    return nullptr;
+}
+
+void GCodeStream::abort() {
+    buffer.clear();
+    lineLen = 0;
+    lineTooLong = false;
+    active = false;
+    rateLines = 0;
+}
@@ -0,0 +1,75 @@
+#ifndef GCODESTREAM_H
+#define GCODESTREAM_H
+
+#include <Arduino.h>
+#include "CircularBuffer.h"
+
+/**
+ * GCodeStream - G-code lines streamed over the WebSocket
+ *
+ * The web task appends whole lines, the controller takes them one at a
+ * time in G-code mode. The sender is granted credits equal to the free
+ * buffer space in bytes and may never send more than it holds, so the
+ * buffer cannot overrun and stays as full as the link allows.
+ *
+ * Features:
+ * - Lock-free SPSC byte ring, lines reassembled on the consumer side
+ * - One streaming client at a time
+ * - A "%" line after the first program line ends the stream (RS274 tape marker)
+ * - Sustained lines/s and underruns (buffer ran dry mid-stream)
+ */
+
+#define GCODE_STREAM_BUFFER_BYTES 4096   // Credits granted when empty (power of 2)
+#define GCODE_STREAM_LINE_MAX 96         // Longest line handed to the consumer
+#define GCODE_STREAM_CREDIT_STEP 512     // Re-advertise credits after this much drained
+#define GCODE_STREAM_NO_OWNER 0xFF
+
+class GCodeStream {
+private:
+    CircularBuffer<char, GCODE_STREAM_BUFFER_BYTES> buffer;
+
+    // Producer (web task) state
+    volatile uint8_t owner;          // WebSocket client that streams
+    uint32_t linesQueued;
+    uint32_t linesInStream;          // Since the last end marker
+
+    // Consumer (controller) state
+    char line[GCODE_STREAM_LINE_MAX + 1];
+    size_t lineLen;                  // Partial line carried between calls
+    bool lineTooLong;
+    volatile bool active;            // Between first line and end marker
+    volatile uint32_t linesConsumed;
+    volatile uint32_t underruns;
+    bool starved;                    // Already counted the current underrun
+    uint32_t firstLineUs;            // Sustained rate window
+    uint32_t lastLineUs;
+    uint32_t rateLines;
+    volatile uint32_t sustainedMilliLps;
+
+public:
+    GCodeStream();
+
+    // Producer interface - web task only
+    bool claim(uint8_t client);               // false if another client streams
+    void release(uint8_t client);             // Owner went away
+    uint8_t getOwner() const { return owner; }
+    size_t credits() const { return buffer.available(); }
+    bool pushLine(const char* line, size_t len);
+
+    // Consumer interface - controller only
+    const char* nextLine(size_t& len);        // nullptr until a whole line is in
+    void abort();                             // Drop buffered lines, end the stream
+
+    // Statistics
+    bool isActive() const { return active; }
+    size_t buffered() const { return buffer.size(); }
+    uint32_t getLinesQueued() const { return linesQueued; }
+    uint32_t getLinesConsumed() const { return linesConsumed; }
+    uint32_t getUnderruns() const { return underruns; }
+    float getLinesPerSecond() const { return sustainedMilliLps / 1000.0f; }
+};
+
+// Global stream buffer
+extern GCodeStream gcodeStream;
+
+#endif // GCODESTREAM_H
@@ -0,0 +1,126 @@
+#include "InputEvents.h"
+#include "SetupConstants.h"
+
+// Global instance
+InputEventQueue inputEvents;
+
+InputEventQueue::InputEventQueue() : nextSequence(0) {
+    for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+        dropped[i] = 0;
+    }
+    resetStats();
+}
+
+bool InputEventQueue::isPriorityKey(uint16_t keyCode) {
+    // Emergency stop / operation stop must never wait behind queued keys
+    return keyCode == B_OFF;
+}
+
+const char* InputEventQueue::getSourceName(InputSource source) {
+    switch (source) {
+        case INPUT_SOURCE_KEYBOARD: return "Keyboard";
+        case INPUT_SOURCE_WEB: return "Web";
+        case INPUT_SOURCE_NEXTION: return "Nextion";
+        default: return "Unknown";
+    }
+}
+
+bool InputEventQueue::post(InputSource source, uint16_t keyCode, bool isPress) {
+    if (source >= INPUT_SOURCE_COUNT) {
+        return false;
+    }
+
+    InputEvent event;
+    event.sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+    event.timestampUs = micros();
+    event.keyCode = keyCode;
+    event.isPress = isPress;
+    event.source = source;
+
+    bool queued = isPriorityKey(keyCode) ? priorityLanes[source].push(event)
+                                         : lanes[source].push(event);
+    if (!queued) {
+        dropped[source] = dropped[source] + 1;
+    }
+    return queued;
+}
+
+size_t InputEventQueue::available(InputSource source, uint16_t keyCode) const {
+    if (source >= INPUT_SOURCE_COUNT) {
+        return 0;
+    }
+    return isPriorityKey(keyCode) ? priorityLanes[source].available()
+                                  : lanes[source].available();
+}
+
+template<size_t N>
+int InputEventQueue::oldestLane(CircularBuffer<InputEvent, N>* laneSet) {
+    int best = -1;
+    uint32_t bestSequence = 0;
+
+    for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+        InputEvent candidate;
+        if (!laneSet[i].front(candidate)) continue;
+
+        // Wrap-safe sequence comparison
+        if (best < 0 || (int32_t)(candidate.sequence - bestSequence) < 0) {
+            best = i;
+            bestSequence = candidate.sequence;
+        }
+    }
+    return best;
+}
+
+bool InputEventQueue::next(InputEvent& event) {
+    int lane = oldestLane(priorityLanes);
+    if (lane >= 0) {
+        return priorityLanes[lane].pop(event);
+    }
+
+    lane = oldestLane(lanes);
+    if (lane >= 0) {
+        return lanes[lane].pop(event);
+    }
+    return false;
+}
+
+void InputEventQueue::markHandled(const InputEvent& event) {
+    if (event.source >= INPUT_SOURCE_COUNT) return;
+
+    uint32_t latency = micros() - event.timestampUs;
+    InputLatencyStats& s = stats[event.source];
+    s.count++;
+    s.lastUs = latency;
+    s.totalUs += latency;
+    if (latency > s.maxUs) {
+        s.maxUs = latency;
+    }
+}
+
+size_t InputEventQueue::pending() const {
+    size_t total = 0;
+    for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+        total += lanes[i].size() + priorityLanes[i].size();
+    }
+    return total;
+}
+
+void InputEventQueue::resetStats() {
+    for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+        stats[i] = {0, 0, 0, 0};
+    }
+}
+
+void InputEventQueue::printDiagnostics() {
+    Serial.println("Input latency (key -> motion):");
+    for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+        const InputLatencyStats& s = stats[i];
+        Serial.printf("  %s: %u events, last %u μs, avg %u μs, max %u μs, dropped %u\n",
+                     getSourceName((InputSource)i),
+                     s.count,
+                     s.lastUs,
+                     s.count > 0 ? (uint32_t)(s.totalUs / s.count) : 0,
+                     s.maxUs,
+                     dropped[i]);
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef INPUTEVENTS_H
+#define INPUTEVENTS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "CircularBuffer.h"
+
+/**
+ * InputEventQueue - Unified, timestamped key event queue
+ *
+ * Every input path (PS2 keyboard, WebSocket key injection, Nextion touch)
+ * posts key events here instead of calling the key handler directly.
+ * A single consumer drains the queue from the scheduler.
+ *
+ * Features:
+ * - One lock-free SPSC lane per source, so producers never share a write index
+ * - Global sequence number restores arrival order across lanes
+ * - Emergency stop keys use a separate priority lane that is always drained first
+ * - Key-to-motion latency tracked per source (post -> handler finished)
+ */
+
+// Event producers
+enum InputSource : uint8_t {
+    INPUT_SOURCE_KEYBOARD = 0,  // PS2 keyboard scan task
+    INPUT_SOURCE_WEB = 1,       // WebSocket "=" key injection
+    INPUT_SOURCE_NEXTION = 2,   // Nextion touch events (Serial1 RX)
+    INPUT_SOURCE_COUNT
+};
+
+// Single key event
+struct InputEvent {
+    uint32_t sequence;      // Global arrival order
+    uint32_t timestampUs;   // micros() when posted
+    uint16_t keyCode;       // B_* key code from SetupConstants.h
+    bool isPress;           // false = key release
+    InputSource source;
+};
+
+// Per-source latency statistics (microseconds)
+struct InputLatencyStats {
+    uint32_t count;         // Events handled
+    uint32_t lastUs;        // Latency of most recent event
+    uint32_t maxUs;         // Worst case since reset
+    uint64_t totalUs;       // Sum for average
+};
+
+class InputEventQueue {
+private:
+    static const size_t LANE_SIZE = 32;
+    static const size_t PRIORITY_LANE_SIZE = 8;
+
+    // Normal and priority lanes, indexed by InputSource
+    CircularBuffer<InputEvent, LANE_SIZE> lanes[INPUT_SOURCE_COUNT];
+    CircularBuffer<InputEvent, PRIORITY_LANE_SIZE> priorityLanes[INPUT_SOURCE_COUNT];
+
+    std::atomic<uint32_t> nextSequence;
+
+    // Producer-owned overflow counters (one writer per source)
+    volatile uint32_t dropped[INPUT_SOURCE_COUNT];
+
+    // Consumer-owned statistics
+    InputLatencyStats stats[INPUT_SOURCE_COUNT];
+
+    // Pick the lane whose front event arrived first
+    template<size_t N>
+    static int oldestLane(CircularBuffer<InputEvent, N>* laneSet);
+
+public:
+    InputEventQueue();
+
+    // Producer interface - call from exactly one context per source
+    bool post(InputSource source, uint16_t keyCode, bool isPress);
+    size_t available(InputSource source, uint16_t keyCode) const; // Free slots in the lane keyCode uses
+
+    // Consumer interface
+    bool next(InputEvent& event);              // Priority events first, then arrival order
+    void markHandled(const InputEvent& event); // Record key-to-motion latency
+    size_t pending() const;
+
+    // Classification
+    static bool isPriorityKey(uint16_t keyCode);
+    static const char* getSourceName(InputSource source);
+
+    // Diagnostics
+    const InputLatencyStats& getLatencyStats(InputSource source) const { return stats[source]; }
+    uint32_t getDropped(InputSource source) const { return dropped[source]; }
+    void resetStats();
+    void printDiagnostics();
+};
+
+// Global input event queue
+extern InputEventQueue inputEvents;
+
+#endif // INPUTEVENTS_H
@@ -0,0 +1,339 @@
+#include "JobQueue.h"
+#include "MinimalMotionControl.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern OperationManager operationManager;
+
+#define JOB_SAVE_TEMP "/job-save.tmp"
+
+// Global instance
+JobQueue jobQueue;
+
+JobQueue::JobQueue()
+    : operationCount(0), state(JOB_IDLE), armed(false), operation(0), completedAtStart(0),
+      parts(0), partStartMs(0), lastPartMs(0), totalPartMs(0), message("") {
+    name[0] = '\0';
+}
+
+bool JobQueue::report(bool ok, const char* okText, const char* failText) {
+    message = ok ? okText : failText;
+    return ok;
+}
+
+bool JobQueue::addCurrentSetup() {
+    if (state == JOB_RUNNING) {
+        return report(false, "", "part running");
+    }
+    if (operationCount >= JOB_OPERATIONS_MAX) {
+        return report(false, "", "job full");
+    }
+    if (!operationManager.captureSetup(operations[operationCount])) {
+        return report(false, "", "operation not set up");
+    }
+    operationCount++;
+    return report(true, "operation added", "");
+}
+
+void JobQueue::clear() {
+    if (state == JOB_RUNNING) {
+        stop();
+    }
+    operationCount = 0;
+    name[0] = '\0';
+    state = JOB_IDLE;
+    armed = false;
+    parts = 0;
+    lastPartMs = 0;
+    totalPartMs = 0;
+    message = "cleared";
+}
+
+bool JobQueue::isValidName(const char* jobName) {
+    // Plain names only: they end up in paths, JSON and the display
+    size_t len = strlen(jobName);
+    if (len == 0 || len >= JOB_NAME_LEN) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char c = jobName[i];
+        if (!isalnum((unsigned char)c) && c != '-' && c != '_' && c != '.') {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t JobQueue::formatLine(const OperationSetup& setup, char* text, size_t len) {
+    int n = snprintf(text, len,
+                     "op mode=%d int=%d ltr=%d dupr=%ld starts=%d passes=%d cone=%.5f dia=%ld len=%ld "
+                     "depth=%ld cut=%ld tox=%ld toz=%ld tdx=%.4f tdz=%.4f park=%d px=%ld pz=%ld\n",
+                     (int)setup.mode, setup.internal ? 1 : 0, setup.leftToRight ? 1 : 0, setup.dupr,
+                     setup.starts, setup.passes, setup.coneRatio, setup.targetDiameter, setup.targetZLength,
+                     setup.cutDepth, setup.cutLength, setup.touchOffX, setup.touchOffZ,
+                     setup.touchOffXCoord, setup.touchOffZCoord, setup.parkingSet ? 1 : 0,
+                     setup.parkingX, setup.parkingZ);
+    return (n > 0 && (size_t)n < len) ? n : 0;
+}
+
+bool JobQueue::parseLine(char* line, OperationSetup& setup) {
+    char* save = nullptr;
+    char* token = strtok_r(line, " \t", &save);
+    if (!token || strcmp(token, "op") != 0) {
+        return false;
+    }
+
+    memset(&setup, 0, sizeof(setup));
+    setup.starts = 1;
+    setup.passes = 1;
+    bool haveMode = false;
+    while ((token = strtok_r(nullptr, " \t", &save)) != nullptr) {
+        char* value = strchr(token, '=');
+        if (!value) {
+            return false;
+        }
+        *value++ = '\0';
+        char* end;
+        long number = strtol(value, &end, 10);
+        bool integer = end != value && *end == '\0';
+
+        if (strcmp(token, "tdx") == 0 || strcmp(token, "tdz") == 0 || strcmp(token, "cone") == 0) {
+            float real = strtof(value, &end);
+            if (end == value || *end != '\0') return false;
+            if (token[0] == 'c') setup.coneRatio = real;
+            else if (token[2] == 'x') setup.touchOffXCoord = real;
+            else setup.touchOffZCoord = real;
+            continue;
+        }
+        if (!integer) {
+            return false;
+        }
+        if (strcmp(token, "mode") == 0) { setup.mode = (OperationMode)number; haveMode = true; }
+        else if (strcmp(token, "int") == 0) setup.internal = number != 0;
+        else if (strcmp(token, "ltr") == 0) setup.leftToRight = number != 0;
+        else if (strcmp(token, "dupr") == 0) setup.dupr = number;
+        else if (strcmp(token, "starts") == 0) setup.starts = number;
+        else if (strcmp(token, "passes") == 0) setup.passes = number;
+        else if (strcmp(token, "dia") == 0) setup.targetDiameter = number;
+        else if (strcmp(token, "len") == 0) setup.targetZLength = number;
+        else if (strcmp(token, "depth") == 0) setup.cutDepth = number;
+        else if (strcmp(token, "cut") == 0) setup.cutLength = number;
+        else if (strcmp(token, "tox") == 0) setup.touchOffX = number;
+        else if (strcmp(token, "toz") == 0) setup.touchOffZ = number;
+        else if (strcmp(token, "park") == 0) setup.parkingSet = number != 0;
+        else if (strcmp(token, "px") == 0) setup.parkingX = number;
+        else if (strcmp(token, "pz") == 0) setup.parkingZ = number;
+        // Unknown keys are skipped so newer files still load
+    }
+    return haveMode && OperationManager::isJobMode(setup.mode) && setup.passes >= 1 && setup.starts >= 1;
+}
+
+const char* JobQueue::resultText(JobFileResult result) {
+    switch (result) {
+        case JOB_FILE_OK: return "";
+        case JOB_FILE_BAD_NAME: return "bad name";
+        case JOB_FILE_EMPTY: return "job empty";
+        case JOB_FILE_MISSING: return "no such job";
+        case JOB_FILE_BAD: return "bad job file";
+        default: return "save failed";
+    }
+}
+
+JobFileResult JobQueue::writeFile(fs::FS& fs, const char* jobName, const JobTable& table) {
+    if (!isValidName(jobName)) {
+        return JOB_FILE_BAD_NAME;
+    }
+    if (table.count == 0) {
+        return JOB_FILE_EMPTY;
+    }
+    File file = fs.open(JOB_SAVE_TEMP, "w");
+    if (!file) {
+        return JOB_FILE_WRITE_FAILED;
+    }
+    char line[JOB_LINE_MAX];
+    bool ok = file.printf("# nanoELS job %s, %d operations\n", jobName, table.count) > 0;
+    for (int i = 0; ok && i < table.count; i++) {
+        size_t len = formatLine(table.operations[i], line, sizeof(line));
+        ok = len > 0 && file.write((const uint8_t*)line, len) == len;
+    }
+    file.close();
+
+    char path[JOB_NAME_LEN + 6];
+    snprintf(path, sizeof(path), "/%s.job", jobName);
+    if (ok) {
+        fs.remove(path);
+        ok = fs.rename(JOB_SAVE_TEMP, path);
+    }
+    if (!ok) {
+        fs.remove(JOB_SAVE_TEMP);
+        return JOB_FILE_WRITE_FAILED;
+    }
+    return JOB_FILE_OK;
+}
+
+JobFileResult JobQueue::readFile(fs::FS& fs, const char* jobName, JobTable& table) {
+    if (!isValidName(jobName)) {
+        return JOB_FILE_BAD_NAME;
+    }
+    char path[JOB_NAME_LEN + 6];
+    snprintf(path, sizeof(path), "/%s.job", jobName);
+    File file = fs.open(path, "r");
+    if (!file) {
+        return JOB_FILE_MISSING;
+    }
+    if (file.size() > JOB_FILE_MAX) {
+        return JOB_FILE_BAD;
+    }
+
+    uint8_t count = 0;
+    char line[JOB_LINE_MAX];
+    bool ok = true;
+    while (ok && file.available()) {
+        size_t len = file.readBytesUntil('\n', line, sizeof(line) - 1);
+        line[len] = '\0';
+        char* start = line + strspn(line, " \t\r");
+        char* end = start + strlen(start);
+        while (end > start && (end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+        if (*start == '\0' || *start == '#') {
+            continue;
+        }
+        ok = count < JOB_OPERATIONS_MAX && len < sizeof(line) - 1 && parseLine(start, table.operations[count]);
+        count++;
+    }
+    file.close();
+    if (!ok || count == 0) {
+        return JOB_FILE_BAD;
+    }
+    strcpy(table.name, jobName);
+    table.count = count;
+    return JOB_FILE_OK;
+}
+
+void JobQueue::getTable(JobTable& table) const {
+    strcpy(table.name, name);
+    table.count = operationCount;
+    memcpy(table.operations, operations, operationCount * sizeof(OperationSetup));
+}
+
+bool JobQueue::finishSave(const char* jobName, JobFileResult result) {
+    if (result != JOB_FILE_OK) {
+        return report(false, "", resultText(result));
+    }
+    strcpy(name, jobName);
+    return report(true, "saved", "");
+}
+
+bool JobQueue::finishLoad(const JobTable* loaded, JobFileResult result) {
+    // A bad file or a part in progress leaves the current job alone
+    if (state == JOB_RUNNING) {
+        return report(false, "", "part running");
+    }
+    if (result != JOB_FILE_OK || !loaded) {
+        return report(false, "", resultText(result != JOB_FILE_OK ? result : JOB_FILE_BAD));
+    }
+    memcpy(operations, loaded->operations, loaded->count * sizeof(OperationSetup));
+    operationCount = loaded->count;
+    strcpy(name, loaded->name);
+    state = JOB_IDLE;
+    armed = true;
+    parts = 0;
+    lastPartMs = 0;
+    totalPartMs = 0;
+    return report(true, "loaded", "");
+}
+
+bool JobQueue::startOperation() {
+    if (motionControl.getEmergencyStop() ||
+        !operationManager.applySetup(operations[operation]) ||
+        !operationManager.startOperation()) {
+        abortPart();
+        return report(false, "", "operation failed to start");
+    }
+    completedAtStart = operationManager.getCompletedCount();
+    return report(true, "running", "");
+}
+
+void JobQueue::abortPart() {
+    state = JOB_ABORTED;
+    operation = 0;
+}
+
+bool JobQueue::runPart() {
+    if (state == JOB_RUNNING || operationCount == 0 || operationManager.isRunning()) {
+        return report(false, "", operationCount == 0 ? "job empty" : "busy");
+    }
+    armed = true;
+    operation = 0;
+    partStartMs = millis();
+    state = JOB_RUNNING;
+    return startOperation();
+}
+
+void JobQueue::stop() {
+    if (state == JOB_RUNNING) {
+        if (operationManager.isRunning()) {
+            operationManager.stopOperation();
+        }
+        abortPart();
+    }
+    armed = false;
+    message = "stopped";
+}
+
+void JobQueue::update() {
+    if (state != JOB_RUNNING || operationManager.isRunning()) {
+        return;
+    }
+
+    // Stopped by hand or E-stop: the part is not finished
+    if (operationManager.getCompletedCount() == completedAtStart) {
+        abortPart();
+        message = "part stopped";
+        return;
+    }
+
+    if (++operation < operationCount) {
+        startOperation();
+        return;
+    }
+
+    lastPartMs = millis() - partStartMs;
+    totalPartMs += lastPartMs;
+    parts++;
+    operation = 0;
+    state = JOB_IDLE;
+    message = "part done";
+}
+
+void JobQueue::getStatus(JobStatus& status) const {
+    strcpy(status.name, name);
+    status.operationCount = operationCount;
+    status.operation = state == JOB_RUNNING ? operation : -1;
+    status.state = state;
+    status.armed = armed;
+    status.parts = parts;
+    status.partMs = state == JOB_RUNNING ? millis() - partStartMs : lastPartMs;
+    status.avgPartMs = parts > 0 ? (uint32_t)(totalPartMs / parts) : 0;
+    status.message = message;
+}
+
+size_t JobQueue::formatStatus(char* text, size_t len) const {
+    // "Part 12 op 2/3 0:41" while running, "Part 12 done 1:23 ENTER" between parts
+    JobStatus status;
+    getStatus(status);
+    uint32_t seconds = status.partMs / 1000;
+    int n;
+    if (state == JOB_RUNNING) {
+        n = snprintf(text, len, "Part %lu op %d/%d %lu:%02lu", (unsigned long)(parts + 1),
+                     operation + 1, operationCount, (unsigned long)(seconds / 60), (unsigned long)(seconds % 60));
+    } else if (state == JOB_ABORTED) {
+        n = snprintf(text, len, "Part %lu stopped, ENTER restarts", (unsigned long)(parts + 1));
+    } else if (parts > 0) {
+        n = snprintf(text, len, "Part %lu done %lu:%02lu, ENTER next", (unsigned long)parts,
+                     (unsigned long)(seconds / 60), (unsigned long)(seconds % 60));
+    } else {
+        n = snprintf(text, len, "Job %s %d ops, ENTER starts", name[0] ? name : "(new)", operationCount);
+    }
+    return (n > 0 && (size_t)n < len) ? n : 0;
+}
@@ -0,0 +1,139 @@
+#ifndef JOBQUEUE_H
+#define JOBQUEUE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "GCodeIndex.h"
+#include "OperationManager.h"
+
+/**
+ * JobQueue - Batch production: a list of operations run once per part
+ *
+ * A job is built by setting up each operation by hand once (touch-off,
+ * targets, passes, pitch, parking) and adding it to the job, then saved
+ * to LittleFS as "/<name>.job". Running a part applies every operation's
+ * setup in turn and starts it as soon as the previous one completed, so
+ * the next part needs one key press (ENTER, or run from the web UI).
+ *
+ * Touch-off positions are stored as axis positions, so parts must be
+ * located the same way (stop, collet) and the axes must not be zeroed
+ * between parts. A part that is stopped or fails to start is not counted;
+ * the next run starts it again from the first operation.
+ *
+ * Job file, one operation per line ('#' starts a comment):
+ *   op mode=1 int=0 ltr=0 dupr=-1000 starts=1 passes=3 cone=0 dia=200000
+ *      len=300000 depth=2500 cut=12000 tox=1234 toz=-56 tdx=25.000
+ *      tdz=0.000 park=1 px=2000 pz=3000
+ * Lengths are deci-microns (dupr, dia, len) or steps (depth, cut, tox,
+ * toz, px, pz), touch-off coordinates mm.
+ *
+ * Job files are read and written by the web task only (readFile/writeFile
+ * on a JobTable): the controller hands its table over through WebBridge to
+ * save and gets a loaded table and the outcome back, so it never waits on
+ * flash.
+ *
+ * Features:
+ * - Controller task only apart from the static file functions; the web
+ *   task goes through WebBridge commands
+ * - Fixed-size operation table, no heap
+ * - Part counter and last/average cycle time per part
+ */
+
+#define JOB_OPERATIONS_MAX 8
+#define JOB_NAME_LEN GCODE_INDEX_NAME_LEN   // Name without "/" and ".job", incl. terminator
+#define JOB_LINE_MAX 256                    // Longest line in a job file
+#define JOB_FILE_MAX 2048                   // Largest job file accepted
+
+enum JobState : uint8_t {
+    JOB_IDLE,          // No part in progress
+    JOB_RUNNING,       // Operations of the current part in progress
+    JOB_ABORTED        // Last part stopped or failed to start; not counted
+};
+
+// Outcome of a job file operation, handed from the web task to the controller
+enum JobFileResult : uint8_t {
+    JOB_FILE_OK,
+    JOB_FILE_BAD_NAME,
+    JOB_FILE_EMPTY,        // Nothing to save
+    JOB_FILE_MISSING,
+    JOB_FILE_BAD,          // Unreadable, too large or a bad line
+    JOB_FILE_WRITE_FAILED
+};
+
+// The operations of a job, as saved and loaded
+struct JobTable {
+    char name[JOB_NAME_LEN];     // "" = not saved yet
+    uint8_t count;
+    OperationSetup operations[JOB_OPERATIONS_MAX];
+};
+
+// Job progress as shown on the display and the web UI
+struct JobStatus {
+    char name[JOB_NAME_LEN];     // "" = not saved yet
+    uint8_t operationCount;
+    int8_t operation;            // Running operation (0-based), -1 = none
+    JobState state;
+    bool armed;                  // ENTER starts the next part
+    uint32_t parts;              // Parts completed since the job was loaded
+    uint32_t partMs;             // Current part elapsed while running, else the last part
+    uint32_t avgPartMs;
+    const char* message;         // Outcome of the last job command (string literal)
+};
+
+class JobQueue {
+private:
+    OperationSetup operations[JOB_OPERATIONS_MAX];
+    uint8_t operationCount;
+    char name[JOB_NAME_LEN];
+
+    JobState state;
+    bool armed;
+    uint8_t operation;
+    uint32_t completedAtStart;   // OperationManager completion count when it started
+    uint32_t parts;
+    uint32_t partStartMs;
+    uint32_t lastPartMs;
+    uint64_t totalPartMs;
+    const char* message;
+
+    bool startOperation();
+    void abortPart();
+    bool report(bool ok, const char* okText, const char* failText);
+
+    static bool parseLine(char* line, OperationSetup& setup);
+    static size_t formatLine(const OperationSetup& setup, char* text, size_t len);
+
+public:
+    JobQueue();
+
+    // Building a job (refused while a part runs)
+    bool addCurrentSetup();              // Append the operation set up by hand
+    void clear();
+    uint8_t getOperationCount() const { return operationCount; }
+    const char* getName() const { return name; }
+
+    // Storage: file functions run in the web task, the results are applied here
+    static bool isValidName(const char* jobName);
+    static JobFileResult writeFile(fs::FS& fs, const char* jobName, const JobTable& table);
+    static JobFileResult readFile(fs::FS& fs, const char* jobName, JobTable& table);
+    static const char* resultText(JobFileResult result);
+    void getTable(JobTable& table) const;
+    bool finishSave(const char* jobName, JobFileResult result);
+    bool finishLoad(const JobTable* loaded, JobFileResult result);   // Resets the part counter
+
+    // Running
+    bool runPart();                      // Start the next part from the first operation
+    void stop();                         // Stop the part in progress and disarm
+    void disarm() { armed = false; }
+    bool isArmed() const { return armed; }
+    bool isRunning() const { return state == JOB_RUNNING; }
+    void update();                       // Call every controller tick after OperationManager
+
+    void getStatus(JobStatus& status) const;
+    size_t formatStatus(char* text, size_t len) const;   // One display line
+};
+
+// Global job queue
+extern JobQueue jobQueue;
+
+#endif // JOBQUEUE_H
@@ -9,6 +9,8 @@ MinimalMotionControl* MinimalMotionControl::instance = nullptr;
 MinimalMotionControl::MinimalMotionControl() {
     instance = this;
     emergencyStop = false;
+    mpgOverride = false;
+    speedScale = 1.0f;
     
     // Initialize spindle tracker
     spindle.position = 0;
@@ -17,6 +19,9 @@ MinimalMotionControl::MinimalMotionControl() {
     spindle.threadPitch = 0;
     spindle.threadStarts = 1;
     spindle.threadingActive = false;
+    spindle.rpm = 0;
+    spindle.rpmSamplePosition = 0;
+    spindle.rpmSampleTime = 0;
     
     // Initialize MPG trackers (h5.ino style)
     for (int i = 0; i < 2; i++) {
@@ -24,6 +29,7 @@ MinimalMotionControl::MinimalMotionControl() {
         mpg[i].fractionalPos = 0.0;     // h5.ino style fractional position
         mpg[i].pcntUnit = (i == AXIS_X) ? PCNT_UNIT_2 : PCNT_UNIT_1;
         mpg[i].stepSize = 10000;  // Default 1mm step size
+        mpg[i].overridePulses = 0;
         mpg[i].active = false;
     }
     
@@ -144,9 +150,8 @@ void MinimalMotionControl::initializeGPIO() {
 int32_t MinimalMotionControl::positionFromSpindle(int axis, int32_t spindlePos) {
     MinimalAxis& a = axes[axis];
     
-    // Exact h5.ino formula adapted for our 600 PPR encoder
-    int32_t newPos = spindlePos * a.motorSteps / a.screwPitch / ENCODER_STEPS_FLOAT 
-                     * spindle.threadPitch * spindle.threadStarts;
+    // h5.ino formula adapted for our 600 PPR encoder
+    int32_t newPos = spindleToSteps(axis, spindlePos, spindle.threadPitch * spindle.threadStarts);
     
     // Respect software limits (h5.ino style)
     if (newPos < a.rightStop) newPos = a.rightStop;
@@ -155,6 +160,15 @@ int32_t MinimalMotionControl::positionFromSpindle(int axis, int32_t spindlePos)
     return newPos;
 }
 
+// Spindle counts to axis steps for a lead in du per revolution. One
+// rounding at the end: dividing by screwPitch first, as h5.ino does in
+// float, truncates when done in integers
+int32_t MinimalMotionControl::spindleToSteps(int axis, int32_t spindleCounts, int32_t leadDu) {
+    MinimalAxis& a = axes[axis];
+    return (int32_t)((int64_t)spindleCounts * leadDu * a.motorSteps /
+                     ((int64_t)a.screwPitch * ENCODER_STEPS_INT));
+}
+
 // Core h5.ino algorithm: Calculate spindle position from stepper position
 int32_t MinimalMotionControl::spindleFromPosition(int axis, int32_t axisPos) {
     MinimalAxis& a = axes[axis];
@@ -198,6 +212,20 @@ void MinimalMotionControl::updateSpindleTracking() {
     spindle.lastUpdateTime = micros();
 }
 
+void MinimalMotionControl::updateSpindleRpm() {
+    // Counts over a fixed window - cheap and steady enough for display/telemetry
+    uint32_t now = millis();
+    uint32_t elapsed = now - spindle.rpmSampleTime;
+    if (elapsed < RPM_WINDOW_MS) {
+        return;
+    }
+    
+    int32_t counts = spindle.position - spindle.rpmSamplePosition;
+    spindle.rpm = (int32_t)((int64_t)counts * 60000 / ((int64_t)ENCODER_STEPS_INT * elapsed));
+    spindle.rpmSamplePosition = spindle.position;
+    spindle.rpmSampleTime = now;
+}
+
 // Core update loop (call from main loop at ~5kHz)
 void MinimalMotionControl::update() {
     if (emergencyStop) {
@@ -206,6 +234,7 @@ void MinimalMotionControl::update() {
     
     // Update spindle tracking with backlash compensation
     updateSpindleTracking();
+    updateSpindleRpm();
     
     // Update MPG tracking (h5.ino style continuous monitoring)
     updateMPGTracking();
@@ -261,12 +290,21 @@ void MinimalMotionControl::updateAxisMotion(int axis) {
 void MinimalMotionControl::updateSpeed(int axis) {
     MinimalAxis& a = axes[axis];
     
+    // Rapid override lowers the limit; slow down on the same curve
+    uint32_t limit = a.maxSpeed;
+    if (speedScale < 1.0f) {
+        limit = max(a.startSpeed, (uint32_t)(a.maxSpeed * speedScale));
+    }
+    
     // Simple acceleration ramping
-    if (a.currentSpeed < a.maxSpeed) {
+    if (a.currentSpeed < limit) {
         a.currentSpeed += a.acceleration / a.currentSpeed;  // Acceleration curve
-        if (a.currentSpeed > a.maxSpeed) {
-            a.currentSpeed = a.maxSpeed;
+        if (a.currentSpeed > limit) {
+            a.currentSpeed = limit;
         }
+    } else if (a.currentSpeed > limit) {
+        uint32_t decrement = a.acceleration / a.currentSpeed;
+        a.currentSpeed = a.currentSpeed - limit > decrement ? a.currentSpeed - decrement : limit;
     }
 }
 
@@ -363,6 +401,10 @@ bool MinimalMotionControl::isAxisEnabled(int axis) {
 void MinimalMotionControl::setMaxSpeed(int axis, uint32_t speed) {
     if (axis >= 0 && axis < 2) {
         axes[axis].maxSpeed = speed;
+        // Ramping only ever accelerates, so a lower limit must cut in here
+        if (axes[axis].currentSpeed > speed) {
+            axes[axis].currentSpeed = speed;
+        }
     }
 }
 
@@ -394,6 +436,7 @@ void MinimalMotionControl::resetSpindlePosition() {
     spindle.position = 0;
     spindle.positionAvg = 0;
     spindle.lastCount = 0;
+    spindle.rpmSamplePosition = 0;
     pcnt_counter_clear(PCNT_UNIT_0);
 }
 
@@ -480,6 +523,12 @@ int32_t MinimalMotionControl::mmToSteps(int axis, float mm) {
     return (int32_t)(mm * 10000.0 * a.motorSteps / a.screwPitch);  // Convert to deci-microns
 }
 
+int32_t MinimalMotionControl::stepsToDu(int axis, int32_t steps) {
+    if (axis < 0 || axis >= 2) return 0;
+    MinimalAxis& a = axes[axis];
+    return (int32_t)((int64_t)steps * a.screwPitch / a.motorSteps);
+}
+
 // ======================================================================
 // MPG (Manual Pulse Generator) Implementation - h5.ino style
 // ======================================================================
@@ -528,6 +577,12 @@ void MinimalMotionControl::updateMPGTracking() {
         int32_t pulseDelta = getMPGDelta(axis);
         if (pulseDelta == 0) continue;
         
+        // The axis belongs to a running operation, the wheel sets overrides
+        if (mpgOverride) {
+            mpg[axis].overridePulses += pulseDelta;
+            continue;
+        }
+        
         MinimalAxis& a = axes[axis];
         
         // Convert MPG pulses to motor steps using configured step size
@@ -577,6 +632,21 @@ void MinimalMotionControl::enableMPG(int axis, bool enable) {
     }
 }
 
+void MinimalMotionControl::setMPGOverride(bool enable) {
+    if (enable != mpgOverride) {
+        mpgOverride = enable;
+        mpg[AXIS_X].overridePulses = 0;
+        mpg[AXIS_Z].overridePulses = 0;
+    }
+}
+
+int32_t MinimalMotionControl::takeMPGOverridePulses(int axis) {
+    if (axis < 0 || axis >= 2) return 0;
+    int32_t pulses = mpg[axis].overridePulses;
+    mpg[axis].overridePulses = 0;
+    return pulses;
+}
+
 void MinimalMotionControl::setMPGStepSize(int axis, int32_t stepSizeDU) {
     if (axis >= 0 && axis < 2) {
         mpg[axis].stepSize = stepSizeDU;
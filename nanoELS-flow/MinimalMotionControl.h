@@ -28,6 +28,7 @@
 #define ENCODER_STEPS_FLOAT 1200.0
 #define ENCODER_BACKLASH 3                         // h5.ino backlash filter
 #define ENCODER_FILTER 1                           // Hardware filter
+#define RPM_WINDOW_MS 100                          // Spindle speed sampling window
 
 // Motion constants (from h5.ino)
 #define DIRECTION_SETUP_DELAY_US 5                 // Direction change delay
@@ -80,6 +81,11 @@ struct SpindleTracker {
     int16_t lastCount;                  // Last PCNT hardware value
     uint32_t lastUpdateTime;            // Last update timestamp
     
+    // Speed estimate (signed, positive = forward)
+    int32_t rpm;
+    int32_t rpmSamplePosition;          // position at start of sampling window
+    uint32_t rpmSampleTime;             // millis() at start of sampling window
+    
     // Threading parameters
     int32_t threadPitch;                // dupr (deci-microns per revolution)
     int32_t threadStarts;               // Multi-start thread count
@@ -92,6 +98,7 @@ struct MPGTracker {
     float fractionalPos;                // h5.ino style fractional position accumulator
     pcnt_unit_t pcntUnit;               // Hardware PCNT unit
     int32_t stepSize;                   // Current step size in deci-microns
+    int32_t overridePulses;             // Pulses taken while the MPG sets overrides
     bool active;                        // MPG manual mode active
 };
 
@@ -101,6 +108,8 @@ private:
     MinimalAxis axes[2];                // X=0, Z=1
     SpindleTracker spindle;
     MPGTracker mpg[2];                  // MPG trackers for X=0, Z=1
+    bool mpgOverride;                   // MPG pulses go to overrides, not the axes
+    float speedScale;                   // Rapid override on maxSpeed, 1 = full
     bool emergencyStop;
     
     // Static instance for interrupt access
@@ -110,6 +119,7 @@ private:
     int32_t positionFromSpindle(int axis, int32_t spindlePos);
     int32_t spindleFromPosition(int axis, int32_t axisPos);
     void updateSpindleTracking();
+    void updateSpindleRpm();
     void updateAxisMotion(int axis);
     void generateStepPulse(int axis);
     void updateSpeed(int axis);
@@ -161,12 +171,20 @@ public:
     void setMaxSpeed(int axis, uint32_t speed);
     uint32_t getMaxSpeed(int axis) { return axes[axis].maxSpeed; }
     uint32_t getCurrentSpeed(int axis) { return axes[axis].currentSpeed; }
+    uint32_t getAcceleration(int axis) { return axes[axis].acceleration; }
+    void setSpeedScale(float scale) { speedScale = scale; }  // Ramps down, no jump
+    float getSpeedScale() const { return speedScale; }
+    int32_t getMotorSteps(int axis) { return axes[axis].motorSteps; }
+    int32_t getScrewPitch(int axis) { return axes[axis].screwPitch; }
     
     // MPG control (Manual Pulse Generator)
     void enableMPG(int axis, bool enable);
     bool isMPGEnabled(int axis) { return mpg[axis].active; }
     void setMPGStepSize(int axis, int32_t stepSizeDU);
     int32_t getMPGStepSize(int axis) { return mpg[axis].stepSize; }
+    void setMPGOverride(bool enable);   // Running operations: MPGs set feed/rapid override
+    bool isMPGOverride() const { return mpgOverride; }
+    int32_t takeMPGOverridePulses(int axis);
     
     // MPG with float interface for OperationManager
     void setMPGStepSize(int axis, float mm);
@@ -181,6 +199,8 @@ public:
     // Spindle interface
     int32_t getSpindlePosition() { return spindle.position; }
     int32_t getSpindlePositionAvg() { return spindle.positionAvg; }
+    int32_t getSpindleRPM() { return spindle.rpm; }
+    int32_t spindleToSteps(int axis, int32_t spindleCounts, int32_t leadDu);  // Gearing of positionFromSpindle()
     void resetSpindlePosition();
     void zeroAxis(int axis);                // Set current position as zero origin
     
@@ -198,6 +218,7 @@ public:
     // Utility functions
     float stepsToMM(int axis, int32_t steps);
     int32_t mmToSteps(int axis, float mm);
+    int32_t stepsToDu(int axis, int32_t steps);  // Integer, for G-code limits
 };
 
 // Global instance
@@ -1,5 +1,6 @@
 #include "NextionDisplay.h"
 #include "OperationManager.h"
+#include "InputEvents.h"
 
 // Global instance
 NextionDisplay nextionDisplay;
@@ -18,10 +19,39 @@ NextionDisplay::NextionDisplay() {
   splashShown = false;
   splashStartTime = 0;
   
-  // Initialize hash tracking (from original h5.ino)
-  for (int i = 0; i < 4; i++) {
-    lastHash[i] = LCD_HASH_INITIAL;
+  // Initialize frame model - everything empty and due for a first send
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    fieldText[i][0] = '\0';
   }
+  layout = NEXTION_LAYOUT_TEXT;
+  for (int i = 0; i < NEXTION_NUM_COUNT; i++) {
+    numValue[i] = 0;
+  }
+  invalidateAll();
+  pendingCommandsLen = 0;
+  
+  txBytes = 0;
+  txBursts = 0;
+  txDeferred = 0;
+  reportBytes = 0;
+  reportTime = 0;
+  
+  rxFrameLen = 0;
+  rxTerminators = 0;
+  rxFrameOverlong = false;
+  pendingCommandsCount = 0;
+  inflight = 0;
+  ackWaitStart = 0;
+  ackTimeoutsInRow = 0;
+  ackFlowControl = true;
+  reportedPage = -1;
+  rxFrames = 0;
+  rxErrors = 0;
+  rxDiscarded = 0;
+  rxOverflows = 0;
+  touchEvents = 0;
+  ackTimeouts = 0;
+  lastError = NEXTION_RET_SUCCESS;
 }
 
 void NextionDisplay::initialize() {
@@ -29,6 +59,8 @@ void NextionDisplay::initialize() {
   
   // Initialize Serial1 for Nextion communication (EXACTLY matching original h5.ino)
   // CRITICAL: Must use exact same pins as original - GPIO 44 (RX) and 43 (TX)
+  // TX ring must be set before begin() so bursts are queued instead of blocking
+  Serial1.setTxBufferSize(NEXTION_TX_BUFFER_SIZE);
   Serial1.begin(115200, SERIAL_8N1, NEXTION_RX, NEXTION_TX);
   
   // CRITICAL: Original waits 1300ms for Nextion to boot
@@ -36,8 +68,20 @@ void NextionDisplay::initialize() {
   Serial.println("Waiting for Nextion to boot (1300ms)...");
   delay(1300);  // This delay is MANDATORY - do not reduce!
   
-  // Send a simple wakeup command to ensure communication
+  // Drop anything the panel sent while booting
+  while (Serial1.available() > 0) {
+    Serial1.read();
+  }
+  
+  // Return a code for every command so acks can pace the TX side,
+  // then wake the panel and ask which page it is showing
+  toScreen("bkcmd=3");
   toScreen("sleep=0");
+  toScreen("sendme");
+#if NEXTION_USE_NUMERIC_PAGE
+  setLayout(NEXTION_LAYOUT_NUMERIC);
+#endif
+  flush();
   
   // Small additional delay after first command
   delay(100);
@@ -50,54 +94,380 @@ void NextionDisplay::initialize() {
   Serial.println("✓ Nextion display initialized with proper 1300ms boot delay");
 }
 
-void NextionDisplay::toScreen(const String& command) {
-  Serial1.print(command);
-  Serial1.write(0xFF);
-  Serial1.write(0xFF);
-  Serial1.write(0xFF);
+void NextionDisplay::toScreen(const char* command) {
+  // Queue raw command for the next burst (commands are sent before fields)
+  size_t len = strlen(command);
+  if (pendingCommandsLen + len + 3 > NEXTION_CMD_BUFFER_SIZE) {
+    flush();
+  }
+  if (pendingCommandsLen + len + 3 > NEXTION_CMD_BUFFER_SIZE) {
+    txDeferred++;
+    return;  // Still no room - drop rather than block
+  }
   
-  // Debug output
-  Serial.println("Nextion: " + command);
+  memcpy(pendingCommands + pendingCommandsLen, command, len);
+  pendingCommandsLen += len;
+  for (int i = 0; i < 3; i++) {
+    pendingCommands[pendingCommandsLen++] = (char)0xFF;
+  }
+  pendingCommandsCount++;
 }
 
-void NextionDisplay::setText(uint8_t id, const String& text) {
-  if (hasChanged(id, text)) {
-    // Match original h5.ino format exactly
-    toScreen("t" + String(id) + ".txt=\"" + text + "\"");
+void NextionDisplay::setText(uint8_t id, const char* text) {
+  if (id >= NEXTION_FIELD_COUNT) return;
+  
+  // Only the frame is updated here; flush() decides what goes on the wire
+  if (strncmp(fieldText[id], text, NEXTION_FIELD_LEN - 1) != 0) {
+    strncpy(fieldText[id], text, NEXTION_FIELD_LEN - 1);
+    fieldText[id][NEXTION_FIELD_LEN - 1] = '\0';
+    fieldDirty[id] = true;
   }
 }
 
 void NextionDisplay::screenClear() {
-  for (int i = 0; i < 4; i++) {
-    String command = "t" + String(i) + ".txt=\"\"";
-    toScreen(command);
-    lastHash[i] = 0;  // Reset hash tracking
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    fieldText[i][0] = '\0';
+  }
+  invalidateAll();
+}
+
+void NextionDisplay::invalidateAll() {
+  // Force every field out on the next flush regardless of what was sent before
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    fieldSent[i][0] = '\x01';
+    fieldSent[i][1] = '\0';
+    fieldDirty[i] = true;
+  }
+  for (int i = 0; i < NEXTION_NUM_COUNT; i++) {
+    numSentValid[i] = false;
+  }
+}
+
+// Numeric component object names, indexed by NEXTION_NUM_*
+static const char* const numericNames[NEXTION_NUM_COUNT] = {"x0", "x1", "n0", "n1", "n2"};
+
+bool NextionDisplay::fieldOnPage(uint8_t id) const {
+  // The numeric page replaces the t2 position line with x0/x1
+  return !(layout == NEXTION_LAYOUT_NUMERIC && id == NEXTION_T2);
+}
+
+bool NextionDisplay::appendNumber(uint8_t id, size_t& len, size_t budget) {
+  // Numeric components take a plain integer: x0.val=1234 + 0xFF 0xFF 0xFF
+  char* out = (char*)txBuffer + len;
+  size_t room = (budget > len) ? budget - len : 0;
+  int n = snprintf(out, room, "%s.val=%ld", numericNames[id], (long)numValue[id]);
+  if (n < 0 || (size_t)n + 3 > room) {
+    return false;
+  }
+  
+  len += n;
+  txBuffer[len++] = 0xFF;
+  txBuffer[len++] = 0xFF;
+  txBuffer[len++] = 0xFF;
+  return true;
+}
+
+bool NextionDisplay::appendField(uint8_t id, size_t& len, size_t budget) {
+  // Match original h5.ino format exactly: tN.txt="..." + 0xFF 0xFF 0xFF
+  char* out = (char*)txBuffer + len;
+  size_t room = (budget > len) ? budget - len : 0;
+  int n = snprintf(out, room, "t%u.txt=\"%s\"", id, fieldText[id]);
+  if (n < 0 || (size_t)n + 3 > room) {
+    return false;
+  }
+  
+  len += n;
+  txBuffer[len++] = 0xFF;
+  txBuffer[len++] = 0xFF;
+  txBuffer[len++] = 0xFF;
+  return true;
+}
+
+void NextionDisplay::flush() {
+  // Never wait for the UART: only send what fits in the TX ring right now
+  size_t budget = Serial1.availableForWrite();
+  if (budget > NEXTION_TX_BUFFER_SIZE) {
+    budget = NEXTION_TX_BUFFER_SIZE;
+  }
+  
+  // Never run ahead of the panel: each command needs a free ack credit
+  uint8_t credits = UINT8_MAX;
+  if (ackFlowControl) {
+    credits = (inflight < NEXTION_MAX_INFLIGHT) ? NEXTION_MAX_INFLIGHT - inflight : 0;
+  }
+  
+  size_t len = 0;
+  uint8_t commands = 0;
+  if (pendingCommandsLen > 0) {
+    if (pendingCommandsLen > budget || pendingCommandsCount > credits) {
+      txDeferred++;
+      return;
+    }
+    memcpy(txBuffer, pendingCommands, pendingCommandsLen);
+    len = pendingCommandsLen;
+    commands = pendingCommandsCount;
+  }
+  
+  bool included[NEXTION_FIELD_COUNT] = {false};
+  bool deferred = false;
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    if (!fieldDirty[i] || !fieldOnPage(i)) continue;
+    
+    // Writers that put back the text already on screen cost nothing
+    if (strcmp(fieldText[i], fieldSent[i]) == 0) {
+      fieldDirty[i] = false;
+      continue;
+    }
+    
+    if (commands < credits && appendField(i, len, budget)) {
+      included[i] = true;
+      commands++;
+    } else {
+      deferred = true;  // Stays dirty for the next tick
+    }
+  }
+  
+  // Numeric components: only values that differ from the screen are sent
+  bool numIncluded[NEXTION_NUM_COUNT] = {false};
+  if (layout == NEXTION_LAYOUT_NUMERIC) {
+    for (int i = 0; i < NEXTION_NUM_COUNT; i++) {
+      if (numSentValid[i] && numSent[i] == numValue[i]) continue;
+      
+      if (commands < credits && appendNumber(i, len, budget)) {
+        numIncluded[i] = true;
+        commands++;
+      } else {
+        deferred = true;
+      }
+    }
+  }
+  
+  if (deferred) {
+    txDeferred++;
+  }
+  if (len == 0) {
+    return;
+  }
+  
+  Serial1.write(txBuffer, len);
+  txBytes += len;
+  txBursts++;
+  
+  if (ackFlowControl) {
+    if (inflight == 0) {
+      ackWaitStart = millis();
+    }
+    inflight += commands;
+  }
+  
+  pendingCommandsLen = 0;
+  pendingCommandsCount = 0;
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    if (included[i]) {
+      strcpy(fieldSent[i], fieldText[i]);
+      fieldDirty[i] = false;
+    }
+  }
+  for (int i = 0; i < NEXTION_NUM_COUNT; i++) {
+    if (numIncluded[i]) {
+      numSent[i] = numValue[i];
+      numSentValid[i] = true;
+    }
+  }
+  
+#if NEXTION_DEBUG
+  Serial.printf("Nextion: burst %u bytes\n", len);
+#endif
+}
+
+void NextionDisplay::receive() {
+  // Move everything the UART driver holds into the ring in contiguous chunks
+  int available = Serial1.available();
+  while (available > 0) {
+    size_t room;
+    uint8_t* dst = rxRing.reserve(room);
+    if (room == 0) {
+      rxOverflows++;  // Parse what we have, the rest waits in the driver
+      break;
+    }
+    size_t n = Serial1.read(dst, min(room, (size_t)available));
+    if (n == 0) break;
+    rxRing.commit(n);
+    available -= n;
+  }
+  
+  // Parse straight out of the ring without copying
+  size_t spanLen;
+  const uint8_t* span = rxRing.peekSpan(spanLen);
+  while (spanLen > 0) {
+    for (size_t i = 0; i < spanLen; i++) {
+      parseByte(span[i]);
+    }
+    rxRing.consume(spanLen);
+    span = rxRing.peekSpan(spanLen);
+  }
+  
+  // A panel that stops answering must not freeze the display forever
+  if (ackFlowControl && inflight > 0 && millis() - ackWaitStart > NEXTION_ACK_TIMEOUT_MS) {
+    inflight = 0;
+    ackTimeouts++;
+    if (++ackTimeoutsInRow >= NEXTION_ACK_TIMEOUT_LIMIT) {
+      ackFlowControl = false;
+      Serial.println("Nextion: no acks from panel - flow control disabled");
+    }
+  }
+}
+
+void NextionDisplay::parseByte(uint8_t b) {
+  // Frames end with 0xFF 0xFF 0xFF; a lone 0xFF can be payload (numeric data)
+  if (b == 0xFF) {
+    if (++rxTerminators < 3) return;
+    
+    if (rxFrameOverlong) {
+      rxDiscarded++;
+    } else if (rxFrameLen > 0) {
+      handleFrame(rxFrame, rxFrameLen);
+    }
+    rxFrameLen = 0;
+    rxTerminators = 0;
+    rxFrameOverlong = false;
+    return;
+  }
+  
+  // Bytes after fewer than three 0xFF: those 0xFF belonged to the payload
+  for (; rxTerminators > 0; rxTerminators--) {
+    if (rxFrameLen < NEXTION_RX_FRAME_LEN) {
+      rxFrame[rxFrameLen++] = 0xFF;
+    } else {
+      rxFrameOverlong = true;
+    }
+  }
+  if (rxFrameLen < NEXTION_RX_FRAME_LEN) {
+    rxFrame[rxFrameLen++] = b;
+  } else {
+    rxFrameOverlong = true;
   }
 }
 
-long NextionDisplay::calculateHash(const String& text) {
-  long hash = 0;
-  for (unsigned int i = 0; i < text.length(); i++) {
-    hash = hash * 31 + text.charAt(i);
+void NextionDisplay::acknowledge() {
+  if (inflight > 0) {
+    inflight--;
+  }
+  ackWaitStart = millis();
+  ackTimeoutsInRow = 0;
+  if (!ackFlowControl) {
+    ackFlowControl = true;
+    Serial.println("Nextion: acks received - flow control enabled");
   }
-  return hash;
 }
 
-bool NextionDisplay::hasChanged(uint8_t id, const String& text) {
-  if (id >= 4) return false;
+void NextionDisplay::handleFrame(const uint8_t* frame, size_t len) {
+  rxFrames++;
+  uint8_t code = frame[0];
   
-  long newHash = calculateHash(text);
-  if (newHash != lastHash[id]) {
-    lastHash[id] = newHash;
-    return true;
+  // 0x00 0x00 0x00 is the power-on message, not an invalid instruction
+  if (len == 3 && frame[0] == 0 && frame[1] == 0 && frame[2] == 0) {
+    code = NEXTION_RET_STARTUP;
   }
-  return false;
+  
+  switch (code) {
+    case NEXTION_RET_SUCCESS:
+      acknowledge();
+      break;
+      
+    case NEXTION_RET_TOUCH_EVENT:
+      // 0x65 page component event(1=press, 0=release)
+      if (len >= 4) {
+        handleTouch(frame[1], frame[2], frame[3] != 0);
+      }
+      break;
+      
+    case NEXTION_RET_CURRENT_PAGE:
+      // sendme reply - follow the panel if it is on one of our layouts
+      acknowledge();
+      if (len >= 2) {
+        reportedPage = frame[1];
+        NextionLayout shown = (frame[1] == NEXTION_PAGE_NUMERIC) ? NEXTION_LAYOUT_NUMERIC : NEXTION_LAYOUT_TEXT;
+        if ((frame[1] == NEXTION_PAGE_TEXT || frame[1] == NEXTION_PAGE_NUMERIC) && shown != layout) {
+          layout = shown;
+          invalidateAll();
+        }
+      }
+      break;
+      
+    case NEXTION_RET_STARTUP: {
+      // Panel rebooted on page 0: nothing we sent before is on screen any more
+      NextionLayout wanted = layout;
+      reportedPage = NEXTION_PAGE_TEXT;
+      inflight = 0;
+      layout = NEXTION_LAYOUT_TEXT;
+      invalidateAll();
+      toScreen("bkcmd=3");
+      setLayout(wanted);
+      Serial.println("Nextion: panel restarted, redrawing");
+      break;
+    }
+      
+    case NEXTION_RET_AUTO_SLEEP:
+    case NEXTION_RET_AUTO_WAKE:
+      break;
+      
+    case NEXTION_RET_BUFFER_OVERFLOW:
+      // Panel dropped commands - forget the window and redraw everything
+      rxErrors++;
+      lastError = code;
+      inflight = 0;
+      invalidateAll();
+      break;
+      
+    default:
+      if (code < NEXTION_RET_BUFFER_OVERFLOW) {
+        // Any other low code is a failed command (0x1A invalid variable on a
+        // page without that component, ...) - still frees its credit
+        rxErrors++;
+        lastError = code;
+        acknowledge();
+#if NEXTION_DEBUG
+        Serial.printf("Nextion: error 0x%02X\n", code);
+#endif
+      }
+      break;
+  }
+}
+
+// Touch buttons in the HMI: give them these component IDs and enable
+// "Send Component ID" for both press and release
+struct NextionTouchKey {
+  uint8_t component;
+  uint16_t keyCode;
+};
+
+static const NextionTouchKey touchKeys[] = {
+  {10, B_ON},
+  {11, B_OFF},
+  {12, B_PLUS},
+  {13, B_MINUS},
+  {14, B_STEP},
+  {15, B_DISPL},
+};
+
+void NextionDisplay::handleTouch(uint8_t page, uint8_t component, bool isPress) {
+  touchEvents++;
+  for (size_t i = 0; i < sizeof(touchKeys) / sizeof(touchKeys[0]); i++) {
+    if (touchKeys[i].component == component) {
+      inputEvents.post(INPUT_SOURCE_NEXTION, touchKeys[i].keyCode, isPress);
+      return;
+    }
+  }
+#if NEXTION_DEBUG
+  Serial.printf("Nextion: unmapped touch page %u component %u\n", page, component);
+#endif
 }
 
 void NextionDisplay::setState(DisplayState state) {
   if (currentState != state) {
     currentState = state;
-    Serial.println("Display state changed to: " + String(state));
+    Serial.printf("Display state changed to: %d\n", state);
   }
 }
 
@@ -106,35 +476,75 @@ DisplayState NextionDisplay::getState() {
 }
 
 void NextionDisplay::setTopLine(const String& text, DisplayPriority priority) {
-  setText(NEXTION_T0, text);
+  setText(NEXTION_T0, text.c_str());
 }
 
 void NextionDisplay::setPitchLine(const String& text, DisplayPriority priority) {
-  setText(NEXTION_T1, text);
+  setText(NEXTION_T1, text.c_str());
 }
 
 void NextionDisplay::setPositionLine(const String& text, DisplayPriority priority) {
-  setText(NEXTION_T2, text);
+  setText(NEXTION_T2, text.c_str());
 }
 
 void NextionDisplay::setStatusLine(const String& text, DisplayPriority priority) {
+  setText(NEXTION_T3, text.c_str());
+}
+
+void NextionDisplay::setTopLine(const char* text, DisplayPriority priority) {
+  setText(NEXTION_T0, text);
+}
+
+void NextionDisplay::setPitchLine(const char* text, DisplayPriority priority) {
+  setText(NEXTION_T1, text);
+}
+
+void NextionDisplay::setPositionLine(const char* text, DisplayPriority priority) {
+  setText(NEXTION_T2, text);
+}
+
+void NextionDisplay::setStatusLine(const char* text, DisplayPriority priority) {
   setText(NEXTION_T3, text);
 }
 
+void NextionDisplay::setLayout(NextionLayout newLayout) {
+  if (layout == newLayout) return;
+  
+  layout = newLayout;
+  char command[12];
+  snprintf(command, sizeof(command), "page %d",
+           newLayout == NEXTION_LAYOUT_NUMERIC ? NEXTION_PAGE_NUMERIC : NEXTION_PAGE_TEXT);
+  toScreen(command);
+  
+  // A page change resets every component on the display
+  invalidateAll();
+  Serial.printf("Nextion layout: %s\n", newLayout == NEXTION_LAYOUT_NUMERIC ? "numeric" : "text");
+}
+
+void NextionDisplay::setNumber(uint8_t id, int32_t value) {
+  if (id >= NEXTION_NUM_COUNT) return;
+  numValue[id] = value;
+}
+
 void NextionDisplay::showWiFiStatus(const String& status, bool connecting) {
   if (connecting) {
     setTopLine("WiFi: Connecting...");
     setStatusLine(status);
   } else {
-    setTopLine("WiFi: " + status);
+    char line[NEXTION_FIELD_LEN];
+    snprintf(line, sizeof(line), "WiFi: %s", status.c_str());
+    setTopLine(line);
   }
+  
+  // WiFi bring-up runs outside the scheduler, so push the frame out now
+  flush();
 }
 
 void NextionDisplay::showMotionStatus() {
   // Top line: Mode and status (matching original h5.ino format)
   extern OperationManager operationManager;
   extern float manualStepSize;
-  String topLine = "";
+  char topLine[NEXTION_FIELD_LEN];
   
   // Dummy values for clean display - no motion control
   bool emergencyStop = false;
@@ -142,44 +552,47 @@ void NextionDisplay::showMotionStatus() {
   bool zMoving = false;
   
   if (emergencyStop) {
-    topLine = "EMERGENCY STOP";
+    snprintf(topLine, sizeof(topLine), "EMERGENCY STOP");
   } else if (xMoving || zMoving) {
-    topLine = "MOVING - ";
+    const char* mode;
     switch(operationManager.getMode()) {
-      case MODE_NORMAL: topLine += "Manual"; break;
-      case MODE_TURN: topLine += "Turning"; break;
-      case MODE_FACE: topLine += "Facing"; break;
-      case MODE_THREAD: topLine += "Threading"; break;
-      case MODE_CONE: topLine += "Cone"; break;
-      case MODE_CUT: topLine += "Cutting"; break;
-      case MODE_ASYNC: topLine += "Async"; break;
-      case MODE_ELLIPSE: topLine += "Ellipse"; break;
-      case MODE_GCODE: topLine += "GCode"; break;
-      default: topLine += "Mode " + String(operationManager.getMode()); break;
+      case MODE_NORMAL: mode = "Manual"; break;
+      case MODE_TURN: mode = "Turning"; break;
+      case MODE_FACE: mode = "Facing"; break;
+      case MODE_THREAD: mode = "Threading"; break;
+      case MODE_CONE: mode = "Cone"; break;
+      case MODE_CUT: mode = "Cutting"; break;
+      case MODE_ASYNC: mode = "Async"; break;
+      case MODE_ELLIPSE: mode = "Ellipse"; break;
+      case MODE_GCODE: mode = "GCode"; break;
+      default: mode = "Mode ?"; break;
     }
+    snprintf(topLine, sizeof(topLine), "MOVING - %s", mode);
   } else {
+    const char* mode;
     switch(operationManager.getMode()) {
-      case MODE_NORMAL: topLine = "Manual Mode"; break;
-      case MODE_TURN: topLine = "Turning"; break;
-      case MODE_FACE: topLine = "Facing"; break;
-      case MODE_THREAD: topLine = "Threading"; break;
-      case MODE_CONE: topLine = "Cone"; break;
-      case MODE_CUT: topLine = "Cutting"; break;
-      case MODE_ASYNC: topLine = "Async Mode"; break;
-      case MODE_ELLIPSE: topLine = "Ellipse Mode"; break;
-      case MODE_GCODE: topLine = "GCode Mode"; break;
-      default: topLine = "Mode " + String(operationManager.getMode()); break;
+      case MODE_NORMAL: mode = "Manual Mode"; break;
+      case MODE_TURN: mode = "Turning"; break;
+      case MODE_FACE: mode = "Facing"; break;
+      case MODE_THREAD: mode = "Threading"; break;
+      case MODE_CONE: mode = "Cone"; break;
+      case MODE_CUT: mode = "Cutting"; break;
+      case MODE_ASYNC: mode = "Async Mode"; break;
+      case MODE_ELLIPSE: mode = "Ellipse Mode"; break;
+      case MODE_GCODE: mode = "GCode Mode"; break;
+      default: mode = "Mode ?"; break;
     }
-    topLine += " Step:" + String(manualStepSize) + "mm";
+    snprintf(topLine, sizeof(topLine), "%s Step:%.2fmm", mode, manualStepSize);
   }
   setTopLine(topLine);
   
   // Pitch line: Thread pitch info (matching original h5.ino format)
   long dupr = motionControl.getDupr();
   int starts = motionControl.getStarts();
-  String pitchLine = "Pitch " + operationManager.formatDupr(dupr);
-  if (starts != 1) {
-    pitchLine += " x" + String(starts);
+  char pitchLine[NEXTION_FIELD_LEN];
+  int len = snprintf(pitchLine, sizeof(pitchLine), "Pitch %s", operationManager.formatDupr(dupr).c_str());
+  if (starts != 1 && len > 0 && (size_t)len < sizeof(pitchLine)) {
+    snprintf(pitchLine + len, sizeof(pitchLine) - len, " x%d", starts);
   }
   setPitchLine(pitchLine);
   
@@ -187,33 +600,47 @@ void NextionDisplay::showMotionStatus() {
   // Get real position values from motion control
   float xPos = motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X));
   float zPos = motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z));
-  String posLine = "Z:" + String(zPos, 2) + " X:" + String(xPos, 2);
+  char posLine[NEXTION_FIELD_LEN];
+  snprintf(posLine, sizeof(posLine), "Z:%.2f X:%.2f", zPos, xPos);
   setPositionLine(posLine);
   
-  // Status line: RPM and encoder info (matching original format)
-  String statusLine = "";
+  // Numeric page: same values as fixed-point integers (0.01mm)
+  setNumber(NEXTION_NUM_Z, lroundf(zPos * 100.0f));
+  setNumber(NEXTION_NUM_X, lroundf(xPos * 100.0f));
   
+  // Status line: RPM and encoder info (matching original format)
   // Get real values from motion control
-  int rpm = 0;
+  int rpm = abs(motionControl.getSpindleRPM());
   int spindlePos = motionControl.getSpindlePosition();
-  float xError = motionControl.getFollowingError(AXIS_X);
-  float zError = motionControl.getFollowingError(AXIS_Z);
   int32_t xSteps = motionControl.getPosition(AXIS_X);
   int32_t zSteps = motionControl.getPosition(AXIS_Z);
   
-  if (rpm > 0) {
-    statusLine = String(rpm) + "rpm ";
-  }
-  statusLine += "ENC:" + String(spindlePos);
-  statusLine += " X:" + String(xSteps) + " Z:" + String(zSteps);
-  
   // Add motion status
+  const char* motionState;
   if (motionControl.getEmergencyStop()) {
-    statusLine += " E-STOP";
+    motionState = "E-STOP";
   } else if (motionControl.isMoving(AXIS_X) || motionControl.isMoving(AXIS_Z)) {
-    statusLine += " MOVING";
+    motionState = "MOVING";
   } else {
-    statusLine += " READY";
+    motionState = "READY";
+  }
+  
+  setNumber(NEXTION_NUM_RPM, rpm);
+  bool running = operationManager.isPassMode() && operationManager.getState() == STATE_RUNNING;
+  setNumber(NEXTION_NUM_PASS, running ? operationManager.getCurrentPass() + 1 : 0);
+  setNumber(NEXTION_NUM_PASSES, operationManager.isPassMode() ? operationManager.getTotalPasses() : 0);
+  
+  char statusLine[NEXTION_FIELD_LEN];
+  char rpmText[12] = "";
+  if (rpm > 0) {
+    snprintf(rpmText, sizeof(rpmText), "%drpm ", rpm);
+  }
+  if (layout == NEXTION_LAYOUT_NUMERIC) {
+    // Counters already have their own components; keep t3 static while moving
+    snprintf(statusLine, sizeof(statusLine), "%s", motionState);
+  } else {
+    snprintf(statusLine, sizeof(statusLine), "%sENC:%d X:%ld Z:%ld %s",
+             rpmText, spindlePos, (long)xSteps, (long)zSteps, motionState);
   }
   
   // Only update t3 with normal status when not in debug mode
@@ -266,7 +693,13 @@ void NextionDisplay::showEmergencyStop() {
 void NextionDisplay::showMessage(const String& message, uint8_t objectId, 
                                 unsigned long duration, DisplayPriority priority) {
   if (messageCount < 8) {
-    messageQueue[messageCount] = {message, objectId, priority, millis(), duration};
+    DisplayMessage& msg = messageQueue[messageCount];
+    strncpy(msg.text, message.c_str(), NEXTION_FIELD_LEN - 1);
+    msg.text[NEXTION_FIELD_LEN - 1] = '\0';
+    msg.objectId = objectId;
+    msg.priority = priority;
+    msg.timestamp = millis();
+    msg.duration = duration;
     messageCount++;
   }
 }
@@ -327,10 +760,8 @@ void NextionDisplay::update() {
     splashScreen = false;
     screenClear();
     
-    // Reset all hash values (from original h5.ino)
-    for (int i = 0; i < 4; i++) {
-      lastHash[i] = LCD_HASH_INITIAL;
-    }
+    // Force a full redraw on the first normal frame (from original h5.ino)
+    invalidateAll();
     
     // Transition to normal state
     currentState = DISPLAY_STATE_NORMAL;
@@ -351,13 +782,58 @@ void NextionDisplay::update() {
   }
 }
 
+size_t NextionDisplay::frameBytes(NextionLayout frameLayout, bool droOnly) {
+  // Wire size of a full redraw of the current frame, without sending it
+  size_t total = 0;
+  for (int i = 0; i < NEXTION_FIELD_COUNT; i++) {
+    if (frameLayout == NEXTION_LAYOUT_NUMERIC && i == NEXTION_T2) continue;
+    if (droOnly && i != NEXTION_T2) continue;
+    total += snprintf(nullptr, 0, "t%u.txt=\"%s\"", i, fieldText[i]) + 3;
+  }
+  if (frameLayout == NEXTION_LAYOUT_NUMERIC) {
+    for (int i = 0; i < NEXTION_NUM_COUNT; i++) {
+      if (droOnly && i != NEXTION_NUM_Z && i != NEXTION_NUM_X) continue;
+      total += snprintf(nullptr, 0, "%s.val=%ld", numericNames[i], (long)numValue[i]) + 3;
+    }
+  }
+  return total;
+}
+
+void NextionDisplay::printBandwidthReport() {
+  unsigned long now = millis();
+  unsigned long elapsed = now - reportTime;
+  uint32_t bytesPerSec = elapsed > 0 ? (uint32_t)((uint64_t)(txBytes - reportBytes) * 1000 / elapsed) : 0;
+  reportBytes = txBytes;
+  reportTime = now;
+  
+  size_t textFull = frameBytes(NEXTION_LAYOUT_TEXT, false);
+  size_t textDro = frameBytes(NEXTION_LAYOUT_TEXT, true);
+  size_t numFull = frameBytes(NEXTION_LAYOUT_NUMERIC, false);
+  size_t numDro = frameBytes(NEXTION_LAYOUT_NUMERIC, true);
+  
+  Serial.printf("Nextion (%s page): %u B/s on wire (%u%% of link), %u bursts, %u deferred\n",
+               layout == NEXTION_LAYOUT_NUMERIC ? "numeric" : "text",
+               bytesPerSec, bytesPerSec * 100 / NEXTION_BYTES_PER_SEC, txBursts, txDeferred);
+  Serial.printf("  Text frame:    %u B full (max %u Hz), %u B DRO (max %u Hz)\n",
+               (unsigned)textFull, (unsigned)(NEXTION_BYTES_PER_SEC / textFull),
+               (unsigned)textDro, (unsigned)(NEXTION_BYTES_PER_SEC / textDro));
+  Serial.printf("  Numeric frame: %u B full (max %u Hz), %u B DRO (max %u Hz)\n",
+               (unsigned)numFull, (unsigned)(NEXTION_BYTES_PER_SEC / numFull),
+               (unsigned)numDro, (unsigned)(NEXTION_BYTES_PER_SEC / numDro));
+  Serial.printf("  RX: %u frames, %u touch, %u errors (last 0x%02X), %u discarded, %u overflows\n",
+               rxFrames, touchEvents, rxErrors, lastError, rxDiscarded, rxOverflows);
+  Serial.printf("  Acks: %u in flight, %u timeouts, flow control %s, page %d\n",
+               inflight, ackTimeouts, ackFlowControl ? "on" : "off", reportedPage);
+}
+
 void NextionDisplay::clearAll() {
   screenClear();
 }
 
 void NextionDisplay::setBrightness(uint8_t brightness) {
   if (brightness > 100) brightness = 100;
-  String command = "dim=" + String(brightness);
+  char command[12];
+  snprintf(command, sizeof(command), "dim=%u", brightness);
   toScreen(command);
 }
 
@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include "SetupConstants.h"
 #include "MinimalMotionControl.h"
+#include "CircularBuffer.h"
 
 // Nextion display object IDs (from original h5.ino)
 #define NEXTION_T0  0  // Top line status display
@@ -11,8 +12,52 @@
 #define NEXTION_T2  2  // Axis position details  
 #define NEXTION_T3  3  // Bottom line context/status information
 
-// Hash initialization value from original h5.ino
-#define LCD_HASH_INITIAL -3845709
+// Frame model sizing
+#define NEXTION_FIELD_COUNT 4        // t0..t3
+#define NEXTION_FIELD_LEN 48         // Max chars per text field (incl. terminator)
+#define NEXTION_CMD_BUFFER_SIZE 64   // Pending raw commands (sleep/dim/...)
+#define NEXTION_TX_BUFFER_SIZE 256   // Serial1 TX ring size and max burst length
+
+// Set to 1 to echo every TX burst to the USB serial console
+#define NEXTION_DEBUG 0
+
+// Nextion UART speed (10 bits per byte on the wire: start + 8N1 + stop)
+#define NEXTION_BAUD 115200
+#define NEXTION_BYTES_PER_SEC (NEXTION_BAUD / 10)
+
+// Receive path and ack-based flow control
+#define NEXTION_RX_RING_SIZE 256     // Bytes drained from Serial1 per poll (power of 2)
+#define NEXTION_RX_FRAME_LEN 16      // Longest return frame kept (longer ones are skipped)
+#define NEXTION_MAX_INFLIGHT 8       // Commands sent but not yet acknowledged
+#define NEXTION_ACK_TIMEOUT_MS 250   // Give up waiting for outstanding acks
+#define NEXTION_ACK_TIMEOUT_LIMIT 3  // Consecutive timeouts before flow control is disabled
+
+// Return codes (Nextion Instruction Set, bkcmd=3 reports success and failure)
+#define NEXTION_RET_INVALID_CMD 0x00
+#define NEXTION_RET_SUCCESS 0x01
+#define NEXTION_RET_INVALID_VARIABLE 0x1A
+#define NEXTION_RET_BUFFER_OVERFLOW 0x24
+#define NEXTION_RET_TOUCH_EVENT 0x65
+#define NEXTION_RET_CURRENT_PAGE 0x66
+#define NEXTION_RET_AUTO_SLEEP 0x86
+#define NEXTION_RET_AUTO_WAKE 0x87
+#define NEXTION_RET_STARTUP 0x88
+
+// Page layouts in the HMI file
+#define NEXTION_PAGE_TEXT 0      // t0..t3 text lines (original h5.ino layout)
+#define NEXTION_PAGE_NUMERIC 1   // t0, t1, t3 text plus numeric DRO components
+
+// Set to 1 to start on the numeric page (HMI must contain page 1)
+#define NEXTION_USE_NUMERIC_PAGE 0
+
+// Numeric components on the numeric page
+// x0/x1 are Xfloat objects with vvs1=2, so values are in 0.01mm
+#define NEXTION_NUM_Z       0  // x0 - Z position (0.01mm)
+#define NEXTION_NUM_X       1  // x1 - X position (0.01mm)
+#define NEXTION_NUM_RPM     2  // n0 - spindle RPM
+#define NEXTION_NUM_PASS    3  // n1 - current pass (1-based, 0 when idle)
+#define NEXTION_NUM_PASSES  4  // n2 - total passes
+#define NEXTION_NUM_COUNT   5
 
 // Display update priorities
 enum DisplayPriority {
@@ -22,6 +67,12 @@ enum DisplayPriority {
   DISPLAY_PRIORITY_CRITICAL = 3
 };
 
+// Page layouts
+enum NextionLayout {
+  NEXTION_LAYOUT_TEXT = 0,     // Every value formatted into t0..t3
+  NEXTION_LAYOUT_NUMERIC = 1   // Positions, RPM and passes as numeric components
+};
+
 // Display states
 enum DisplayState {
   DISPLAY_STATE_BOOT,
@@ -43,12 +94,58 @@ private:
   bool splashShown;
   unsigned long splashStartTime;
   
-  // Hash tracking for change detection (from original code)
-  long lastHash[4];  // Hash for t0, t1, t2, t3 (changed to long to match original)
+  // Display frame shared by all writers: desired text and text last sent
+  char fieldText[NEXTION_FIELD_COUNT][NEXTION_FIELD_LEN];
+  char fieldSent[NEXTION_FIELD_COUNT][NEXTION_FIELD_LEN];
+  bool fieldDirty[NEXTION_FIELD_COUNT];
+  
+  // Numeric components: desired value and value last sent
+  NextionLayout layout;
+  int32_t numValue[NEXTION_NUM_COUNT];
+  int32_t numSent[NEXTION_NUM_COUNT];
+  bool numSentValid[NEXTION_NUM_COUNT];
+  
+  // Raw commands waiting for the next TX burst
+  char pendingCommands[NEXTION_CMD_BUFFER_SIZE];
+  size_t pendingCommandsLen;
+  
+  // Coalesced TX burst buffer
+  uint8_t txBuffer[NEXTION_TX_BUFFER_SIZE];
+  
+  // Transport statistics
+  uint32_t txBytes;
+  uint32_t txBursts;
+  uint32_t txDeferred;
+  uint32_t reportBytes;        // txBytes at last bandwidth report
+  unsigned long reportTime;
+  
+  // Receive path: Serial1 is drained into rxRing, then parsed into frames
+  CircularBuffer<uint8_t, NEXTION_RX_RING_SIZE> rxRing;
+  uint8_t rxFrame[NEXTION_RX_FRAME_LEN];
+  size_t rxFrameLen;
+  uint8_t rxTerminators;       // Consecutive 0xFF seen
+  bool rxFrameOverlong;
+  
+  // Ack flow control: one return code per command with bkcmd=3
+  uint8_t pendingCommandsCount;
+  uint8_t inflight;
+  unsigned long ackWaitStart;
+  uint8_t ackTimeoutsInRow;
+  bool ackFlowControl;
+  int16_t reportedPage;        // Last sendme reply, -1 if unknown
+  
+  // Receive statistics
+  uint32_t rxFrames;
+  uint32_t rxErrors;
+  uint32_t rxDiscarded;
+  uint32_t rxOverflows;
+  uint32_t touchEvents;
+  uint32_t ackTimeouts;
+  uint8_t lastError;
   
   // Message queue for priority display
   struct DisplayMessage {
-    String text;
+    char text[NEXTION_FIELD_LEN];
     uint8_t objectId;
     DisplayPriority priority;
     unsigned long timestamp;
@@ -59,11 +156,18 @@ private:
   int messageCount;
   
   // Internal methods
-  void toScreen(const String& command);
-  void setText(uint8_t id, const String& text);
+  void toScreen(const char* command);
+  void setText(uint8_t id, const char* text);
   void screenClear();
-  long calculateHash(const String& text);
-  bool hasChanged(uint8_t id, const String& text);
+  void invalidateAll();
+  bool appendField(uint8_t id, size_t& len, size_t budget);
+  bool appendNumber(uint8_t id, size_t& len, size_t budget);
+  bool fieldOnPage(uint8_t id) const;
+  size_t frameBytes(NextionLayout frameLayout, bool droOnly);
+  void parseByte(uint8_t b);
+  void handleFrame(const uint8_t* frame, size_t len);
+  void handleTouch(uint8_t page, uint8_t component, bool isPress);
+  void acknowledge();
   void processMessageQueue();
   
 public:
@@ -81,6 +185,15 @@ public:
   void setPitchLine(const String& text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
   void setPositionLine(const String& text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
   void setStatusLine(const String& text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
+  void setTopLine(const char* text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
+  void setPitchLine(const char* text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
+  void setPositionLine(const char* text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
+  void setStatusLine(const char* text, DisplayPriority priority = DISPLAY_PRIORITY_NORMAL);
+  
+  // Numeric page layout
+  void setLayout(NextionLayout newLayout);
+  NextionLayout getLayout() const { return layout; }
+  void setNumber(uint8_t id, int32_t value);
   
   // Specific status methods
   void showWiFiStatus(const String& status, bool connecting = false);
@@ -97,9 +210,28 @@ public:
   void showBootScreen();
   void showInitProgress(const String& step);
   
-  // Main update function
+  // Main update function - composes the frame, does not transmit
   void update();
   
+  // Send changed fields in one burst if Serial1 has room and the panel
+  // has acknowledged earlier commands; never blocks
+  void flush();
+  
+  // Drain Serial1 RX and dispatch return frames (touch, acks, errors, page)
+  void receive();
+  
+  // Transport statistics
+  uint32_t getTxBytes() const { return txBytes; }
+  uint32_t getTxBursts() const { return txBursts; }
+  uint32_t getTxDeferred() const { return txDeferred; }
+  uint32_t getRxErrors() const { return rxErrors; }
+  uint32_t getTouchEvents() const { return touchEvents; }
+  int16_t getReportedPage() const { return reportedPage; }
+  
+  // Bytes per frame and achievable refresh rate for both layouts, plus
+  // measured wire bytes/s since the previous report
+  void printBandwidthReport();
+  
   // Utility functions
   void clearAll();
   void setBrightness(uint8_t brightness);  // 0-100
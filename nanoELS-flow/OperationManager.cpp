@@ -1,4 +1,7 @@
 #include "OperationManager.h"
+#include "FeedOverride.h"
+#include "GCodeInterpreter.h"
+#include "GCodeStream.h"
 #include "MinimalMotionControl.h"
 #include "SetupConstants.h"
 #include <cmath>
@@ -39,12 +42,21 @@ OperationManager::OperationManager()
     , opDuprSign(1)
     , opDupr(0)
     , spindleSyncPos(0)
+    , feedSpindle(0)
+    , feedSpindleLast(0)
     , startOffset(0)
+    , completedCount(0)
+    , cycleEstimateMs(0)
+    , cycleTracking(false)
+    , trackedPass(0)
+    , trackedSubState(SUBSTATE_MOVE_TO_START)
+    , trackedCompleted(0)
 {
     // Initialize numpad digits array
     for (int i = 0; i < 20; i++) {
         numpadDigits[i] = 0;
     }
+    memset(&cycleEstimate, 0, sizeof(cycleEstimate));
 }
 
 void OperationManager::init(MinimalMotionControl* mc) {
@@ -593,6 +605,16 @@ void OperationManager::previousSetupStep() {
 }
 
 bool OperationManager::startOperation() {
+    // Programs carry their own coordinates from the work zero, so G-code
+    // needs neither touch-off nor cut parameters
+    if (currentMode == MODE_GCODE) {
+        if (!motionControl || currentState == STATE_RUNNING || !gcodeInterpreter.start()) {
+            return false;
+        }
+        currentState = STATE_RUNNING;
+        return true;
+    }
+
     if (!motionControl || !hasTouchOff() || currentState != STATE_READY) {
         return false;
     }
@@ -632,7 +654,7 @@ bool OperationManager::startOperation() {
     startOffset = (starts == 1) ? 0 : round((ENCODER_PPR * 2.0f) / starts);
     
     // Mark current spindle position for sync
-    spindleSyncPos = motionControl->getSpindlePosition();
+    startSpindleFollow();
     
     return true;
 }
@@ -648,16 +670,98 @@ void OperationManager::stopOperation() {
         motionControl->setTargetPosition(AXIS_Z, motionControl->getAxisPosition(AXIS_Z));
     }
     
+    // Streamed lines must not resume on the next start
+    if (currentMode == MODE_GCODE) {
+        gcodeInterpreter.stop();
+        gcodeStream.abort();
+    }
+    
     // Re-enable manual movement when operation stops
     setArrowKeyMode(ARROW_MOTION_MODE);
 }
 
+bool OperationManager::isJobMode(OperationMode mode) {
+    // Pass modes that end by themselves; the others run until stopped
+    return mode == MODE_TURN || mode == MODE_FACE || mode == MODE_THREAD || mode == MODE_CUT;
+}
+
+bool OperationManager::canCaptureSetup() const {
+    return motionControl && isJobMode(currentMode) && currentState != STATE_RUNNING &&
+           hasTouchOff() && cutLength != 0 && cutDepth != 0;
+}
+
+bool OperationManager::captureSetup(OperationSetup& setup) const {
+    if (!canCaptureSetup()) {
+        return false;
+    }
+    setup.mode = currentMode;
+    setup.internal = isInternalOperation;
+    setup.leftToRight = isLeftToRight;
+    setup.dupr = motionControl->getDupr();
+    setup.starts = motionControl->getStarts();
+    setup.targetDiameter = targetDiameter;
+    setup.targetZLength = targetZLength;
+    setup.cutLength = cutLength;
+    setup.cutDepth = cutDepth;
+    setup.passes = numPasses;
+    setup.coneRatio = coneRatio;
+    setup.touchOffX = touchOffX;
+    setup.touchOffZ = touchOffZ;
+    setup.touchOffXCoord = touchOffXCoord;
+    setup.touchOffZCoord = touchOffZCoord;
+    setup.parkingSet = parkingPositionSet;
+    setup.parkingX = parkingPositionX;
+    setup.parkingZ = parkingPositionZ;
+    return true;
+}
+
+bool OperationManager::applySetup(const OperationSetup& setup) {
+    if (!motionControl || currentState == STATE_RUNNING || !isJobMode(setup.mode) ||
+        setup.cutLength == 0 || setup.cutDepth == 0 || setup.passes < 1 ||
+        abs(setup.dupr) > DUPR_MAX || setup.starts < 1) {
+        return false;
+    }
+    currentMode = setup.mode;
+    isInternalOperation = setup.internal;
+    isLeftToRight = setup.leftToRight;
+    motionControl->setThreadPitch(setup.dupr, setup.starts);
+    targetDiameter = setup.targetDiameter;
+    targetZLength = setup.targetZLength;
+    cutLength = setup.cutLength;
+    cutDepth = setup.cutDepth;
+    numPasses = setup.passes;
+    coneRatio = setup.coneRatio;
+    touchOffX = setup.touchOffX;
+    touchOffZ = setup.touchOffZ;
+    touchOffXCoord = setup.touchOffXCoord;
+    touchOffZCoord = setup.touchOffZCoord;
+    touchOffXValid = true;
+    touchOffZValid = true;
+    touchOffComplete = true;
+    parkingPositionSet = setup.parkingSet;
+    parkingPositionX = setup.parkingX;
+    parkingPositionZ = setup.parkingZ;
+    
+    // Skip the setup steps: the operation is ready as after the last one
+    resetNumpad();
+    currentPass = 0;
+    setupIndex = getLastSetupIndex();
+    currentState = STATE_READY;
+    setArrowKeyMode(ARROW_MOTION_MODE);
+    return true;
+}
+
 void OperationManager::pauseOperation() {
     // TODO: Implement pause functionality
 }
 
 void OperationManager::resumeOperation() {
-    // TODO: Implement resume functionality
+    // Continue a program held by M0/M1
+    if (currentMode == MODE_GCODE && currentState == STATE_RUNNING) {
+        gcodeInterpreter.resume();
+        return;
+    }
+    // TODO: Implement resume functionality for the other modes
 }
 
 void OperationManager::advancePass() {
@@ -769,8 +873,7 @@ bool OperationManager::performCuttingPass() {
                 motionControl->setTargetPosition(AXIS_X, targetX);
                 
                 // Use h5.ino-style spindle following for Z
-                long spindlePos = motionControl->getSpindlePosition();
-                long deltaSpindle = spindlePos - spindleSyncPos;
+                long deltaSpindle = feedSpindleDelta();
                 
                 // Direction is handled by the sign of dupr
                 long deltaZ = posFromSpindle(AXIS_Z, deltaSpindle, true);
@@ -815,8 +918,7 @@ bool OperationManager::performCuttingPass() {
         case MODE_CUT:
             {
                 // X follows spindle for cut-off (plunging towards center)
-                long spindlePos = motionControl->getSpindlePosition();
-                long deltaX = posFromSpindle(AXIS_X, spindlePos - spindleSyncPos, true);
+                long deltaX = posFromSpindle(AXIS_X, feedSpindleDelta(), true);
                 
                 // Calculate target diameter (moving towards center)
                 float deltaXMm = stepsToMm(deltaX, AXIS_X);
@@ -843,8 +945,7 @@ bool OperationManager::performCuttingPass() {
         case MODE_CONE:
             {
                 // Both axes follow spindle with cone ratio
-                long spindlePos = motionControl->getSpindlePosition();
-                long deltaZ = posFromSpindle(AXIS_Z, spindlePos - spindleSyncPos, true);
+                long deltaZ = posFromSpindle(AXIS_Z, feedSpindleDelta(), true);
                 targetZ = touchOffZ + deltaZ;
                 
                 // Calculate X movement based on Z movement and cone ratio
@@ -884,8 +985,62 @@ bool OperationManager::returnToStart() {
     return (abs(motionControl->getAxisPosition(AXIS_Z) - touchOffZ) < 5);
 }
 
+void OperationManager::startSpindleFollow() {
+    spindleSyncPos = motionControl->getSpindlePosition();
+    feedSpindle = 0;
+    feedSpindleLast = spindleSyncPos;
+}
+
+long OperationManager::feedSpindleDelta() {
+    long spindlePos = motionControl->getSpindlePosition();
+    if (isFeedOverrideLocked()) {
+        return spindlePos - spindleSyncPos;  // Threads need the exact lead
+    }
+    
+    // Integrated tick by tick in 1/1024 counts, so a changed override bends
+    // the feed instead of moving the axis to where the new ratio would put it
+    feedSpindle += (int64_t)(spindlePos - feedSpindleLast) * lroundf(feedOverride.getFeedScale() * 1024.0f);
+    feedSpindleLast = spindlePos;
+    return (long)((feedSpindle + 512) >> 10);
+}
+
+bool OperationManager::isFeedOverrideLocked() const {
+    if (currentMode == MODE_GCODE) {
+        return gcodeInterpreter.isSynchronised();
+    }
+    return currentMode == MODE_THREAD || currentMode == MODE_NORMAL;
+}
+
+float OperationManager::axisSpeedScale() const {
+    if (currentState != STATE_RUNNING) {
+        return 1.0f;
+    }
+    switch (currentMode) {
+        case MODE_TURN:
+        case MODE_FACE:
+        case MODE_THREAD:
+        case MODE_CUT:
+            if (passSubState == SUBSTATE_CUTTING) {
+                // Facing is not geared to the spindle, the axis speed is its feed
+                return currentMode == MODE_FACE ? min(feedOverride.getFeedScale(), 1.0f) : 1.0f;
+            }
+            return passSubState == SUBSTATE_SYNC_SPINDLE ? 1.0f : feedOverride.getRapidScale();
+        default:
+            // Geared to the spindle throughout, or planned (G-code)
+            return 1.0f;
+    }
+}
+
 void OperationManager::update() {
-    if (!motionControl || currentState != STATE_RUNNING) {
+    if (!motionControl) {
+        return;
+    }
+    
+    // Rapid override slows positioning moves only; geared cuts need the
+    // full axis speed to keep up with the spindle
+    motionControl->setSpeedScale(axisSpeedScale());
+    if (currentState != STATE_RUNNING) {
+        updateCycle();
         return;
     }
     
@@ -919,6 +1074,136 @@ void OperationManager::update() {
             executeGcodeMode();
             break;
     }
+    
+    // Time the substate this tick ended in
+    updateCycle();
+}
+
+void OperationManager::passPhases(int pass, CyclePhase phases[CYCLE_PHASES]) const {
+    // Same targets as moveToStartPosition(), performCuttingPass(),
+    // retractTool() and returnToStart() for this pass
+    long depth = (cutDepth * (pass + 1)) / numPasses;
+    int32_t x0 = touchOffX;
+    int32_t z0 = touchOffZ;
+    int32_t safeX = parkingPositionSet ? parkingPositionX : touchOffX;
+    int32_t zSign = (currentMode == MODE_TURN ? isLeftToRight : motionControl->getDupr() >= 0) ? 1 : -1;
+    
+    phases[SUBSTATE_MOVE_TO_START] = {CYCLE_POSITION, CYCLE_GROUP_MOVE, {true, true}, {x0, z0}};
+    phases[SUBSTATE_SYNC_SPINDLE] = {CYCLE_SPINDLE_WAIT, CYCLE_GROUP_MOVE, {false, false}, {0, 0}};
+    phases[SUBSTATE_CUTTING] = {CYCLE_GEARED, CYCLE_GROUP_CUT, {false, true},
+                                {x0, (int32_t)(z0 + zSign * labs(cutLength))}};
+    phases[SUBSTATE_RETRACTING] = {CYCLE_POSITION, CYCLE_GROUP_MOVE, {true, false}, {safeX, 0}};
+    phases[SUBSTATE_RETURNING] = {CYCLE_POSITION, CYCLE_GROUP_MOVE, {false, true}, {0, z0}};
+    
+    if (currentMode == MODE_FACE) {
+        // Positioned cut across the face, no gearing
+        if (parkingPositionSet) {
+            phases[SUBSTATE_MOVE_TO_START].target[AXIS_X] = parkingPositionX;
+            phases[SUBSTATE_MOVE_TO_START].target[AXIS_Z] = parkingPositionZ;
+        }
+        phases[SUBSTATE_CUTTING] = {CYCLE_POSITION, CYCLE_GROUP_CUT, {true, true},
+                                    {(int32_t)(x0 - cutLength), (int32_t)(z0 - depth)}};
+    } else if (currentMode == MODE_CUT) {
+        // Plunge geared to the spindle, straight back out, no sync or retract
+        phases[SUBSTATE_SYNC_SPINDLE].kind = CYCLE_NONE;
+        phases[SUBSTATE_CUTTING] = {CYCLE_GEARED, CYCLE_GROUP_CUT, {true, false}, {(int32_t)(x0 - cutDepth), 0}};
+        phases[SUBSTATE_RETRACTING].kind = CYCLE_NONE;
+        phases[SUBSTATE_RETURNING] = {CYCLE_POSITION, CYCLE_GROUP_MOVE, {true, false}, {x0, 0}};
+    }
+}
+
+void OperationManager::cycleMachine(CycleMachine& machine) const {
+    for (int axis = 0; axis < 2; axis++) {
+        machine.duPerStep[axis] = (float)motionControl->getScrewPitch(axis) / motionControl->getMotorSteps(axis);
+        machine.maxSpeed[axis] = motionControl->getMaxSpeed(axis);
+        machine.startSpeed[axis] = axis == AXIS_X ? SPEED_START_X : SPEED_START_Z;
+        machine.acceleration[axis] = motionControl->getAcceleration(axis);
+    }
+    machine.rpm = abs(motionControl->getSpindleRPM());
+    machine.dupr = currentState == STATE_RUNNING ? opDupr : motionControl->getDupr();
+    machine.feedScale = isFeedOverrideLocked() ? 1.0f : feedOverride.getFeedScale();
+    machine.rapidScale = feedOverride.getRapidScale();
+}
+
+void OperationManager::updateCycle() {
+    bool running = currentState == STATE_RUNNING && isJobMode(currentMode);
+    bool ready = currentState == STATE_READY && canCaptureSetup() && numPasses > 0;
+    uint32_t now = millis();
+    
+    // Pass timing: a phase starts on every substate change, a pass ends
+    // when the next one starts or the operation runs to its end
+    if (!running) {
+        if (cycleTracking && completedCount != trackedCompleted) {
+            estimator.endPass(now);
+        }
+        cycleTracking = false;
+    } else if (!cycleTracking || currentPass != trackedPass || passSubState != trackedSubState) {
+        if (!cycleTracking) {
+            estimator.beginPass();
+            trackedCompleted = completedCount;
+        } else if (currentPass != trackedPass) {
+            estimator.endPass(now);
+        }
+        cycleTracking = true;
+        trackedPass = currentPass;
+        trackedSubState = passSubState;
+        
+        CycleMachine machine;
+        cycleMachine(machine);
+        CyclePhase phases[CYCLE_PHASES];
+        passPhases(currentPass, phases);
+        int32_t pos[2] = {motionControl->getAxisPosition(AXIS_X), motionControl->getAxisPosition(AXIS_Z)};
+        const CyclePhase& phase = phases[passSubState];
+        estimator.beginPhase(phase.group, CycleEstimator::phaseSeconds(phase, pos, machine), now);
+    }
+    
+    // Remaining time, from the tool position through the last pass
+    if (!running && !ready) {
+        cycleEstimate.valid = false;
+        return;
+    }
+    if (cycleEstimate.valid && now - cycleEstimateMs < CYCLE_UPDATE_MS) {
+        return;
+    }
+    cycleEstimateMs = now;
+    
+    CycleMachine machine;
+    cycleMachine(machine);
+    CyclePhase phases[CYCLE_PHASES];
+    int pass = running ? currentPass : 0;
+    int first = running ? passSubState : SUBSTATE_MOVE_TO_START;
+    passPhases(pass, phases);
+    int32_t pos[2] = {motionControl->getAxisPosition(AXIS_X), motionControl->getAxisPosition(AXIS_Z)};
+    
+    // A geared cut ends on the distance travelled, whichever way the
+    // spindle turns, so count what is left of it rather than the target
+    const CyclePhase& current = phases[first];
+    if (running && current.kind == CYCLE_GEARED) {
+        const long origin[2] = {touchOffX, touchOffZ};
+        for (int axis = 0; axis < 2; axis++) {
+            if (!current.moves[axis]) continue;
+            long length = current.target[axis] - origin[axis];
+            long left = max(0L, labs(length) - labs((long)pos[axis] - origin[axis]));
+            pos[axis] = current.target[axis] - (length >= 0 ? left : -left);
+        }
+    }
+    
+    float passSeconds = estimator.remaining(phases, first, CYCLE_PHASES, pos, machine);
+    float totalSeconds = passSeconds;
+    cycleEstimate.maxRpm = CycleEstimator::maxRpm(phases[SUBSTATE_CUTTING], machine);
+    for (int p = pass + 1; p < numPasses && totalSeconds >= 0; p++) {
+        passPhases(p, phases);
+        float seconds = estimator.remaining(phases, SUBSTATE_MOVE_TO_START, CYCLE_PHASES, pos, machine);
+        totalSeconds = seconds < 0 ? CYCLE_UNKNOWN : totalSeconds + seconds;
+    }
+    
+    cycleEstimate.passSeconds = passSeconds;
+    cycleEstimate.totalSeconds = totalSeconds;
+    for (int g = 0; g < CYCLE_GROUPS; g++) {
+        cycleEstimate.factor[g] = estimator.getFactor((CycleGroup)g);
+    }
+    cycleEstimate.passesLearnt = estimator.getPassesLearnt();
+    cycleEstimate.valid = true;
 }
 
 void OperationManager::executeNormalMode() {
@@ -939,7 +1224,7 @@ void OperationManager::executeTurnMode() {
         case SUBSTATE_SYNC_SPINDLE:
             if (waitForSpindleSync()) {
                 // Reset spindle reference for this pass
-                spindleSyncPos = motionControl->getSpindlePosition();
+                startSpindleFollow();
                 passSubState = SUBSTATE_CUTTING;
             }
             break;
@@ -963,6 +1248,7 @@ void OperationManager::executeTurnMode() {
                     passSubState = SUBSTATE_MOVE_TO_START;
                 } else {
                     // Operation complete
+                    completedCount++;
                     stopOperation();
                 }
             }
@@ -995,7 +1281,7 @@ void OperationManager::executeCutMode() {
             
         case SUBSTATE_SYNC_SPINDLE:
             // Set spindle sync position
-            spindleSyncPos = motionControl->getSpindlePosition();
+            startSpindleFollow();
             passSubState = SUBSTATE_CUTTING;
             break;
             
@@ -1013,6 +1299,7 @@ void OperationManager::executeCutMode() {
                     currentPass++;
                     passSubState = SUBSTATE_MOVE_TO_START;
                 } else {
+                    completedCount++;
                     stopOperation();
                 }
             }
@@ -1159,6 +1446,30 @@ String OperationManager::getPromptText() {
         }
     }
     
+    if (currentMode == MODE_GCODE) {
+        if (currentState == STATE_RUNNING) {
+            if (gcodeInterpreter.getState() == GCODE_STATE_PAUSED) {
+                return "M0 - ENTER resumes";
+            }
+            if (gcodeInterpreter.isWaitingForSpindle()) {
+                return "Start spindle";
+            }
+            return "Line " + String(gcodeInterpreter.getLineNumber());
+        }
+        if (gcodeInterpreter.getState() == GCODE_STATE_ERROR) {
+            return gcodeInterpreter.getErrorText();
+        }
+        const char* name = gcodeInterpreter.getProgramName();
+        switch (setupIndex) {
+            case 0:
+                return name[0] ? "Run " + String(name) + "?" : String("Run web stream?");
+            case 1:
+                return "Work zero set?";
+            default:
+                return "Go?";
+        }
+    }
+    
     // Handle other modes
     if (isPassMode()) {
         // Other pass modes can use similar structure
@@ -1232,9 +1543,13 @@ void OperationManager::executeEllipseMode() {
 }
 
 void OperationManager::executeGcodeMode() {
-    // TODO: Implement G-code execution functionality
-    // Requires file management and G-code parser integration
-    // Should coordinate with web interface for program selection
+    // Stored and streamed programs both run through the interpreter
+    gcodeInterpreter.update();
+    if (!gcodeInterpreter.isActive()) {
+        // End of program, M2/M30 or an error (kept for the prompt)
+        currentState = STATE_IDLE;
+        setArrowKeyMode(ARROW_MOTION_MODE);
+    }
 }
 
 // ===== NEW SIMPLIFIED VARIABLE PARKING WORKFLOW METHODS =====
@@ -2,6 +2,7 @@
 #define OPERATION_MANAGER_H
 
 #include <Arduino.h>
+#include "CycleEstimator.h"
 
 // h5.ino-compatible measurement units
 #define MEASURE_METRIC 0
@@ -65,6 +66,30 @@ enum PassSubState {
     SUBSTATE_RETURNING        // Returning for next pass
 };
 
+// Everything an operation needs to start without going through the setup
+// steps again: captured after a part was set up by hand, stored in a job
+// (see JobQueue) and applied for every following part
+struct OperationSetup {
+    OperationMode mode;
+    bool internal;             // Internal/external
+    bool leftToRight;
+    long dupr;                 // Pitch or feed, deci-microns per revolution
+    int starts;
+    long targetDiameter;       // Deci-microns
+    long targetZLength;
+    long cutLength;            // Steps
+    long cutDepth;
+    int passes;
+    float coneRatio;
+    long touchOffX;            // Axis position at touch-off, steps
+    long touchOffZ;
+    float touchOffXCoord;      // Coordinate entered at touch-off, mm
+    float touchOffZCoord;
+    bool parkingSet;
+    long parkingX;             // Steps
+    long parkingZ;
+};
+
 class MinimalMotionControl; // Forward declaration
 
 class OperationManager {
@@ -127,7 +152,19 @@ private:
     
     // Synchronization
     long spindleSyncPos;  // Spindle position for synchronization
+    int64_t feedSpindle;  // Spindle travel since sync x feed override, 1/1024 counts
+    long feedSpindleLast; // Spindle position feedSpindle was last advanced to
     int startOffset;      // Multi-start thread offset
+    uint32_t completedCount; // Operations that ran to their end (not stopped)
+    
+    // Cycle time estimate for pass modes, refreshed every CYCLE_UPDATE_MS
+    CycleEstimator estimator;
+    CycleEstimate cycleEstimate;
+    uint32_t cycleEstimateMs;
+    bool cycleTracking;           // Phase timing of a running operation
+    int trackedPass;
+    PassSubState trackedSubState;
+    uint32_t trackedCompleted;
     
     // Safe distance for retraction (0.5mm default)
     static const long SAFE_DISTANCE_DU = 5000; // 0.5mm in deci-microns
@@ -141,6 +178,14 @@ private:
     // Spindle synchronization (h5.ino style)
     long posFromSpindle(int axis, long spindlePos, bool respectLimits);
     long spindleFromPos(int axis, long pos);
+    void startSpindleFollow();          // Spindle reference for the next cut
+    long feedSpindleDelta();            // Spindle travel to follow, feed override applied
+    float axisSpeedScale() const;       // Rapid override for the current substate
+    
+    // Cycle time estimate
+    void passPhases(int pass, CyclePhase phases[CYCLE_PHASES]) const;  // Pass geometry in substate order
+    void cycleMachine(CycleMachine& machine) const;
+    void updateCycle();                 // Phase timing and remaining time, every update()
     
     // Operation execution helpers
     void executeNormalMode();
@@ -260,6 +305,13 @@ public:
     void pauseOperation();    // Pause at safe point
     void resumeOperation();   // Resume from pause
     void advancePass();       // Move to next pass (manual advance)
+    uint32_t getCompletedCount() const { return completedCount; }
+    
+    // Setup capture for jobs (modes that finish on their own only)
+    bool canCaptureSetup() const;
+    bool captureSetup(OperationSetup& setup) const;   // Current mode, targets, touch-off, pitch, parking
+    bool applySetup(const OperationSetup& setup);     // Ready to start, as if set up by hand
+    static bool isJobMode(OperationMode mode);
     
     // Setup state machine
     void nextSetupStep();     // Advance setup state
@@ -281,6 +333,7 @@ public:
     String getStatusText();   // Get current status for display
     String getPromptText();   // Get setup prompt for display
     float getProgress();      // Get operation progress (0-1)
+    const CycleEstimate& getCycleEstimate() const { return cycleEstimate; }  // Remaining time, pass modes
     int getCurrentPass() const { return currentPass; }
     int getTotalPasses() const { return numPasses; }
     
@@ -291,6 +344,7 @@ public:
     float getTouchOffXCoord() const { return touchOffXCoord; }
     float getTouchOffZCoord() const { return touchOffZCoord; }
     bool isRunning() const { return currentState == STATE_RUNNING; }
+    bool isFeedOverrideLocked() const;  // Spindle-synchronised motion ignores the feed override
     int getCurrentMeasure() const { return currentMeasure; }  // Get current measurement unit
 };
 
@@ -2,6 +2,7 @@
 #include "MinimalMotionControl.h"
 #include "NextionDisplay.h"
 #include "WebInterface.h"
+#include "WebBridge.h"
 #include "SetupConstants.h"
 #include <PS2KeyAdvanced.h>
 
@@ -247,9 +248,12 @@ void SystemStateMachine::handleEmergencyCheck() {
 }
 
 void SystemStateMachine::handleKeyboardScan() {
-    // Full keyboard handling - now calls processKeypadEvent directly
+    // Keyboard scan and Nextion touch feed the input event queue, then dispatch drains it
     extern void processKeypadEvent();
+    extern void processInputEvents();
     processKeypadEvent();
+    nextionDisplay.receive();
+    processInputEvents();
 }
 
 void SystemStateMachine::handleMotionUpdate() {
@@ -263,6 +267,7 @@ void SystemStateMachine::handleDisplayUpdate() {
     // Limit display updates to 20Hz
     if (currentTime - lastDisplayUpdate >= 50) {
         nextionDisplay.update();
+        nextionDisplay.flush();
         lastDisplayUpdate = currentTime;
     }
 }
@@ -271,9 +276,12 @@ void SystemStateMachine::handleWebUpdate() {
     static uint32_t lastWebUpdate = 0;
     uint32_t currentTime = millis();
     
-    // Limit web updates to 50Hz
-    if (currentTime - lastWebUpdate >= 20) {
-        webInterface.update();
+    // Limit web updates to 100Hz (max telemetry rate) - the servers run in
+    // their own task, this only exchanges state with it
+    if (currentTime - lastWebUpdate >= 10) {
+        webBridge.publishSnapshot();
+        webBridge.processCommands();
+        webInterface.showWiFiChanges();
         lastWebUpdate = currentTime;
     }
 }
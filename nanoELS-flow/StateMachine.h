@@ -46,8 +46,10 @@ struct ScheduledTask {
 };
 
 class TimeSlicedScheduler {
-private:
+public:
     static const int MAX_TASKS = 10;
+    
+private:
     ScheduledTask tasks[MAX_TASKS];
     int taskCount;
     uint32_t loopCount;
@@ -73,6 +75,9 @@ public:
     void printDiagnostics();
     uint32_t getLoopFrequency();
     uint32_t getMaxLoopTime() { return maxLoopTime_us; }
+    uint32_t getAvgLoopTime() { return loopCount > 0 ? totalLoopTime_us / loopCount : 0; }
+    int getTaskCount() const { return taskCount; }
+    const ScheduledTask& getTask(int i) const { return tasks[i]; }
     
     // Emergency override - forces immediate execution of critical tasks
     void executeEmergencyTasks();
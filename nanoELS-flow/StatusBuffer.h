@@ -0,0 +1,71 @@
+#ifndef STATUSBUFFER_H
+#define STATUSBUFFER_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+/**
+ * StatusBuffer - Fixed text buffer for rendered status pages
+ *
+ * A page is rendered into the buffer with printf() calls and then served
+ * as is until it is older than the refresh interval, so any number of
+ * requests costs one render per interval and no heap.
+ *
+ * Features:
+ * - Static storage, no String
+ * - A line that does not fit is dropped whole and the page marked truncated
+ * - Single user (web task) - not thread safe
+ */
+template<size_t N>
+class StatusBuffer {
+private:
+    char data[N];
+    size_t len;
+    bool truncated;
+    bool rendered;
+    uint32_t renderedMs;
+
+public:
+    StatusBuffer() : len(0), truncated(false), rendered(false), renderedMs(0) {
+        data[0] = '\0';
+    }
+
+    // True when the page has never been rendered or is older than maxAgeMs
+    bool isStale(uint32_t nowMs, uint32_t maxAgeMs) const {
+        return !rendered || nowMs - renderedMs >= maxAgeMs;
+    }
+
+    void begin() {
+        len = 0;
+        truncated = false;
+        data[0] = '\0';
+    }
+
+    void printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (truncated) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(data + len, N - len, format, args);
+        va_end(args);
+        if (n < 0 || (size_t)n >= N - len) {
+            data[len] = '\0';  // Drop the partial write
+            truncated = true;
+            return;
+        }
+        len += n;
+    }
+
+    void end(uint32_t nowMs) {
+        rendered = true;
+        renderedMs = nowMs;
+    }
+
+    const char* c_str() const { return data; }
+    size_t length() const { return len; }
+    bool isTruncated() const { return truncated; }
+    static constexpr size_t capacity() { return N; }
+};
+
+#endif // STATUSBUFFER_H
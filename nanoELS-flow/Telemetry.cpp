@@ -0,0 +1,139 @@
+#include "Telemetry.h"
+#include "FeedOverride.h"
+#include "JobQueue.h"
+#include "MinimalMotionControl.h"
+#include "OperationManager.h"
+
+extern OperationManager operationManager;
+
+// Little-endian and varint writers - all return the new write position
+static uint8_t* putU16(uint8_t* p, uint16_t v) {
+    *p++ = v & 0xFF;
+    *p++ = v >> 8;
+    return p;
+}
+
+static uint8_t* putU32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        *p++ = v & 0xFF;
+        v >>= 8;
+    }
+    return p;
+}
+
+static uint8_t* putVarint(uint8_t* p, uint32_t v) {
+    while (v >= 0x80) {
+        *p++ = (v & 0x7F) | 0x80;
+        v >>= 7;
+    }
+    *p++ = v;
+    return p;
+}
+
+// Zigzag keeps small negative deltas small: 0,-1,1,-2,... -> 0,1,2,3,...
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+TelemetryEncoder::TelemetryEncoder()
+    : keyFrameLen(0), framesBuilt(0), keyFramesSent(0), deltaFramesSent(0), bytesSent(0) {
+    memset(&current, 0, sizeof(current));
+}
+
+void TelemetryEncoder::capture(TelemetrySample& sample) {
+    sample.timestampUs = micros();
+
+    uint8_t flags = 0;
+    if (motionControl.getEmergencyStop()) flags |= TELEMETRY_FLAG_ESTOP;
+    if (motionControl.isMoving(AXIS_X)) flags |= TELEMETRY_FLAG_X_MOVING;
+    if (motionControl.isMoving(AXIS_Z)) flags |= TELEMETRY_FLAG_Z_MOVING;
+    if (motionControl.isAxisEnabled(AXIS_X)) flags |= TELEMETRY_FLAG_X_ENABLED;
+    if (motionControl.isAxisEnabled(AXIS_Z)) flags |= TELEMETRY_FLAG_Z_ENABLED;
+    if (motionControl.isThreadingActive()) flags |= TELEMETRY_FLAG_THREADING;
+    sample.flags = flags;
+
+    int32_t* v = sample.values;
+    v[TELEMETRY_POS_X] = motionControl.getPosition(AXIS_X);
+    v[TELEMETRY_POS_Z] = motionControl.getPosition(AXIS_Z);
+    v[TELEMETRY_TARGET_X] = motionControl.getTargetPosition(AXIS_X);
+    v[TELEMETRY_TARGET_Z] = motionControl.getTargetPosition(AXIS_Z);
+    v[TELEMETRY_SPINDLE] = motionControl.getSpindlePosition();
+    v[TELEMETRY_RPM] = motionControl.getSpindleRPM();
+
+    // Following error only means something while the spindle drives the axes
+    if (motionControl.isThreadingActive()) {
+        v[TELEMETRY_FOLLOW_ERR_X] = lroundf(motionControl.getFollowingError(AXIS_X) * 10.0f);
+        v[TELEMETRY_FOLLOW_ERR_Z] = lroundf(motionControl.getFollowingError(AXIS_Z) * 10.0f);
+    } else {
+        v[TELEMETRY_FOLLOW_ERR_X] = 0;
+        v[TELEMETRY_FOLLOW_ERR_Z] = 0;
+    }
+
+    v[TELEMETRY_MODE] = operationManager.getMode();
+    v[TELEMETRY_STATE] = operationManager.getState();
+    v[TELEMETRY_PASS] = operationManager.getCurrentPass();
+    v[TELEMETRY_PASSES] = operationManager.getTotalPasses();
+    v[TELEMETRY_FEED_OVERRIDE] = feedOverride.getFeedPercent();
+    v[TELEMETRY_RAPID_OVERRIDE] = feedOverride.getRapidPercent();
+
+    JobStatus job;
+    jobQueue.getStatus(job);
+    v[TELEMETRY_JOB_PARTS] = job.parts;
+    v[TELEMETRY_JOB_PART_MS] = job.partMs;
+}
+
+void TelemetryEncoder::encodeKeyFrame() {
+    uint8_t* p = keyFrame;
+    *p++ = TELEMETRY_KEY_FRAME;
+    *p++ = current.flags;
+    p = putU32(p, 0);  // seq, filled in per client
+    p = putU32(p, current.timestampUs);
+    *p++ = TELEMETRY_FIELD_COUNT;
+    for (int i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+        p = putU32(p, (uint32_t)current.values[i]);
+    }
+    keyFrameLen = p - keyFrame;
+}
+
+size_t TelemetryEncoder::getKeyFrame(uint32_t seq, uint8_t* out) const {
+    memcpy(out, keyFrame, keyFrameLen);
+    putU32(out + 2, seq);
+    return keyFrameLen;
+}
+
+size_t TelemetryEncoder::getDeltaFrame(const TelemetrySample& base, uint32_t seq, uint8_t* out) const {
+    uint8_t* p = out;
+    *p++ = TELEMETRY_DELTA_FRAME;
+    *p++ = current.flags;
+    p = putU32(p, seq);
+    p = putVarint(p, current.timestampUs - base.timestampUs);
+
+    // Reserve the mask, fill it while writing the changed fields
+    uint8_t* maskPos = p;
+    p += 2;
+    uint16_t mask = 0;
+    for (int i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+        int32_t diff = current.values[i] - base.values[i];
+        if (diff != 0) {
+            mask |= (1u << i);
+            p = putVarint(p, zigzag(diff));
+        }
+    }
+    putU16(maskPos, mask);
+    return p - out;
+}
+
+void TelemetryEncoder::build(const TelemetrySample& sample) {
+    current = sample;
+    framesBuilt++;
+    encodeKeyFrame();
+}
+
+void TelemetryEncoder::recordSent(bool delta, size_t len) {
+    if (delta) {
+        deltaFramesSent++;
+    } else {
+        keyFramesSent++;
+    }
+    bytesSent += len;
+}
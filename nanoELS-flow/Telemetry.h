@@ -0,0 +1,118 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+/**
+ * TelemetryEncoder - Compact binary machine state for WebSocket clients
+ *
+ * One sample of the controller state is captured by the controller (see
+ * WebBridge) and handed to the web task, which encodes the self-contained
+ * key frame once per tick. Delta frames are encoded per client against the
+ * sample that client last received, so a 10 Hz client next to a 100 Hz one
+ * still gets deltas. A client that missed a frame (send failed, just
+ * subscribed) gets a key frame.
+ *
+ * Features:
+ * - No heap allocation, no text formatting
+ * - Deltas are zigzag varints with a bitmask of changed fields
+ * - Integer units only (steps, encoder counts, deci-microns, rpm)
+ *
+ * seq numbers the frames sent on one connection, so a delta applies to the
+ * values decoded from frame seq - 1.
+ *
+ * Wire format (little-endian):
+ *   Key frame:   0x01 flags seq:u32 timestampUs:u32 count:u8 value:i32 x count
+ *   Delta frame: 0x02 flags seq:u32 dtUs:varint mask:u16 zigzag-varint x popcount(mask)
+ */
+
+// Frame types
+#define TELEMETRY_KEY_FRAME 0x01
+#define TELEMETRY_DELTA_FRAME 0x02
+
+// Flag bits
+#define TELEMETRY_FLAG_ESTOP      0x01
+#define TELEMETRY_FLAG_X_MOVING   0x02
+#define TELEMETRY_FLAG_Z_MOVING   0x04
+#define TELEMETRY_FLAG_X_ENABLED  0x08
+#define TELEMETRY_FLAG_Z_ENABLED  0x10
+#define TELEMETRY_FLAG_THREADING  0x20
+
+// Client rate limits
+#define TELEMETRY_MIN_HZ 1
+#define TELEMETRY_MAX_HZ 100
+
+// Field order is part of the wire format - append only
+enum TelemetryField {
+    TELEMETRY_POS_X = 0,        // steps
+    TELEMETRY_POS_Z,            // steps
+    TELEMETRY_TARGET_X,         // steps
+    TELEMETRY_TARGET_Z,         // steps
+    TELEMETRY_SPINDLE,          // encoder counts
+    TELEMETRY_RPM,              // signed rpm
+    TELEMETRY_FOLLOW_ERR_X,     // deci-microns
+    TELEMETRY_FOLLOW_ERR_Z,     // deci-microns
+    TELEMETRY_MODE,             // OperationMode
+    TELEMETRY_STATE,            // OperationState
+    TELEMETRY_PASS,             // current pass (0-based)
+    TELEMETRY_PASSES,           // total passes
+    TELEMETRY_FEED_OVERRIDE,    // percent
+    TELEMETRY_RAPID_OVERRIDE,   // percent
+    TELEMETRY_JOB_PARTS,        // parts completed in the job
+    TELEMETRY_JOB_PART_MS,      // current part elapsed while running, else the last part
+    TELEMETRY_FIELD_COUNT
+};
+
+// Delta frames carry a 16-bit field mask
+static_assert(TELEMETRY_FIELD_COUNT <= 16, "telemetry delta mask is 16 bits");
+
+struct TelemetrySample {
+    uint32_t timestampUs;
+    uint8_t flags;
+    int32_t values[TELEMETRY_FIELD_COUNT];
+};
+
+class TelemetryEncoder {
+public:
+    // Worst case: 1 + 1 + 4 + 5 + 2 + 5 per field
+    static const size_t MAX_FRAME_SIZE = 13 + 5 * TELEMETRY_FIELD_COUNT;
+
+private:
+    TelemetrySample current;
+    uint8_t keyFrame[MAX_FRAME_SIZE];
+    size_t keyFrameLen;
+
+    // Statistics
+    uint32_t framesBuilt;
+    uint32_t keyFramesSent;
+    uint32_t deltaFramesSent;
+    uint32_t bytesSent;
+
+    void encodeKeyFrame();
+
+public:
+    TelemetryEncoder();
+
+    // Read the controller state - controller task only
+    static void capture(TelemetrySample& sample);
+
+    // Take a new sample and encode its key frame (once per tick)
+    void build(const TelemetrySample& sample);
+
+    // Frames for the sample passed to the last build(), written to out
+    // (MAX_FRAME_SIZE bytes); seq is the client's frame number
+    const TelemetrySample& getSample() const { return current; }
+    size_t getKeyFrame(uint32_t seq, uint8_t* out) const;
+    size_t getDeltaFrame(const TelemetrySample& base, uint32_t seq, uint8_t* out) const;
+
+    // Called by the transport for accounting
+    void recordSent(bool delta, size_t len);
+
+    // Statistics
+    uint32_t getFramesBuilt() const { return framesBuilt; }
+    uint32_t getKeyFramesSent() const { return keyFramesSent; }
+    uint32_t getDeltaFramesSent() const { return deltaFramesSent; }
+    uint32_t getBytesSent() const { return bytesSent; }
+};
+
+#endif // TELEMETRY_H
@@ -0,0 +1,199 @@
+#include "WebBridge.h"
+#include "FeedOverride.h"
+#include "GCodeInterpreter.h"
+#include "JobQueue.h"
+#include "MinimalMotionControl.h"
+#include "OperationManager.h"
+
+extern OperationManager operationManager;
+
+// Global instance
+WebBridge webBridge;
+
+WebBridge::WebBridge() : commandsDropped(0), stopRequested(false), releaseRequested(false) {
+    snapshotLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&snapshot, 0, sizeof(snapshot));
+}
+
+void WebBridge::publishSnapshot() {
+    // Capture outside the lock, then publish with a short copy
+    ControllerSnapshot fresh;
+    TelemetryEncoder::capture(fresh.sample);
+    fresh.spindlePositionAvg = motionControl.getSpindlePositionAvg();
+    fresh.currentSpeed[AXIS_X] = motionControl.getCurrentSpeed(AXIS_X);
+    fresh.currentSpeed[AXIS_Z] = motionControl.getCurrentSpeed(AXIS_Z);
+    fresh.publishedMs = millis();
+    jobQueue.getStatus(fresh.job);
+    fresh.cycle = operationManager.getCycleEstimate();
+    for (int axis = 0; axis < 2; axis++) {
+        fresh.maxSpeed[axis] = motionControl.getMaxSpeed(axis);
+        fresh.acceleration[axis] = motionControl.getAcceleration(axis);
+        motionControl.getSoftLimits(axis, fresh.leftStop[axis], fresh.rightStop[axis]);
+    }
+
+    fresh.loopFrequency = scheduler.getLoopFrequency();
+    fresh.maxLoopUs = scheduler.getMaxLoopTime();
+    fresh.avgLoopUs = scheduler.getAvgLoopTime();
+    fresh.taskCount = scheduler.getTaskCount();
+    for (int i = 0; i < fresh.taskCount; i++) {
+        const ScheduledTask& task = scheduler.getTask(i);
+        fresh.tasks[i] = {task.name, task.interval_ms, task.execution_count, task.max_duration_us};
+    }
+
+    portENTER_CRITICAL(&snapshotLock);
+    snapshot = fresh;
+    portEXIT_CRITICAL(&snapshotLock);
+}
+
+void WebBridge::readSnapshot(ControllerSnapshot& out) {
+    portENTER_CRITICAL(&snapshotLock);
+    out = snapshot;
+    portEXIT_CRITICAL(&snapshotLock);
+}
+
+bool WebBridge::postCommand(WebCommandType type, uint8_t axis, int32_t value) {
+    WebCommand command = {type, axis, value, ""};
+    if (!commands.push(command)) {
+        commandsDropped = commandsDropped + 1;
+        return false;
+    }
+    return true;
+}
+
+bool WebBridge::postNamed(WebCommandType type, const char* name, size_t len, int32_t value) {
+    if (len >= GCODE_INDEX_NAME_LEN) {
+        return false;
+    }
+    WebCommand command = {type, 0, value, ""};
+    memcpy(command.name, name, len);
+    command.name[len] = '\0';
+    if (!commands.push(command)) {
+        commandsDropped = commandsDropped + 1;
+        return false;
+    }
+    return true;
+}
+
+WebEmergencyRequest WebBridge::takeEmergencyRequest() {
+    // Both pending means stop and release raced within one loop: stay stopped
+    bool stop = stopRequested.exchange(false);
+    bool release = releaseRequested.exchange(false);
+    if (stop) {
+        return WEB_ESTOP_STOP;
+    }
+    return release ? WEB_ESTOP_RELEASE : WEB_ESTOP_NONE;
+}
+
+bool WebBridge::postLoadedJob(const JobTable& table, JobFileResult result) {
+    // Table first, so it is there when the controller sees the command
+    if (result == JOB_FILE_OK && !loadedJobs.push(table)) {
+        commandsDropped = commandsDropped + 1;
+        return false;
+    }
+    return postCommand(WEB_CMD_JOB_LOADED, 0, result);
+}
+
+void WebBridge::processCommands() {
+    WebCommand command;
+    while (commands.pop(command)) {
+        switch (command.type) {
+            case WEB_CMD_MOVE_RELATIVE:
+                if (command.axis < 2) {
+                    motionControl.moveRelative(command.axis, command.value);
+                }
+                break;
+
+            case WEB_CMD_SET_PITCH:
+                // Never change the gear ratio under a running cut
+                if (!operationManager.isRunning()) {
+                    motionControl.setThreadPitch(command.value);
+                }
+                break;
+
+            case WEB_CMD_STOP_OPERATION:
+                if (operationManager.isRunning()) {
+                    operationManager.stopOperation();
+                }
+                break;
+
+            case WEB_CMD_SELECT_PROGRAM:
+                // Refused while a program runs; takes effect on the next start
+                gcodeInterpreter.selectProgram(command.name);
+                break;
+
+            case WEB_CMD_FEED_OVERRIDE:
+                feedOverride.setFeed(command.value);
+                break;
+
+            case WEB_CMD_RAPID_OVERRIDE:
+                feedOverride.setRapid(command.value);
+                break;
+
+            // Outcome reaches the web UI through the job status in the snapshot
+            case WEB_CMD_JOB_ADD:
+                jobQueue.addCurrentSetup();
+                break;
+
+            case WEB_CMD_JOB_CLEAR:
+                jobQueue.clear();
+                break;
+
+            case WEB_CMD_JOB_SAVE: {
+                // The web task writes it and answers with WEB_CMD_JOB_SAVED
+                static JobTable table;
+                jobQueue.getTable(table);
+                strcpy(table.name, command.name);
+                if (!jobsToSave.push(table)) {
+                    jobQueue.finishSave(command.name, JOB_FILE_WRITE_FAILED);
+                }
+                break;
+            }
+
+            case WEB_CMD_JOB_SAVED:
+                jobQueue.finishSave(command.name, (JobFileResult)command.value);
+                break;
+
+            case WEB_CMD_JOB_LOADED: {
+                // The newest table belongs to this command; older ones were
+                // left behind by a load whose command did not fit the queue
+                static JobTable table;
+                bool loaded = false;
+                while (loadedJobs.pop(table)) {
+                    loaded = true;
+                }
+                jobQueue.finishLoad(loaded ? &table : nullptr, (JobFileResult)command.value);
+                break;
+            }
+
+            case WEB_CMD_JOB_RUN:
+                jobQueue.runPart();
+                break;
+
+            case WEB_CMD_JOB_STOP:
+                jobQueue.stop();
+                break;
+        }
+    }
+}
+
+String WebBridge::formatStatusReport(const ControllerSnapshot& s) {
+    const int32_t* v = s.sample.values;
+    uint8_t flags = s.sample.flags;
+
+    String report = "MinimalMotionControl Status:\n";
+    report += "Threading: " + String((flags & TELEMETRY_FLAG_THREADING) ? "ACTIVE" : "INACTIVE") + "\n";
+    report += "Spindle: " + String(s.spindlePositionAvg) + " (raw: " + String(v[TELEMETRY_SPINDLE]) + ")\n";
+
+    for (int i = 0; i < 2; i++) {
+        char axisName = (i == AXIS_X) ? 'X' : 'Z';
+        bool enabled = flags & (i == AXIS_X ? TELEMETRY_FLAG_X_ENABLED : TELEMETRY_FLAG_Z_ENABLED);
+        bool moving = flags & (i == AXIS_X ? TELEMETRY_FLAG_X_MOVING : TELEMETRY_FLAG_Z_MOVING);
+        report += String(axisName) + ": pos=" + String(v[i == AXIS_X ? TELEMETRY_POS_X : TELEMETRY_POS_Z]);
+        report += " target=" + String(v[i == AXIS_X ? TELEMETRY_TARGET_X : TELEMETRY_TARGET_Z]);
+        report += " speed=" + String(s.currentSpeed[i]);
+        report += " " + String(enabled ? "EN" : "DIS");
+        report += " " + String(moving ? "MOV" : "STOP") + "\n";
+    }
+
+    return report;
+}
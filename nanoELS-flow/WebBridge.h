@@ -0,0 +1,140 @@
+#ifndef WEBBRIDGE_H
+#define WEBBRIDGE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "CircularBuffer.h"
+#include "CycleEstimator.h"
+#include "GCodeIndex.h"
+#include "JobQueue.h"
+#include "Telemetry.h"
+#include "StateMachine.h"
+
+/**
+ * WebBridge - The only path between the web task and the controller
+ *
+ * HTTP and WebSocket servers run in their own FreeRTOS task on the WiFi
+ * core, so a slow client can never delay the scheduler. They must not touch
+ * motion or operation state directly. Instead:
+ * - The controller publishes a snapshot of its state every web tick
+ * - The web task copies the latest snapshot when it needs data
+ * - The web task posts commands to a lock-free queue the controller drains
+ * - Job files are read and written by the web task: tables to save and
+ *   loaded tables travel through their own small rings
+ * - E-stop and release skip that queue: they set a flag the emergency
+ *   check reads every loop, so queued jogs can neither delay nor refuse them
+ *
+ * Key presses from the web UI keep using inputEvents (its own SPSC lane).
+ */
+
+// Commands the web task may ask the controller to execute
+enum WebCommandType : uint8_t {
+    WEB_CMD_MOVE_RELATIVE,       // axis, value = steps
+    WEB_CMD_SET_PITCH,           // value = dupr (deci-microns per revolution)
+    WEB_CMD_STOP_OPERATION,      // Stop a running operation, keep E-stop as is
+    WEB_CMD_SELECT_PROGRAM,      // name = stored program for G-code mode, "" = stream
+    WEB_CMD_FEED_OVERRIDE,       // value = percent
+    WEB_CMD_RAPID_OVERRIDE,      // value = percent
+    WEB_CMD_JOB_ADD,             // Append the operation set up by hand to the job
+    WEB_CMD_JOB_CLEAR,
+    WEB_CMD_JOB_SAVE,            // name = job file; the table goes to the web task to write
+    WEB_CMD_JOB_SAVED,           // name = job file, value = JobFileResult
+    WEB_CMD_JOB_LOADED,          // value = JobFileResult, table in the loaded job ring
+    WEB_CMD_JOB_RUN,             // Next part
+    WEB_CMD_JOB_STOP             // Stop the part in progress and leave the job
+};
+
+// Pending web E-stop request, see takeEmergencyRequest()
+enum WebEmergencyRequest : uint8_t {
+    WEB_ESTOP_NONE,
+    WEB_ESTOP_STOP,
+    WEB_ESTOP_RELEASE
+};
+
+struct WebCommand {
+    WebCommandType type;
+    uint8_t axis;
+    int32_t value;
+    char name[GCODE_INDEX_NAME_LEN];
+};
+
+// Scheduler timings for one task (current diagnostics window)
+struct SchedulerTaskStats {
+    const char* name;
+    uint32_t intervalMs;
+    uint32_t runs;
+    uint32_t maxUs;
+};
+
+// Controller state visible to the web task
+struct ControllerSnapshot {
+    TelemetrySample sample;
+    int32_t spindlePositionAvg;
+    uint32_t currentSpeed[2];
+    uint32_t publishedMs;
+    JobStatus job;
+    CycleEstimate cycle;
+
+    // Axis limits, for dry runs planned on the web task
+    uint32_t maxSpeed[2];        // steps/s
+    uint32_t acceleration[2];    // steps/s^2
+    int32_t leftStop[2];         // Soft limits, LONG_MAX / LONG_MIN = unset
+    int32_t rightStop[2];
+
+    // Scheduler timings
+    uint32_t loopFrequency;
+    uint32_t maxLoopUs;
+    uint32_t avgLoopUs;
+    uint8_t taskCount;
+    SchedulerTaskStats tasks[TimeSlicedScheduler::MAX_TASKS];
+};
+
+class WebBridge {
+private:
+    static const size_t COMMAND_QUEUE_SIZE = 16;
+    static const size_t JOB_TABLE_QUEUE_SIZE = 2;
+
+    ControllerSnapshot snapshot;
+    portMUX_TYPE snapshotLock;
+
+    // Web task produces, controller consumes
+    CircularBuffer<WebCommand, COMMAND_QUEUE_SIZE> commands;
+    volatile uint32_t commandsDropped;
+
+    // Job tables to save (controller to web task, captured in command order
+    // so a save right after an add includes it) and tables loaded
+    CircularBuffer<JobTable, JOB_TABLE_QUEUE_SIZE> jobsToSave;
+    CircularBuffer<JobTable, JOB_TABLE_QUEUE_SIZE> loadedJobs;
+
+    // Web task sets, controller clears
+    std::atomic<bool> stopRequested;
+    std::atomic<bool> releaseRequested;
+
+public:
+    WebBridge();
+
+    // Controller side (scheduler task)
+    void publishSnapshot();
+    void processCommands();
+    WebEmergencyRequest takeEmergencyRequest();   // Every loop; a stop wins over a release
+
+    // Web task side
+    void readSnapshot(ControllerSnapshot& out);
+    bool takeJobToSave(JobTable& table) { return jobsToSave.pop(table); }
+    void requestEmergencyStop() { stopRequested = true; }
+    void requestEmergencyRelease() { releaseRequested = true; }
+    bool postCommand(WebCommandType type, uint8_t axis = 0, int32_t value = 0);
+    bool postNamed(WebCommandType type, const char* name, size_t len, int32_t value = 0);
+    bool postLoadedJob(const JobTable& table, JobFileResult result);
+    bool postSelectProgram(const char* name, size_t len) { return postNamed(WEB_CMD_SELECT_PROGRAM, name, len); }
+    uint32_t getCommandsDropped() const { return commandsDropped; }
+    size_t getCommandsPending() const { return commands.size(); }
+
+    // Text form of a snapshot (same layout as MinimalMotionControl::getStatusReport)
+    static String formatStatusReport(const ControllerSnapshot& s);
+};
+
+// Global bridge instance
+extern WebBridge webBridge;
+
+#endif // WEBBRIDGE_H
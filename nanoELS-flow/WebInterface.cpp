@@ -1,4 +1,13 @@
 #include "WebInterface.h"
+#include "OperationManager.h"
+#include "FeedOverride.h"
+#include "GCodeBinary.h"
+#include "GCodeFeed.h"
+#include "GCodeSimulator.h"
+#include "JobQueue.h"
+#include "SetupConstants.h"
+#include <lwip/sockets.h>
+#include <stdarg.h>
 
 // Global instance
 WebInterface webInterface;
@@ -6,208 +15,213 @@ WebInterface webInterface;
 WebInterface::WebInterface() {
   webServer = nullptr;
   webSocket = nullptr;
-  wifiConnected = false;
+  memset(&wifiConfig, 0, sizeof(wifiConfig));
+  wifiState = WIFI_LINK_OFF;
+  apActive = false;
+  wifiGotIpEvent = false;
+  wifiDisconnectedEvent = false;
+  wifiAttemptStartMs = 0;
+  wifiRetryAtMs = 0;
+  wifiBackoffMs = WIFI_BACKOFF_MIN_MS;
+  wifiFailedAttempts = 0;
+  wifiIp = 0;
+  wifiChanges = 0;
+  wifiChangesShown = 0;
+  wifiUpMs = 0;
+  wifiReconnects = 0;
+  bootReadyMs = 0;
   webServerRunning = false;
+  webTaskHandle = nullptr;
+  webTaskStopRequested = false;
+  uploadBytes = 0;
+  uploadStartUs = 0;
+  uploadOk = false;
+  lastCommand[0] = '\0';
+  binaryCheckNext = -1;
+  consoleLen = 0;
+  
+  for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    resetClient(i, false);
+  }
+  nextClientToDrain = 0;
+  streamCreditsAdvertised = 0;
+  slowClientDisconnects = 0;
+  sendBudgetExhausted = 0;
+  maxSendTimeUs = 0;
 }
 
 WebInterface::~WebInterface() {
   stopWebServer();
 }
 
-bool WebInterface::initializeWiFi(const char* ssid, const char* password) {
-  Serial.println("Connecting to WiFi...");
-  Serial.print("SSID: ");
-  Serial.println(ssid);
-  
-  // Update Nextion display
-  nextionDisplay.setState(DISPLAY_STATE_WIFI_CONNECTING);
-  nextionDisplay.showWiFiStatus("Connecting to " + String(ssid), true);
-  
-  // Common fixes for home WiFi connection issues:
+void WebInterface::beginWiFi(const WiFiLinkConfig& config) {
+  wifiConfig = config;
+  WiFi.onEvent(onWiFiEvent);
   
-  // 1. Disconnect any previous connections
-  WiFi.disconnect(true);
-  delay(1000);
+  if (!config.stationMode) {
+    Serial.printf("Starting WiFi Access Point %s...\n", config.apSsid);
+    WiFi.mode(WIFI_AP);
+    startAccessPoint();
+    return;
+  }
   
-  // 2. Set WiFi mode explicitly to station mode
+  Serial.printf("Connecting to WiFi %s in the background...\n", config.ssid);
   WiFi.mode(WIFI_STA);
-  delay(100);
-  
-  // 3. Disable power saving mode (can cause connection issues)
-  WiFi.setSleep(false);
-  
-  // 4. Set hostname for network identification
+  WiFi.setSleep(false);                     // Power saving causes connection drops
   WiFi.setHostname("nanoELS-H5");
-  
-  // 5. Enable auto-reconnect
-  WiFi.setAutoReconnect(true);
-  WiFi.persistent(true);
-  
-  // 6. Optional: Set static DNS servers (helps with some routers)
-  // WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE, IPAddress(8,8,8,8), IPAddress(8,8,4,4));
-  
+  WiFi.setAutoReconnect(false);             // Reconnects are paced by updateWiFi()
+  WiFi.persistent(false);
+  WiFi.setTxPower(WIFI_POWER_19_5dBm);
+  WiFi.setMinSecurity(WIFI_AUTH_WPA_PSK);
   Serial.print("MAC Address: ");
   Serial.println(WiFi.macAddress());
   
-  // ESP32-S3 specific WiFi fixes
-  // Clear any stored WiFi credentials that might interfere
-  WiFi.disconnect(true, true);  // disconnect and clear stored credentials
-  delay(100);
-  
-  // Set specific WiFi parameters for ESP32-S3
-  WiFi.setTxPower(WIFI_POWER_19_5dBm);  // Maximum TX power for better connection
-  WiFi.setMinSecurity(WIFI_AUTH_WPA_PSK);  // Minimum security level
-  
-  // Start connection with explicit BSSID (helps with mesh networks)
-  WiFi.begin(ssid, password);
+  startStationAttempt(millis());
+}
+
+// Runs on the WiFi event task: only flag what happened
+void WebInterface::onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      webInterface.wifiGotIpEvent = true;
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+      webInterface.wifiDisconnectedEvent = true;
+      break;
+    default:
+      break;
+  }
+}
+
+void WebInterface::updateWiFi() {
+  uint32_t now = millis();
   
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 40) { // Increased timeout
-    delay(500);
-    Serial.print(".");
-    attempts++;
-    
-    // Print detailed status every 10 attempts
-    if (attempts % 10 == 0) {
-      Serial.println();
-      Serial.print("WiFi Status: ");
-      String statusText = "";
-      
-      switch (WiFi.status()) {
-        case WL_IDLE_STATUS:     
-          Serial.print("IDLE"); 
-          statusText = "Initializing...";
-          break;
-        case WL_NO_SSID_AVAIL:   
-          Serial.print("NO_SSID_AVAIL"); 
-          statusText = "Network not found";
-          break;
-        case WL_SCAN_COMPLETED:  
-          Serial.print("SCAN_COMPLETED"); 
-          statusText = "Scanning...";
-          break;
-        case WL_CONNECTED:       
-          Serial.print("CONNECTED"); 
-          statusText = "Connected!";
-          break;
-        case WL_CONNECT_FAILED:  
-          Serial.print("CONNECT_FAILED"); 
-          statusText = "Auth failed";
-          break;
-        case WL_CONNECTION_LOST: 
-          Serial.print("CONNECTION_LOST"); 
-          statusText = "Connection lost";
-          break;
-        case WL_DISCONNECTED:    
-          Serial.print("DISCONNECTED"); 
-          statusText = "Disconnected";
-          break;
-        default:                 
-          Serial.print("UNKNOWN"); 
-          statusText = "Status unknown";
-          break;
-      }
-      Serial.print(" (");
-      Serial.print(WiFi.status());
-      Serial.println(")");
-      
-      // Update display with current status
-      nextionDisplay.showWiFiStatus(statusText, true);
-      
-      // If connection failed, try again
-      if (WiFi.status() == WL_CONNECT_FAILED || WiFi.status() == WL_NO_SSID_AVAIL) {
-        Serial.println("Retrying connection...");
-        nextionDisplay.showWiFiStatus("Retrying...", true);
-        WiFi.disconnect();
-        delay(1000);
-        WiFi.begin(ssid, password);
+  if (wifiGotIpEvent) {
+    wifiGotIpEvent = false;
+    if (wifiState == WIFI_LINK_CONNECTING || wifiState == WIFI_LINK_BACKOFF) {
+      wifiFailedAttempts = 0;
+      wifiBackoffMs = WIFI_BACKOFF_MIN_MS;
+      if (apActive) {
+        // Station is back, the fallback network is no longer needed
+        WiFi.softAPdisconnect(true);
+        WiFi.mode(WIFI_STA);
+        apActive = false;
       }
+      wifiIp = (uint32_t)WiFi.localIP();
+      if (wifiUpMs == 0) wifiUpMs = now;
+      Serial.printf("✓ WiFi connected, IP %s, RSSI %d dBm\n", WiFi.localIP().toString().c_str(), WiFi.RSSI());
+      setWiFiState(WIFI_LINK_CONNECTED);
     }
   }
   
-  if (WiFi.status() == WL_CONNECTED) {
-    wifiConnected = true;
-    Serial.println();
-    Serial.println("✓ WiFi connected successfully!");
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
-    Serial.print("Gateway: ");
-    Serial.println(WiFi.gatewayIP());
-    Serial.print("DNS: ");
-    Serial.println(WiFi.dnsIP());
-    Serial.print("RSSI: ");
-    Serial.print(WiFi.RSSI());
-    Serial.println(" dBm");
-    
-    // Update display with success
-    nextionDisplay.showWiFiStatus("Connected!", false);
-    nextionDisplay.showMessage("IP: " + WiFi.localIP().toString(), NEXTION_T3, 5000);
-    nextionDisplay.setState(DISPLAY_STATE_NORMAL);
-    
-    return true;
-  } else {
-    Serial.println();
-    Serial.println("✗ Failed to connect to WiFi");
-    Serial.print("Final status: ");
-    Serial.println(WiFi.status());
-    
-    // Update display with failure
-    nextionDisplay.showWiFiStatus("Failed", false);
-    nextionDisplay.showMessage("Check credentials", NEXTION_T3, 5000);
-    
-    // Print available networks for debugging
-    Serial.println("Available networks:");
-    int n = WiFi.scanNetworks();
-    for (int i = 0; i < n; i++) {
-      Serial.printf("%d: %s (%d dBm) %s\n", 
-                    i + 1, 
-                    WiFi.SSID(i).c_str(), 
-                    WiFi.RSSI(i),
-                    (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? "Open" : "Secured");
+  if (wifiDisconnectedEvent) {
+    wifiDisconnectedEvent = false;
+    if (wifiState == WIFI_LINK_CONNECTED) {
+      Serial.println("WiFi connection lost");
+      wifiReconnects++;
+      wifiRetryAtMs = now + wifiBackoffMs;
+      setWiFiState(WIFI_LINK_BACKOFF);
+    } else if (wifiState == WIFI_LINK_CONNECTING) {
+      stationAttemptFailed(now);
     }
-    
-    return false;
+  }
+  
+  switch (wifiState) {
+    case WIFI_LINK_CONNECTING:
+      if (now - wifiAttemptStartMs >= wifiConfig.connectTimeoutMs) {
+        stationAttemptFailed(now);
+      }
+      break;
+    case WIFI_LINK_BACKOFF:
+      if ((int32_t)(now - wifiRetryAtMs) >= 0) {
+        startStationAttempt(now);
+      }
+      break;
+    default:
+      break;
   }
 }
 
-bool WebInterface::startAccessPoint(const char* ssid, const char* password) {
-  Serial.println("Starting WiFi Access Point...");
-  Serial.print("SSID: ");
-  Serial.println(ssid);
-  
-  // Update display
-  nextionDisplay.setState(DISPLAY_STATE_WIFI_CONNECTING);
-  nextionDisplay.showWiFiStatus("Starting AP...", true);
+void WebInterface::startStationAttempt(uint32_t now) {
+  WiFi.begin(wifiConfig.ssid, wifiConfig.password);
+  wifiAttemptStartMs = now;
+  setWiFiState(WIFI_LINK_CONNECTING);
+}
+
+void WebInterface::stationAttemptFailed(uint32_t now) {
+  wifiFailedAttempts++;
+  Serial.printf("WiFi attempt %d failed (status %d), next in %u ms\n",
+                wifiFailedAttempts, (int)WiFi.status(), (unsigned)wifiBackoffMs);
+  WiFi.disconnect();
   
-  bool success = WiFi.softAP(ssid, password);
+  if (!apActive && wifiConfig.fallbackToAp && wifiFailedAttempts >= wifiConfig.attemptsBeforeFallback) {
+    // Keep trying the station in the background while the AP serves
+    Serial.println("Falling back to Access Point mode...");
+    WiFi.mode(WIFI_AP_STA);
+    startAccessPoint();
+  }
   
-  if (success) {
-    wifiConnected = true;
-    Serial.println("✓ Access Point started!");
-    Serial.print("IP address: ");
-    Serial.println(WiFi.softAPIP());
-    
-    // Update display with success
-    nextionDisplay.showWiFiStatus("AP Ready", false);
-    nextionDisplay.showMessage("Connect to: " + String(ssid), NEXTION_T2, 5000);
-    nextionDisplay.showMessage("IP: " + WiFi.softAPIP().toString(), NEXTION_T3, 5000);
-    nextionDisplay.setState(DISPLAY_STATE_NORMAL);
-    
-    return true;
-  } else {
+  wifiRetryAtMs = now + wifiBackoffMs;
+  wifiBackoffMs = min((uint32_t)(wifiBackoffMs * 2), (uint32_t)WIFI_BACKOFF_MAX_MS);
+  setWiFiState(WIFI_LINK_BACKOFF);
+}
+
+void WebInterface::startAccessPoint() {
+  if (!WiFi.softAP(wifiConfig.apSsid, wifiConfig.apPassword)) {
     Serial.println("✗ Failed to start Access Point");
-    
-    // Update display with failure
-    nextionDisplay.showWiFiStatus("AP Failed", false);
-    nextionDisplay.showMessage("Check hardware", NEXTION_T3, 5000);
-    
-    return false;
+    return;
+  }
+  apActive = true;
+  wifiIp = (uint32_t)WiFi.softAPIP();
+  if (wifiUpMs == 0) wifiUpMs = millis();
+  Serial.print("✓ Access Point started, IP address: ");
+  Serial.println(WiFi.softAPIP());
+  if (!wifiConfig.stationMode) {
+    setWiFiState(WIFI_LINK_AP_ONLY);
+  } else {
+    wifiChanges = wifiChanges + 1;
+  }
+}
+
+void WebInterface::setWiFiState(WiFiLinkState state) {
+  if (wifiState != state) {
+    wifiState = state;
+    wifiChanges = wifiChanges + 1;
+  }
+}
+
+const char* WebInterface::getWiFiStateName(WiFiLinkState state) {
+  switch (state) {
+    case WIFI_LINK_OFF: return "off";
+    case WIFI_LINK_CONNECTING: return "connecting";
+    case WIFI_LINK_CONNECTED: return "connected";
+    case WIFI_LINK_BACKOFF: return "backoff";
+    case WIFI_LINK_AP_ONLY: return "ap";
+    default: return "unknown";
+  }
+}
+
+void WebInterface::showWiFiChanges() {
+  // Display belongs to the controller, so it polls the link state here
+  uint32_t changes = wifiChanges;
+  if (changes == wifiChangesShown) return;
+  wifiChangesShown = changes;
+  
+  IPAddress ip(wifiIp);
+  if (wifiState == WIFI_LINK_CONNECTED) {
+    nextionDisplay.showMessage("IP: " + ip.toString(), NEXTION_T3, 5000);
+  } else if (apActive) {
+    nextionDisplay.showMessage("AP " + String(wifiConfig.apSsid) + " IP: " + ip.toString(), NEXTION_T3, 5000);
+  } else if (wifiState == WIFI_LINK_BACKOFF && wifiUpMs != 0) {
+    nextionDisplay.showMessage("WiFi lost, retrying", NEXTION_T3, 5000);
   }
 }
 
 bool WebInterface::startWebServer() {
-  if (!wifiConnected) {
-    Serial.println("ERROR: WiFi not connected, cannot start web server");
+  // Servers listen on every interface, so they can start before the link is up
+  if (wifiState == WIFI_LINK_OFF) {
+    Serial.println("ERROR: WiFi not started, cannot start web server");
     return false;
   }
   
@@ -217,19 +231,31 @@ bool WebInterface::startWebServer() {
     return false;
   }
   
+  // Stored programs are indexed and their binaries checked by the web
+  // task: reading a large library here would hold up boot-ready
+  
   // Create web server and WebSocket server
   webServer = new WebServer(80);
-  webSocket = new WebSocketsServer(81);
+  webSocket = new PacedWebSocketsServer(81);
   
   // Set up web server routes
   webServer->on("/", [this]() { handleRoot(); });
   webServer->on("/status", [this]() { handleStatus(); });
+  webServer->on("/status.json", [this]() { handleStatusJson(); });
+  webServer->on("/metrics", [this]() { handleMetrics(); });
   webServer->on("/gcode/list", [this]() { handleGCodeList(); });
   webServer->on("/gcode/get", [this]() { handleGCodeGet(); });
-  webServer->on("/gcode/add", HTTP_POST, [this]() { handleGCodeAdd(); });
+  webServer->on("/gcode/add", HTTP_POST, [this]() { handleGCodeAdd(); }, [this]() { handleGCodeUpload(); });
   webServer->on("/gcode/remove", HTTP_POST, [this]() { handleGCodeRemove(); });
+  webServer->on("/gcode/simulate", [this]() { handleGCodeSimulate(); });
+  webServer->on("/job/list", [this]() { handleJobList(); });
+  webServer->on("/job/get", [this]() { handleJobGet(); });
   webServer->onNotFound([this]() { handleNotFound(); });
   
+  // Request headers needed for cached/compressed UI delivery
+  static const char* collectedHeaders[] = {"If-None-Match", "Accept-Encoding"};
+  webServer->collectHeaders(collectedHeaders, 2);
+  
   // Set up WebSocket event handler
   webSocket->onEvent([this](uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
     webSocketEvent(num, type, payload, length);
@@ -243,10 +269,72 @@ bool WebInterface::startWebServer() {
   Serial.println("✓ Web server started on port 80");
   Serial.println("✓ WebSocket server started on port 81");
   
+  // Serve clients from a dedicated task so slow clients never stall the scheduler
+  webTaskStopRequested = false;
+  if (xTaskCreatePinnedToCore(webTask, "WebServer", WEB_TASK_STACK, this,
+                              WEB_TASK_PRIORITY, &webTaskHandle, WEB_TASK_CORE) != pdPASS) {
+    Serial.println("ERROR: Failed to start web task");
+    webTaskHandle = nullptr;
+    stopWebServer();
+    return false;
+  }
+  Serial.printf("✓ Web task running on core %d\n", WEB_TASK_CORE);
+  
   return true;
 }
 
+void WebInterface::webTask(void* param) {
+  WebInterface* self = static_cast<WebInterface*>(param);
+  self->scanStoredPrograms();
+  while (!self->webTaskStopRequested) {
+    gcodeFeed.service(LittleFS);  // Records for a running stored program
+    self->updateWiFi();
+    self->update();
+    self->pollSerialConsole();
+    self->checkNextBinary();
+    self->saveQueuedJobs();
+    vTaskDelay(pdMS_TO_TICKS(1));  // Yield to WiFi/TCP tasks on this core
+  }
+  self->webTaskHandle = nullptr;
+  vTaskDelete(nullptr);
+}
+
+void WebInterface::scanStoredPrograms() {
+  // Scan stored programs once; add/remove keep the index current afterwards.
+  // Nothing is served before this returns, so no upload can race the scan.
+  LittleFS.remove(GCODE_UPLOAD_TEMP);
+  LittleFS.remove(GCODE_BINARY_TEMP);
+  gcodeIndex.rebuild(LittleFS);
+  binaryCheckNext = 0;
+}
+
+void WebInterface::checkNextBinary() {
+  // Rebuild binaries whose source or axis setup changed since they were
+  // made, one per pass so clients are served in between. Selecting a
+  // program still checks its binary first, so the order does not matter.
+  if (binaryCheckNext < 0) return;
+  const GCodeIndexEntry* entry = gcodeIndex.get(binaryCheckNext);
+  if (!entry) {
+    binaryCheckNext = -1;
+    return;
+  }
+  binaryCheckNext++;
+  char compileError[GCODE_COMPILER_ERROR_MAX];
+  if (!GCodeBinary::ensure(LittleFS, *entry, false, compileError, sizeof(compileError))) {
+    Serial.printf("GCode %s: %s\n", entry->name, compileError);
+  }
+}
+
 void WebInterface::stopWebServer() {
+  // Let the web task finish its current pass before tearing the servers down
+  if (webTaskHandle) {
+    webTaskStopRequested = true;
+    while (webTaskHandle) {
+      delay(1);
+    }
+  }
+  webServerRunning = false;
+  
   if (webServer) {
     webServer->stop();
     delete webServer;
@@ -267,30 +355,71 @@ void WebInterface::update() {
   if (webServerRunning) {
     webServer->handleClient();
     webSocket->loop();
+    sendTelemetry();
+    advertiseStreamCredits();
+    drainClientQueues();
   }
 }
 
 // Web server route handlers
 void WebInterface::handleRoot() {
-  webServer->send_P(200, "text/html", indexhtml);
+  // Browser revalidates on every load; an unchanged page costs one 304
+  webServer->sendHeader("ETag", INDEXHTML_ETAG);
+  webServer->sendHeader("Cache-Control", "no-cache");
+  webServer->sendHeader("Vary", "Accept-Encoding");
+  
+  if (webServer->header("If-None-Match") == INDEXHTML_ETAG) {
+    webServer->send(304);
+    return;
+  }
+  
+  if (webServer->header("Accept-Encoding").indexOf("gzip") >= 0) {
+    webServer->sendHeader("Content-Encoding", "gzip");
+    webServer->send_P(200, "text/html", (const char*)indexhtml_gz, indexhtml_gz_len);
+  } else {
+    webServer->send_P(200, "text/html", indexhtml);
+  }
 }
 
+// Status pages are rendered at most once per STATUS_RENDER_INTERVAL_MS and
+// served straight from their buffers, however often they are requested
 void WebInterface::handleStatus() {
-  String status = getStatusInfo();
-  webServer->send(200, "text/plain", status);
+  if (statusText.isStale(millis(), STATUS_RENDER_INTERVAL_MS)) {
+    renderStatusText();
+  }
+  webServer->send_P(200, "text/plain", statusText.c_str(), statusText.length());
+}
+
+void WebInterface::handleStatusJson() {
+  if (statusJson.isStale(millis(), STATUS_RENDER_INTERVAL_MS)) {
+    renderStatusJson();
+  }
+  webServer->send_P(200, "application/json", statusJson.c_str(), statusJson.length());
+}
+
+void WebInterface::handleMetrics() {
+  // Prometheus text exposition format
+  if (statusMetrics.isStale(millis(), STATUS_RENDER_INTERVAL_MS)) {
+    renderMetrics();
+  }
+  webServer->send_P(200, "text/plain; version=0.0.4", statusMetrics.c_str(), statusMetrics.length());
 }
 
 void WebInterface::handleGCodeList() {
-  String gcodeList = listGCodeFiles();
-  webServer->send(200, "text/plain", gcodeList);
+  // Prebuilt "name\tsize\tlines\tcrc" lines, sent without copying
+  size_t len;
+  const char* list = gcodeIndex.getListText(len);
+  webServer->send_P(200, "text/plain", list, len);
 }
 
 void WebInterface::handleGCodeGet() {
   if (webServer->hasArg("name")) {
-    String name = urlDecode(webServer->arg("name"));
-    String content = loadGCodeFile(name);
-    if (content.length() > 0) {
-      webServer->send(200, "text/plain", content);
+    String name = webServer->arg("name");
+    File file = LittleFS.open("/" + name + ".gcode", "r");
+    if (file) {
+      // Chunked from flash with Content-Length - no full copy in RAM
+      webServer->streamFile(file, "text/plain");
+      file.close();
     } else {
       webServer->send(404, "text/plain", "GCode file not found");
     }
@@ -299,15 +428,109 @@ void WebInterface::handleGCodeGet() {
   }
 }
 
+void WebInterface::handleGCodeUpload() {
+  // Multipart chunks go straight to a temp file - heap use does not depend
+  // on program size. The file part's filename is "<name>.gcode".
+  HTTPUpload& upload = webServer->upload();
+  
+  switch (upload.status) {
+    case UPLOAD_FILE_START: {
+      uploadName = upload.filename;
+      if (uploadName.endsWith(".gcode")) {
+        uploadName = uploadName.substring(0, uploadName.length() - 6);
+      }
+      uploadBytes = 0;
+      uploadStartUs = micros();
+      GCodeIndex::begin(uploadStats);
+      uploadError = "";
+      uploadOk = isValidGCodeName(uploadName);
+      if (!uploadOk) {
+        uploadError = "Invalid GCode name";
+        break;
+      }
+      if (!gcodeIndex.hasRoomFor(uploadName.c_str())) {
+        uploadOk = false;
+        uploadError = "GCode storage full (" + String(GCODE_INDEX_MAX) + " programs)";
+        break;
+      }
+      uploadFile = LittleFS.open(GCODE_UPLOAD_TEMP, "w");
+      if (!uploadFile) {
+        uploadOk = false;
+        uploadError = "Failed to open temp file";
+      }
+      break;
+    }
+      
+    case UPLOAD_FILE_WRITE:
+      if (!uploadOk) break;
+      if (uploadFile.write(upload.buf, upload.currentSize) != upload.currentSize) {
+        // Out of space - keep the old program intact
+        uploadOk = false;
+        uploadError = "Write failed (filesystem full?)";
+        uploadFile.close();
+        LittleFS.remove(GCODE_UPLOAD_TEMP);
+        break;
+      }
+      uploadBytes += upload.currentSize;
+      GCodeIndex::update(uploadStats, upload.buf, upload.currentSize);
+      gcodeFeed.service(LittleFS);  // A long upload must not starve a running program
+      break;
+      
+    case UPLOAD_FILE_END:
+      if (!uploadOk) break;
+      uploadFile.close();
+      uploadError = "Failed to save GCode";
+      if (uploadBytes == 0 || !commitGCodeFile(uploadName, uploadError)) {
+        uploadOk = false;
+        LittleFS.remove(GCODE_UPLOAD_TEMP);
+        break;
+      }
+      GCodeIndex::finish(uploadStats);
+      if (!indexGCodeFile(uploadName, uploadStats, uploadError)) {
+        uploadOk = false;
+        break;
+      }
+      uploadError = "";
+      break;
+      
+    case UPLOAD_FILE_ABORTED:
+      uploadOk = false;
+      uploadError = "Upload aborted";
+      if (uploadFile) {
+        uploadFile.close();
+      }
+      LittleFS.remove(GCODE_UPLOAD_TEMP);
+      break;
+  }
+}
+
 void WebInterface::handleGCodeAdd() {
-  if (webServer->hasArg("name") && webServer->hasArg("gcode")) {
-    String name = urlDecode(webServer->arg("name"));
-    String content = urlDecode(webServer->arg("gcode"));
+  if (uploadName.length() > 0 || uploadError.length() > 0) {
+    // Completion of a streamed multipart upload
+    String name = uploadName;
+    uploadName = "";
+    if (!uploadOk) {
+      webServer->send(500, "text/plain", uploadError);
+      uploadError = "";
+      return;
+    }
+    
+    uint32_t elapsedUs = micros() - uploadStartUs;
+    uint32_t kbPerSec = elapsedUs > 0 ? (uint32_t)((uint64_t)uploadBytes * 1000000 / 1024 / elapsedUs) : 0;
+    Serial.printf("GCode upload: %s, %u bytes in %u ms (%u KB/s)\n",
+                  name.c_str(), uploadBytes, elapsedUs / 1000, kbPerSec);
+    webServer->send(200, "text/plain", "GCode saved successfully: " + name + " (" +
+                    String(uploadBytes) + " bytes, " + String(kbPerSec) + " KB/s)");
     
-    if (saveGCodeFile(name, content)) {
+  } else if (webServer->hasArg("name") && webServer->hasArg("gcode")) {
+    // Small url-encoded form posts (arg() is already decoded by WebServer)
+    String name = webServer->arg("name");
+    
+    String error;
+    if (saveGCodeFile(name, webServer->arg("gcode"), error)) {
       webServer->send(200, "text/plain", "GCode saved successfully: " + name);
     } else {
-      webServer->send(500, "text/plain", "Failed to save GCode");
+      webServer->send(500, "text/plain", error);
     }
   } else {
     webServer->send(400, "text/plain", "Missing name or gcode parameter");
@@ -316,7 +539,7 @@ void WebInterface::handleGCodeAdd() {
 
 void WebInterface::handleGCodeRemove() {
   if (webServer->hasArg("name")) {
-    String name = urlDecode(webServer->arg("name"));
+    String name = webServer->arg("name");
     
     if (deleteGCodeFile(name)) {
       webServer->send(200, "text/plain", "GCode removed successfully: " + name);
@@ -328,6 +551,50 @@ void WebInterface::handleGCodeRemove() {
   }
 }
 
+void WebInterface::handleGCodeSimulate() {
+  if (!webServer->hasArg("name")) {
+    webServer->send(400, "text/plain", "Missing name parameter");
+    return;
+  }
+  String name = webServer->arg("name");
+  static char report[GCODE_SIM_REPORT_MAX];
+  bool ok = simulateGCode(name.c_str(), report, sizeof(report));
+  webServer->send(ok ? 200 : 400, "text/plain", report);
+}
+
+void WebInterface::handleJobList() {
+  // One stored job name per line; jobs are few, so the root is scanned each time
+  String list;
+  File root = LittleFS.open("/");
+  File file = root.openNextFile();
+  while (file) {
+    String fileName = file.name();
+    if (fileName.startsWith("/")) {
+      fileName = fileName.substring(1);
+    }
+    if (fileName.endsWith(".job")) {
+      list += fileName.substring(0, fileName.length() - 4) + "\n";
+    }
+    file = root.openNextFile();
+  }
+  webServer->send(200, "text/plain", list);
+}
+
+void WebInterface::handleJobGet() {
+  if (!webServer->hasArg("name")) {
+    webServer->send(400, "text/plain", "Missing name parameter");
+    return;
+  }
+  String name = webServer->arg("name");
+  File file = JobQueue::isValidName(name.c_str()) ? LittleFS.open("/" + name + ".job", "r") : File();
+  if (file) {
+    webServer->streamFile(file, "text/plain");
+    file.close();
+  } else {
+    webServer->send(404, "text/plain", "Job not found");
+  }
+}
+
 void WebInterface::handleNotFound() {
   webServer->send(404, "text/plain", "File not found");
 }
@@ -337,36 +604,29 @@ void WebInterface::webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload,
   switch (type) {
     case WStype_DISCONNECTED:
       Serial.printf("WebSocket[%u] Disconnected\n", num);
+      resetClient(num, false);
+      gcodeStream.release(num);
       break;
       
     case WStype_CONNECTED:
       {
         IPAddress ip = webSocket->remoteIP(num);
+        resetClient(num, true);
         Serial.printf("WebSocket[%u] Connected from %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
         
-        // Send welcome message
-        String welcome = "Connected to nanoELS-flow H5";
-        webSocket->sendTXT(num, welcome);
-        
-        // Send current status
-        String status = motionControl.getStatusReport();
-        webSocket->sendTXT(num, status);
+        // Welcome message and current status
+        ControllerSnapshot snapshot;
+        webBridge.readSnapshot(snapshot);
+        queueText(num, "Connected to nanoELS-flow H5");
+        queueText(num, WebBridge::formatStatusReport(snapshot));
       }
       break;
       
     case WStype_TEXT:
-      {
-        String command = String((char*)payload);
-        command.trim();
-        Serial.printf("WebSocket[%u] received: %s\n", num, command.c_str());
-        
-        processWebSocketCommand(command);
-        
-        // Echo command back to all clients
-        String response = "Processed: " + command;
-        String responseCopy = response;
-        webSocket->broadcastTXT(responseCopy);
-      }
+      Serial.printf("WebSocket[%u] received: %.*s\n", num, (int)length, (const char*)payload);
+      
+      // Parsed in place; each command is acknowledged to its sender only
+      processWebSocketCommand(num, payload, length);
       break;
       
     case WStype_BIN:
@@ -378,102 +638,500 @@ void WebInterface::webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload,
   }
 }
 
-void WebInterface::processWebSocketCommand(String command) {
-  lastCommand = command;
+// WebSocket command table. Replies are one line each:
+//   @<seq> <op> ok [value]     or     @<seq> <op> err <reason>
+// where seq counts the commands received on this connection.
+const WebInterface::WsCommandSpec WebInterface::wsCommands[] = {
+  {'?', WS_ARG_NONE, &WebInterface::cmdStatus},                // Status query
+  {'=', WS_ARG_INT,  &WebInterface::cmdKey},                   // =<code> key tap
+  {'!', WS_ARG_NONE, &WebInterface::cmdEmergencyStop},
+  {'~', WS_ARG_NONE, &WebInterface::cmdReleaseEmergencyStop},
+  {'X', WS_ARG_INT,  &WebInterface::cmdJog},                   // X<steps>
+  {'Z', WS_ARG_INT,  &WebInterface::cmdJog},                   // Z<steps>
+  {'P', WS_ARG_INT,  &WebInterface::cmdPitch},                 // P<dupr>
+  {'F', WS_ARG_INT,  &WebInterface::cmdOverride},              // F<percent> feed override
+  {'V', WS_ARG_INT,  &WebInterface::cmdOverride},              // V<percent> rapid override
+  {'M', WS_ARG_INT,  &WebInterface::cmdMode},                  // M<OperationMode>
+  {'S', WS_ARG_NONE, &WebInterface::cmdStart},                 // Same as Enter
+  {'H', WS_ARG_NONE, &WebInterface::cmdStop},                  // Halt running operation
+  {'T', WS_ARG_INT,  &WebInterface::cmdTelemetry},             // T<hz>, T0 = off
+  {'"', WS_ARG_TEXT, &WebInterface::cmdRemoveAllGCode},        // "" removes all GCode
+  {'>', WS_ARG_TEXT, &WebInterface::cmdStreamLines},           // >lines, > alone = credits
+  {'R', WS_ARG_TEXT, &WebInterface::cmdSelectProgram},         // R<name> stored program, R alone = stream
+  {'J', WS_ARG_TEXT, &WebInterface::cmdJob},                   // Jadd, Jclear, Jrun, Jstop, Jsave <name>, Jload <name>
+};
+
+// Key that selects each OperationMode, indexed by mode
+static const uint16_t modeKeys[] = {
+  B_MODE_GEARS, B_MODE_TURN, B_MODE_FACE, B_MODE_THREAD, B_MODE_CONE,
+  B_MODE_CUT, B_MODE_ASYNC, B_MODE_ELLIPSE, B_MODE_GCODE
+};
+
+bool WebInterface::parseWebSocketCommand(const uint8_t* payload, size_t length, WsCommand& cmd) {
+  const char* p = (const char*)payload;
+  const char* end = p + length;
   
-  if (command == "?") {
-    // Status request
-    String status = motionControl.getStatusReport();
-    String statusMsg = "Status: " + status;
-    webSocket->broadcastTXT(statusMsg);
-    
-  } else if (command.startsWith("=")) {
-    // Key code simulation
-    int keyCode = command.substring(1).toInt();
-    Serial.printf("Simulating key press: %d\n", keyCode);
-    // TODO: Implement key simulation
-    String keyMsg = "Key simulated: " + String(keyCode);
-    webSocket->broadcastTXT(keyMsg);
-    
-  } else if (command == "!") {
-    // Emergency stop
-    motionControl.setEmergencyStop(true);
-    String stopMsg = "Emergency stop activated";
-    webSocket->broadcastTXT(stopMsg);
-    
-  } else if (command == "~") {
-    // Release emergency stop
-    motionControl.setEmergencyStop(false);
-    String releaseMsg = "Emergency stop released";
-    webSocket->broadcastTXT(releaseMsg);
-    
-  } else if (command == "\"\"") {
-    // Remove all GCode files
-    File root = LittleFS.open("/");
-    File file = root.openNextFile();
-    int count = 0;
-    while (file) {
-      if (String(file.name()).endsWith(".gcode")) {
-        LittleFS.remove(file.path());
-        count++;
-      }
-      file = root.openNextFile();
+  // Trim surrounding whitespace (the UI terminates commands with '\n')
+  while (p < end && isspace((unsigned char)*p)) p++;
+  while (end > p && isspace((unsigned char)end[-1])) end--;
+  if (p == end) return false;
+  
+  cmd.op = *p++;
+  cmd.hasArg = false;
+  cmd.arg = 0;
+  
+  // Optional signed decimal argument right after the opcode
+  const char* q = p;
+  bool negative = false;
+  if (q < end && (*q == '-' || *q == '+')) {
+    negative = (*q == '-');
+    q++;
+  }
+  if (q < end && isdigit((unsigned char)*q)) {
+    int64_t value = 0;
+    while (q < end && isdigit((unsigned char)*q)) {
+      value = value * 10 + (*q - '0');
+      if (value > INT32_MAX) return false;
+      q++;
     }
-    String removeMsg = "Removed " + String(count) + " GCode files";
-    webSocket->broadcastTXT(removeMsg);
-    
-  } else if (command.startsWith("X") || command.startsWith("Z")) {
-    // Motion commands
-    char axis = command.charAt(0);
-    int steps = command.substring(1).toInt();
-    uint8_t axisNum = (axis == 'X') ? 0 : 1;
-    
-    motionControl.moveRelative(axisNum, steps);
-    String moveMsg = "Moving " + String(axis) + " axis " + String(steps) + " steps";
-    webSocket->broadcastTXT(moveMsg);
+    cmd.hasArg = true;
+    cmd.arg = negative ? -(int32_t)value : (int32_t)value;
+    p = q;
+  }
+  
+  cmd.text = p;
+  cmd.textLen = end - p;
+  return true;
+}
+
+void WebInterface::processWebSocketCommand(uint8_t num, const uint8_t* payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  
+  size_t keep = min(length, sizeof(lastCommand) - 1);
+  memcpy(lastCommand, payload, keep);
+  lastCommand[keep] = '\0';
+  
+  WsCommand cmd;
+  cmd.op = '-';
+  cmd.seq = ++clients[num].commandSeq;
+  if (!parseWebSocketCommand(payload, length, cmd)) {
+    sendAck(num, cmd, false, "syntax");
+    return;
+  }
+  
+  for (const WsCommandSpec& spec : wsCommands) {
+    if (spec.op != cmd.op) continue;
     
+    bool argsOk = true;
+    switch (spec.argMode) {
+      case WS_ARG_NONE: argsOk = !cmd.hasArg && cmd.textLen == 0; break;
+      case WS_ARG_INT:  argsOk = cmd.hasArg && cmd.textLen == 0; break;
+      case WS_ARG_TEXT: break;
+    }
+    if (!argsOk) {
+      sendAck(num, cmd, false, "args");
+      return;
+    }
+    (this->*spec.handler)(num, cmd);
+    return;
+  }
+  
+  sendAck(num, cmd, false, "unknown");
+}
+
+void WebInterface::sendAck(uint8_t num, const WsCommand& cmd, bool ok, const char* format, ...) {
+  char line[WS_ACK_MAX];
+  int len = snprintf(line, sizeof(line), "@%u %c %s", (unsigned)cmd.seq, cmd.op, ok ? "ok" : "err");
+  if (format && len > 0 && len < (int)sizeof(line) - 1) {
+    line[len++] = ' ';
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(line + len, sizeof(line) - len, format, args);
+    va_end(args);
+    if (n > 0) len += n;
+  }
+  if (len >= (int)sizeof(line)) {
+    len = sizeof(line) - 1;
+  }
+  queueText(num, line, len);
+}
+
+bool WebInterface::postKeyTap(uint16_t keyCode) {
+  // Press and release, same as the PS2 keyboard; both or nothing
+  if (inputEvents.available(INPUT_SOURCE_WEB, keyCode) < 2) return false;
+  inputEvents.post(INPUT_SOURCE_WEB, keyCode, true);
+  inputEvents.post(INPUT_SOURCE_WEB, keyCode, false);
+  return true;
+}
+
+void WebInterface::cmdStatus(uint8_t num, const WsCommand& cmd) {
+  // Answered from the latest controller snapshot
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  const int32_t* v = snapshot.sample.values;
+  sendAck(num, cmd, true, "x=%ld z=%ld rpm=%ld mode=%ld state=%ld pass=%ld/%ld estop=%d",
+          (long)v[TELEMETRY_POS_X], (long)v[TELEMETRY_POS_Z], (long)v[TELEMETRY_RPM],
+          (long)v[TELEMETRY_MODE], (long)v[TELEMETRY_STATE],
+          (long)v[TELEMETRY_PASS], (long)v[TELEMETRY_PASSES],
+          (snapshot.sample.flags & TELEMETRY_FLAG_ESTOP) ? 1 : 0);
+}
+
+void WebInterface::cmdKey(uint8_t num, const WsCommand& cmd) {
+  // Key code simulation - goes through the same queue as the PS2 keyboard
+  if (cmd.arg < 0 || cmd.arg > 0xFFFF) {
+    sendAck(num, cmd, false, "range");
+  } else if (!postKeyTap(cmd.arg)) {
+    sendAck(num, cmd, false, "full");
   } else {
-    // Unknown command
-    String unknownMsg = "Unknown command: " + command;
-    webSocket->broadcastTXT(unknownMsg);
+    sendAck(num, cmd, true, "%ld", (long)cmd.arg);
+  }
+}
+
+void WebInterface::cmdEmergencyStop(uint8_t num, const WsCommand& cmd) {
+  webBridge.requestEmergencyStop();
+  sendAck(num, cmd, true);
+}
+
+void WebInterface::cmdReleaseEmergencyStop(uint8_t num, const WsCommand& cmd) {
+  webBridge.requestEmergencyRelease();
+  sendAck(num, cmd, true);
+}
+
+void WebInterface::cmdJog(uint8_t num, const WsCommand& cmd) {
+  uint8_t axis = (cmd.op == 'X') ? AXIS_X : AXIS_Z;
+  if (!webBridge.postCommand(WEB_CMD_MOVE_RELATIVE, axis, cmd.arg)) {
+    sendAck(num, cmd, false, "full");
+    return;
+  }
+  sendAck(num, cmd, true, "%ld", (long)cmd.arg);
+}
+
+void WebInterface::cmdPitch(uint8_t num, const WsCommand& cmd) {
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  if (cmd.arg < -DUPR_MAX || cmd.arg > DUPR_MAX) {
+    sendAck(num, cmd, false, "range");
+  } else if (snapshot.sample.values[TELEMETRY_STATE] == STATE_RUNNING) {
+    sendAck(num, cmd, false, "busy");
+  } else if (!webBridge.postCommand(WEB_CMD_SET_PITCH, 0, cmd.arg)) {
+    sendAck(num, cmd, false, "full");
+  } else {
+    sendAck(num, cmd, true, "%ld", (long)cmd.arg);
+  }
+}
+
+void WebInterface::cmdOverride(uint8_t num, const WsCommand& cmd) {
+  // Applies live, also while an operation runs
+  bool feed = cmd.op == 'F';
+  int32_t max = feed ? OVERRIDE_FEED_MAX_PERCENT : OVERRIDE_RAPID_MAX_PERCENT;
+  if (cmd.arg < OVERRIDE_MIN_PERCENT || cmd.arg > max) {
+    sendAck(num, cmd, false, "range");
+  } else if (!webBridge.postCommand(feed ? WEB_CMD_FEED_OVERRIDE : WEB_CMD_RAPID_OVERRIDE, 0, cmd.arg)) {
+    sendAck(num, cmd, false, "full");
+  } else {
+    sendAck(num, cmd, true, "%ld", (long)cmd.arg);
+  }
+}
+
+void WebInterface::cmdMode(uint8_t num, const WsCommand& cmd) {
+  // Same key as F1..F9 so the display follows the mode change
+  if (cmd.arg < 0 || cmd.arg >= (int32_t)(sizeof(modeKeys) / sizeof(modeKeys[0]))) {
+    sendAck(num, cmd, false, "range");
+  } else if (!postKeyTap(modeKeys[cmd.arg])) {
+    sendAck(num, cmd, false, "full");
+  } else {
+    sendAck(num, cmd, true, "%ld", (long)cmd.arg);
+  }
+}
+
+void WebInterface::cmdStart(uint8_t num, const WsCommand& cmd) {
+  // Enter advances the setup or starts the operation, exactly as on the keyboard
+  bool queued = postKeyTap(B_ON);
+  sendAck(num, cmd, queued, queued ? nullptr : "full");
+}
+
+void WebInterface::cmdStop(uint8_t num, const WsCommand& cmd) {
+  bool queued = webBridge.postCommand(WEB_CMD_STOP_OPERATION);
+  sendAck(num, cmd, queued, queued ? nullptr : "full");
+}
+
+void WebInterface::cmdTelemetry(uint8_t num, const WsCommand& cmd) {
+  // Binary telemetry rate for this client only: T0 = off, T1..T100 = Hz
+  setTelemetryRate(num, cmd.arg);
+  sendAck(num, cmd, true, "%lu", clients[num].subscribed ? (unsigned long)(1000 / clients[num].intervalMs) : 0UL);
+}
+
+void WebInterface::cmdRemoveAllGCode(uint8_t num, const WsCommand& cmd) {
+  if (cmd.hasArg || cmd.textLen != 1 || cmd.text[0] != '"') {
+    sendAck(num, cmd, false, "args");
+    return;
+  }
+  
+  // Sweep the root rather than the index, so programs that never made it
+  // into the index (older firmware, full index) go as well
+  int count = 0;
+  File root = LittleFS.open("/");
+  File file = root.openNextFile();
+  while (file) {
+    String path = file.path();
+    bool source = path.endsWith(".gcode");
+    file.close();
+    if ((source || path.endsWith(".bin")) && LittleFS.remove(path) && source) {
+      count++;
+    }
+    file = root.openNextFile();
+  }
+  gcodeIndex.clear();
+  sendAck(num, cmd, true, "%d", count);
+}
+
+void WebInterface::cmdSelectProgram(uint8_t num, const WsCommand& cmd) {
+  // Program for the next G-code start; the controller refuses it mid-run
+  char name[GCODE_INDEX_NAME_LEN];
+  size_t len = cmd.textLen;
+  while (len > 0 && isspace((unsigned char)cmd.text[len - 1])) len--;
+  if (cmd.hasArg || len >= sizeof(name)) {
+    sendAck(num, cmd, false, "args");
+    return;
+  }
+  memcpy(name, cmd.text, len);
+  name[len] = '\0';
+  const GCodeIndexEntry* entry = len > 0 ? gcodeIndex.find(name) : nullptr;
+  if (len > 0 && !entry) {
+    sendAck(num, cmd, false, "missing");
+    return;
+  }
+  
+  // The controller runs the binary without checks beyond its header, so
+  // verify it here and rebuild it if it does not match the source
+  char compileError[GCODE_COMPILER_ERROR_MAX];
+  if (entry && !GCodeBinary::ensure(LittleFS, *entry, true, compileError, sizeof(compileError))) {
+    sendAck(num, cmd, false, "%s", compileError);
+    return;
+  }
+  bool queued = webBridge.postSelectProgram(name, len);
+  sendAck(num, cmd, queued, "%s", queued ? (len > 0 ? name : "stream") : "full");
+}
+
+void WebInterface::cmdJob(uint8_t num, const WsCommand& cmd) {
+  // The controller owns the job; its outcome shows up in the job status
+  static const struct {
+    const char* word;
+    WebCommandType type;
+    bool named;
+  } jobCommands[] = {
+    {"add", WEB_CMD_JOB_ADD, false},
+    {"clear", WEB_CMD_JOB_CLEAR, false},
+    {"run", WEB_CMD_JOB_RUN, false},
+    {"stop", WEB_CMD_JOB_STOP, false},
+    {"save", WEB_CMD_JOB_SAVE, true},
+    {"load", WEB_CMD_JOB_LOADED, true},
+  };
+  const char* p = cmd.text;
+  const char* end = cmd.text + cmd.textLen;
+  const char* wordEnd = p;
+  while (wordEnd < end && !isspace((unsigned char)*wordEnd)) wordEnd++;
+  const char* name = wordEnd;
+  while (name < end && isspace((unsigned char)*name)) name++;
+  size_t nameLen = end - name;
+  
+  for (size_t i = 0; i < sizeof(jobCommands) / sizeof(jobCommands[0]); i++) {
+    if (cmd.hasArg || strlen(jobCommands[i].word) != (size_t)(wordEnd - p) ||
+        strncmp(jobCommands[i].word, p, wordEnd - p) != 0) {
+      continue;
+    }
+    if (jobCommands[i].named != (nameLen > 0)) {
+      break;
+    }
+    bool queued;
+    if (jobCommands[i].named) {
+      char jobName[JOB_NAME_LEN];
+      if (nameLen >= sizeof(jobName)) {
+        sendAck(num, cmd, false, "name");
+        return;
+      }
+      memcpy(jobName, name, nameLen);
+      jobName[nameLen] = '\0';
+      if (!JobQueue::isValidName(jobName)) {
+        sendAck(num, cmd, false, "name");
+        return;
+      }
+      // A load reads the file here and hands the table over; a save goes to the
+      // controller first so it captures the table in command order
+      queued = jobCommands[i].type == WEB_CMD_JOB_LOADED ? loadJob(jobName)
+                                                         : webBridge.postNamed(jobCommands[i].type, jobName, nameLen);
+    } else {
+      queued = webBridge.postCommand(jobCommands[i].type);
+    }
+    sendAck(num, cmd, queued, "%s", queued ? jobCommands[i].word : "full");
+    return;
+  }
+  sendAck(num, cmd, false, "args");
+}
+
+void WebInterface::saveQueuedJobs() {
+  // Tables the controller captured for WEB_CMD_JOB_SAVE
+  static JobTable table;
+  while (webBridge.takeJobToSave(table)) {
+    JobFileResult result = JobQueue::writeFile(LittleFS, table.name, table);
+    webBridge.postNamed(WEB_CMD_JOB_SAVED, table.name, strlen(table.name), result);
+  }
+}
+
+bool WebInterface::loadJob(const char* jobName) {
+  static JobTable table;
+  JobFileResult result = JobQueue::readFile(LittleFS, jobName, table);
+  return webBridge.postLoadedJob(table, result);
+}
+
+// Length of the line at p without trailing whitespace; returns the next line
+static const char* splitStreamLine(const char* p, const char* end, size_t& len) {
+  const char* eol = (const char*)memchr(p, '\n', end - p);
+  if (!eol) eol = end;
+  len = eol - p;
+  while (len > 0 && isspace((unsigned char)p[len - 1])) len--;
+  return eol + 1;
+}
+
+void WebInterface::cmdStreamLines(uint8_t num, const WsCommand& cmd) {
+  // One or more G-code lines, '\n' separated, charged one byte per
+  // character plus one per line. The whole frame fits or nothing is queued.
+  if (cmd.hasArg) {
+    sendAck(num, cmd, false, "args");
+    return;
+  }
+  if (!gcodeStream.claim(num)) {
+    sendAck(num, cmd, false, "busy");
+    return;
+  }
+  
+  size_t cost = 0;
+  const char* end = cmd.text + cmd.textLen;
+  for (const char* p = cmd.text; p < end; ) {
+    size_t len;
+    const char* next = splitStreamLine(p, end, len);
+    if (len > 0) cost += len + 1;
+    p = next;
+  }
+  if (cost > gcodeStream.credits()) {
+    sendAck(num, cmd, false, "credits %u", (unsigned)gcodeStream.credits());
+    return;
+  }
+  
+  for (const char* p = cmd.text; p < end; ) {
+    size_t len;
+    const char* next = splitStreamLine(p, end, len);
+    if (len > 0) gcodeStream.pushLine(p, len);
+    p = next;
+  }
+  
+  streamCreditsAdvertised = gcodeStream.credits();
+  sendAck(num, cmd, true, "%u", (unsigned)streamCreditsAdvertised);
+}
+
+void WebInterface::advertiseStreamCredits() {
+  // Tell the streaming client about freed space in steps, not per line
+  uint8_t owner = gcodeStream.getOwner();
+  if (owner >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  
+  size_t credits = gcodeStream.credits();
+  if (credits > streamCreditsAdvertised &&
+      (credits - streamCreditsAdvertised >= GCODE_STREAM_CREDIT_STEP ||
+       credits == GCODE_STREAM_BUFFER_BYTES)) {
+    char message[16];
+    int len = snprintf(message, sizeof(message), "C%u", (unsigned)credits);
+    if (queueText(owner, message, len)) {
+      streamCreditsAdvertised = credits;
+    }
   }
 }
 
 // GCode file management
-bool WebInterface::saveGCodeFile(const String& name, const String& content) {
-  String filename = "/" + name + ".gcode";
-  File file = LittleFS.open(filename, "w");
+bool WebInterface::isValidGCodeName(const String& name) {
+  return name.length() > 0 && name.length() <= GCODE_NAME_MAX && name.indexOf('/') < 0;
+}
+
+bool WebInterface::saveGCodeFile(const String& name, const String& content, String& error) {
+  error = "Failed to save GCode";
+  if (!isValidGCodeName(name)) {
+    return false;
+  }
+  if (!gcodeIndex.hasRoomFor(name.c_str())) {
+    error = "GCode storage full (" + String(GCODE_INDEX_MAX) + " programs)";
+    return false;
+  }
   
+  File file = LittleFS.open(GCODE_UPLOAD_TEMP, "w");
   if (!file) {
-    Serial.println("Failed to open file for writing: " + filename);
+    Serial.println("Failed to open file for writing: " GCODE_UPLOAD_TEMP);
     return false;
   }
   
   size_t bytesWritten = file.print(content);
   file.close();
   
-  Serial.printf("Saved GCode file: %s (%d bytes)\n", filename.c_str(), bytesWritten);
-  return bytesWritten > 0;
+  if (bytesWritten != content.length() || bytesWritten == 0 || !commitGCodeFile(name, error)) {
+    LittleFS.remove(GCODE_UPLOAD_TEMP);
+    return false;
+  }
+  
+  GCodeFileStats stats;
+  GCodeIndex::begin(stats);
+  GCodeIndex::update(stats, (const uint8_t*)content.c_str(), content.length());
+  GCodeIndex::finish(stats);
+  if (!indexGCodeFile(name, stats, error)) {
+    return false;
+  }
+  
+  Serial.printf("Saved GCode file: %s (%d bytes)\n", name.c_str(), bytesWritten);
+  return true;
 }
 
-String WebInterface::loadGCodeFile(const String& name) {
-  String filename = "/" + name + ".gcode";
-  File file = LittleFS.open(filename, "r");
-  
-  if (!file) {
-    Serial.println("Failed to open file for reading: " + filename);
-    return "";
+bool WebInterface::commitGCodeFile(const String& name, String& error) {
+  // Compile first: a program with errors never replaces the stored one
+  char compileError[GCODE_COMPILER_ERROR_MAX];
+  if (!GCodeBinary::compile(LittleFS, GCODE_UPLOAD_TEMP, compileError, sizeof(compileError))) {
+    error = String("Compile error ") + compileError;
+    return false;
   }
   
-  String content = file.readString();
-  file.close();
+  // Replace the program in one step: readers see either the old or the new file
+  String filename = "/" + name + ".gcode";
+  if (!LittleFS.rename(GCODE_UPLOAD_TEMP, filename)) {
+    // Some VFS layers refuse to rename over an existing file
+    LittleFS.remove(filename);
+    if (!LittleFS.rename(GCODE_UPLOAD_TEMP, filename)) {
+      LittleFS.remove(GCODE_BINARY_TEMP);
+      error = "Failed to save GCode";
+      return false;
+    }
+  }
   
-  return content;
+  if (!GCodeBinary::commit(LittleFS, name.c_str())) {
+    // Source is saved; the binary gets rebuilt when the program is selected
+    LittleFS.remove(GCODE_BINARY_TEMP);
+    GCodeBinary::remove(LittleFS, name.c_str());
+  }
+  return true;
+}
+
+bool WebInterface::indexGCodeFile(const String& name, const GCodeFileStats& stats, String& error) {
+  // Checked before the upload, but a program stored now and missing from
+  // the index could never be listed, selected or removed: take it back out
+  if (gcodeIndex.put(name.c_str(), stats)) {
+    return true;
+  }
+  LittleFS.remove("/" + name + ".gcode");
+  GCodeBinary::remove(LittleFS, name.c_str());
+  error = "GCode storage full (" + String(GCODE_INDEX_MAX) + " programs)";
+  return false;
 }
 
 bool WebInterface::deleteGCodeFile(const String& name) {
   String filename = "/" + name + ".gcode";
   bool success = LittleFS.remove(filename);
+  GCodeBinary::remove(LittleFS, name.c_str());
+  gcodeIndex.remove(name.c_str());
   
   if (success) {
     Serial.println("Deleted GCode file: " + filename);
@@ -484,68 +1142,356 @@ bool WebInterface::deleteGCodeFile(const String& name) {
   return success;
 }
 
-String WebInterface::listGCodeFiles() {
-  String fileList = "";
-  File root = LittleFS.open("/");
-  File file = root.openNextFile();
+uint32_t WebInterface::getClientQueueBytes() {
+  uint32_t bytes = 0;
+  for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    bytes += clients[i].queue.size();
+  }
+  return bytes;
+}
+
+// Dry run setup: machine limits as GCodeInterpreter uses them, the current
+// position as program start and the spindle speed for threading moves
+static GCodeSimSetup simulationSetup() {
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  const int32_t* v = snapshot.sample.values;
   
-  while (file) {
-    String fileName = file.name();
-    if (fileName.endsWith(".gcode")) {
-      // Remove .gcode extension and leading slash
-      fileName = fileName.substring(1, fileName.length() - 6);
-      if (fileList.length() > 0) {
-        fileList += "\n";
+  GCodeSimSetup setup;
+  memset(&setup, 0, sizeof(setup));
+  setup.scale = GCodeBinary::machineScale();
+  const long maxTravelMm[2] = {MAX_TRAVEL_MM_X, MAX_TRAVEL_MM_Z};
+  for (int axis = 0; axis < 2; axis++) {
+    setup.limits.maxSpeed[axis] = GCodeCompiler::stepsToDu(setup.scale, axis, snapshot.maxSpeed[axis]);
+    setup.limits.acceleration[axis] = GCodeCompiler::stepsToDu(setup.scale, axis, snapshot.acceleration[axis]);
+    setup.limits.duPerStep[axis] = (float)setup.scale.screwPitch[axis] / setup.scale.motorSteps[axis];
+    setup.startSteps[axis] = v[axis == 0 ? TELEMETRY_POS_X : TELEMETRY_POS_Z];
+    
+    // Unset soft limits: the travel the machine has around the current position
+    int32_t left = snapshot.leftStop[axis];
+    int32_t right = snapshot.rightStop[axis];
+    int32_t travel = GCodeCompiler::duToSteps(setup.scale, axis, maxTravelMm[axis] * 10000);
+    setup.maxSteps[axis] = left != LONG_MAX ? left : setup.startSteps[axis] + travel;
+    setup.minSteps[axis] = right != LONG_MIN ? right : setup.startSteps[axis] - travel;
+  }
+  setup.limits.junctionDeviation = GCODE_JUNCTION_DEVIATION_DU;
+  setup.spindleRpm = abs(v[TELEMETRY_RPM]);
+  return setup;
+}
+
+bool WebInterface::simulateGCode(const char* name, char* report, size_t len) {
+  // Runs on the web task; a long program keeps it busy for tens of ms
+  static GCodeSimulator simulator;
+  const GCodeIndexEntry* entry = gcodeIndex.find(name);
+  if (!entry) {
+    snprintf(report, len, "No program %s", name);
+    return false;
+  }
+  char error[GCODE_COMPILER_ERROR_MAX];
+  if (!GCodeBinary::ensure(LittleFS, *entry, false, error, sizeof(error))) {
+    snprintf(report, len, "%s", error);
+    return false;
+  }
+  
+  uint32_t started = millis();
+  simulator.begin(simulationSetup());
+  if (!GCodeBinary::play(LittleFS, name, simulator, error, sizeof(error))) {
+    snprintf(report, len, "%s", error);
+    return false;
+  }
+  size_t pos = GCodeSimulator::format(simulator.finish(), GCodeBinary::machineScale(), report, len);
+  Serial.printf("GCode simulated %s in %lu ms\n", name, (unsigned long)(millis() - started));
+  return pos > 0;
+}
+
+void WebInterface::pollSerialConsole() {
+  // Line commands typed into the USB serial monitor
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (consoleLen < sizeof(consoleLine) - 1) {
+        consoleLine[consoleLen++] = c;
       }
-      fileList += fileName;
+      continue;
+    }
+    if (consoleLen == 0) {
+      continue;
+    }
+    consoleLine[consoleLen] = '\0';
+    consoleLen = 0;
+    
+    if (strncmp(consoleLine, "sim ", 4) == 0) {
+      static char report[GCODE_SIM_REPORT_MAX];
+      simulateGCode(consoleLine + 4, report, sizeof(report));
+      Serial.println(report);
+    } else {
+      Serial.println("Commands: sim <program>");
     }
-    file = root.openNextFile();
   }
+}
+
+uint32_t WebInterface::getTelemetryDropped() {
+  uint32_t dropped = 0;
+  for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    dropped += clients[i].telemetryDropped;
+  }
+  return dropped;
+}
+
+// Largest free block as a share of free heap: 0% = one contiguous block
+static uint32_t heapFragmentation(uint32_t freeHeap, uint32_t maxAlloc) {
+  return freeHeap > 0 ? 100 - (uint32_t)((uint64_t)maxAlloc * 100 / freeHeap) : 0;
+}
+
+void WebInterface::renderStatusText() {
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  const int32_t* v = snapshot.sample.values;
+  uint8_t flags = snapshot.sample.flags;
+  uint32_t totalBytes = LittleFS.totalBytes();
+  uint32_t usedBytes = LittleFS.usedBytes();
+  StatusBuffer<STATUS_TEXT_BUFFER>& out = statusText;
+  
+  out.begin();
+  out.printf("Boot.readyMs=%u\n", (unsigned)bootReadyMs);
+  out.printf("WiFi.state=%s\n", getWiFiStateName(wifiState));
+  out.printf("WiFi.apActive=%d\n", apActive ? 1 : 0);
+  out.printf("WiFi.ip=%s\n", IPAddress(wifiIp).toString().c_str());
+  out.printf("WiFi.upMs=%u\n", (unsigned)wifiUpMs);
+  out.printf("WiFi.reconnects=%u\n", (unsigned)wifiReconnects);
+  out.printf("WiFi.failedAttempts=%u\n", (unsigned)wifiFailedAttempts);
+  out.printf("LittleFS.totalBytes=%u\n", (unsigned)totalBytes);
+  out.printf("LittleFS.usedBytes=%u\n", (unsigned)usedBytes);
+  out.printf("LittleFS.freeSpace=%u\n", (unsigned)(totalBytes - usedBytes));
+  out.printf("Heap.free=%u\n", (unsigned)ESP.getFreeHeap());
+  out.printf("Heap.minFree=%u\n", (unsigned)ESP.getMinFreeHeap());
+  out.printf("Heap.maxAlloc=%u\n", (unsigned)ESP.getMaxAllocHeap());
+  out.printf("Scheduler.loopFrequency=%u\n", (unsigned)snapshot.loopFrequency);
+  out.printf("Scheduler.maxLoopUs=%u\n", (unsigned)snapshot.maxLoopUs);
+  out.printf("Scheduler.avgLoopUs=%u\n", (unsigned)snapshot.avgLoopUs);
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    const SchedulerTaskStats& task = snapshot.tasks[i];
+    out.printf("Scheduler.%s.runs=%u\n", task.name, (unsigned)task.runs);
+    out.printf("Scheduler.%s.maxUs=%u\n", task.name, (unsigned)task.maxUs);
+  }
+  out.printf("Motion.estop=%d\n", (flags & TELEMETRY_FLAG_ESTOP) ? 1 : 0);
+  out.printf("Motion.threading=%d\n", (flags & TELEMETRY_FLAG_THREADING) ? 1 : 0);
+  out.printf("Motion.spindle=%ld\n", (long)v[TELEMETRY_SPINDLE]);
+  out.printf("Motion.rpm=%ld\n", (long)v[TELEMETRY_RPM]);
+  out.printf("Motion.X.pos=%ld\n", (long)v[TELEMETRY_POS_X]);
+  out.printf("Motion.X.target=%ld\n", (long)v[TELEMETRY_TARGET_X]);
+  out.printf("Motion.X.followErrorDu=%ld\n", (long)v[TELEMETRY_FOLLOW_ERR_X]);
+  out.printf("Motion.Z.pos=%ld\n", (long)v[TELEMETRY_POS_Z]);
+  out.printf("Motion.Z.target=%ld\n", (long)v[TELEMETRY_TARGET_Z]);
+  out.printf("Motion.Z.followErrorDu=%ld\n", (long)v[TELEMETRY_FOLLOW_ERR_Z]);
+  out.printf("Motion.feedOverride=%ld\n", (long)v[TELEMETRY_FEED_OVERRIDE]);
+  out.printf("Motion.rapidOverride=%ld\n", (long)v[TELEMETRY_RAPID_OVERRIDE]);
+  out.printf("Job.name=%s\n", snapshot.job.name);
+  out.printf("Job.operations=%u\n", (unsigned)snapshot.job.operationCount);
+  out.printf("Job.armed=%d\n", snapshot.job.armed ? 1 : 0);
+  out.printf("Job.parts=%u\n", (unsigned)snapshot.job.parts);
+  out.printf("Job.partMs=%u\n", (unsigned)snapshot.job.partMs);
+  out.printf("Job.avgPartMs=%u\n", (unsigned)snapshot.job.avgPartMs);
+  out.printf("Cycle.valid=%d\n", snapshot.cycle.valid ? 1 : 0);
+  out.printf("Cycle.passSeconds=%.1f\n", snapshot.cycle.passSeconds);
+  out.printf("Cycle.totalSeconds=%.1f\n", snapshot.cycle.totalSeconds);
+  out.printf("Cycle.maxRpm=%ld\n", (long)snapshot.cycle.maxRpm);
+  out.printf("Cycle.moveFactor=%.2f\n", snapshot.cycle.factor[CYCLE_GROUP_MOVE]);
+  out.printf("Cycle.cutFactor=%.2f\n", snapshot.cycle.factor[CYCLE_GROUP_CUT]);
+  out.printf("Cycle.passesLearnt=%u\n", (unsigned)snapshot.cycle.passesLearnt);
+  out.printf("WebBridge.snapshotAgeMs=%u\n", (unsigned)(millis() - snapshot.publishedMs));
+  out.printf("WebBridge.commandsPending=%u\n", (unsigned)webBridge.getCommandsPending());
+  out.printf("WebBridge.commandsDropped=%u\n", (unsigned)webBridge.getCommandsDropped());
+  out.printf("LastCommand=%s\n", lastCommand);
+  out.printf("GCode.programs=%d\n", gcodeIndex.count());
+  out.printf("GCodeStream.active=%d\n", gcodeStream.isActive() ? 1 : 0);
+  out.printf("GCodeStream.buffered=%u\n", (unsigned)gcodeStream.buffered());
+  out.printf("GCodeStream.linesQueued=%u\n", (unsigned)gcodeStream.getLinesQueued());
+  out.printf("GCodeStream.linesConsumed=%u\n", (unsigned)gcodeStream.getLinesConsumed());
+  out.printf("GCodeStream.linesPerSecond=%.1f\n", gcodeStream.getLinesPerSecond());
+  out.printf("GCodeStream.underruns=%u\n", (unsigned)gcodeStream.getUnderruns());
+  out.printf("GCodeFeed.buffered=%u\n", (unsigned)gcodeFeed.buffered());
+  out.printf("GCodeFeed.underruns=%u\n", (unsigned)gcodeFeed.getUnderruns());
+  out.printf("Input.pending=%u\n", (unsigned)inputEvents.pending());
+  for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+    const InputLatencyStats& stats = inputEvents.getLatencyStats((InputSource)i);
+    const char* source = InputEventQueue::getSourceName((InputSource)i);
+    out.printf("Input.%s.events=%u\n", source, (unsigned)stats.count);
+    out.printf("Input.%s.lastLatencyUs=%u\n", source, (unsigned)stats.lastUs);
+    out.printf("Input.%s.maxLatencyUs=%u\n", source, (unsigned)stats.maxUs);
+  }
+  out.printf("Telemetry.framesBuilt=%u\n", (unsigned)telemetry.getFramesBuilt());
+  out.printf("Telemetry.keyFramesSent=%u\n", (unsigned)telemetry.getKeyFramesSent());
+  out.printf("Telemetry.deltaFramesSent=%u\n", (unsigned)telemetry.getDeltaFramesSent());
+  out.printf("Telemetry.bytesSent=%u\n", (unsigned)telemetry.getBytesSent());
+  out.printf("Telemetry.framesDropped=%u\n", (unsigned)getTelemetryDropped());
+  out.printf("WebSocket.queuedBytes=%u\n", (unsigned)getClientQueueBytes());
+  out.printf("WebSocket.slowClientDisconnects=%u\n", (unsigned)slowClientDisconnects);
+  out.printf("WebSocket.sendBudgetExhausted=%u\n", (unsigned)sendBudgetExhausted);
+  out.printf("WebSocket.maxSendTimeUs=%u\n", (unsigned)maxSendTimeUs);
+  out.end(millis());
   
-  return fileList;
+  if (out.isTruncated()) {
+    Serial.println("WARNING: /status truncated, increase STATUS_TEXT_BUFFER");
+  }
 }
 
-String WebInterface::getStatusInfo() {
-  String info = "";
-  info += "WiFi.status=" + String(WiFi.status()) + "\n";
-  info += "WiFi.localIP=" + WiFi.localIP().toString() + "\n";
-  info += "LittleFS.totalBytes=" + String(LittleFS.totalBytes()) + "\n";
-  info += "LittleFS.usedBytes=" + String(LittleFS.usedBytes()) + "\n";
-  info += "LittleFS.freeSpace=" + String(LittleFS.totalBytes() - LittleFS.usedBytes()) + "\n";
-  info += "MinimalMotionControl.status=" + motionControl.getStatusReport() + "\n";
-  info += "LastCommand=" + lastCommand + "\n";
+void WebInterface::renderStatusJson() {
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  const int32_t* v = snapshot.sample.values;
+  uint8_t flags = snapshot.sample.flags;
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t maxAlloc = ESP.getMaxAllocHeap();
+  StatusBuffer<STATUS_JSON_BUFFER>& out = statusJson;
   
-  return info;
+  out.begin();
+  out.printf("{\"uptimeMs\":%u,\"bootReadyMs\":%u,", (unsigned)millis(), (unsigned)bootReadyMs);
+  out.printf("\"wifi\":{\"state\":\"%s\",\"apActive\":%s,\"upMs\":%u,\"reconnects\":%u},",
+             getWiFiStateName(wifiState), apActive ? "true" : "false",
+             (unsigned)wifiUpMs, (unsigned)wifiReconnects);
+  out.printf("\"heap\":{\"free\":%u,\"minFree\":%u,\"maxAlloc\":%u,\"fragmentationPct\":%u},",
+             (unsigned)freeHeap, (unsigned)ESP.getMinFreeHeap(), (unsigned)maxAlloc,
+             (unsigned)heapFragmentation(freeHeap, maxAlloc));
+  out.printf("\"scheduler\":{\"loopHz\":%u,\"maxLoopUs\":%u,\"avgLoopUs\":%u,\"tasks\":[",
+             (unsigned)snapshot.loopFrequency, (unsigned)snapshot.maxLoopUs, (unsigned)snapshot.avgLoopUs);
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    const SchedulerTaskStats& task = snapshot.tasks[i];
+    out.printf("%s{\"name\":\"%s\",\"intervalMs\":%u,\"runs\":%u,\"maxUs\":%u}",
+               i > 0 ? "," : "", task.name, (unsigned)task.intervalMs, (unsigned)task.runs, (unsigned)task.maxUs);
+  }
+  out.printf("]},");
+  out.printf("\"motion\":{\"estop\":%s,\"threading\":%s,\"rpm\":%ld,\"spindle\":%ld,",
+             (flags & TELEMETRY_FLAG_ESTOP) ? "true" : "false",
+             (flags & TELEMETRY_FLAG_THREADING) ? "true" : "false",
+             (long)v[TELEMETRY_RPM], (long)v[TELEMETRY_SPINDLE]);
+  out.printf("\"x\":{\"pos\":%ld,\"target\":%ld,\"speed\":%u,\"followErrorDu\":%ld},",
+             (long)v[TELEMETRY_POS_X], (long)v[TELEMETRY_TARGET_X],
+             (unsigned)snapshot.currentSpeed[AXIS_X], (long)v[TELEMETRY_FOLLOW_ERR_X]);
+  out.printf("\"z\":{\"pos\":%ld,\"target\":%ld,\"speed\":%u,\"followErrorDu\":%ld}},",
+             (long)v[TELEMETRY_POS_Z], (long)v[TELEMETRY_TARGET_Z],
+             (unsigned)snapshot.currentSpeed[AXIS_Z], (long)v[TELEMETRY_FOLLOW_ERR_Z]);
+  out.printf("\"operation\":{\"mode\":%ld,\"state\":%ld,\"pass\":%ld,\"passes\":%ld,\"feedOverride\":%ld,\"rapidOverride\":%ld},",
+             (long)v[TELEMETRY_MODE], (long)v[TELEMETRY_STATE],
+             (long)v[TELEMETRY_PASS], (long)v[TELEMETRY_PASSES],
+             (long)v[TELEMETRY_FEED_OVERRIDE], (long)v[TELEMETRY_RAPID_OVERRIDE]);
+  static const char* jobStates[] = {"idle", "running", "aborted"};
+  const JobStatus& job = snapshot.job;
+  out.printf("\"job\":{\"name\":\"%s\",\"operations\":%u,\"operation\":%d,\"state\":\"%s\",\"armed\":%s,"
+             "\"parts\":%u,\"partMs\":%u,\"avgPartMs\":%u,\"message\":\"%s\"},",
+             job.name, (unsigned)job.operationCount, (int)job.operation, jobStates[job.state],
+             job.armed ? "true" : "false", (unsigned)job.parts, (unsigned)job.partMs,
+             (unsigned)job.avgPartMs, job.message);
+  // Seconds are -1 while unknown (spindle stopped with a geared cut ahead)
+  const CycleEstimate& cycle = snapshot.cycle;
+  out.printf("\"cycle\":{\"valid\":%s,\"passSeconds\":%.1f,\"totalSeconds\":%.1f,\"maxRpm\":%ld,"
+             "\"moveFactor\":%.2f,\"cutFactor\":%.2f,\"passesLearnt\":%u},",
+             cycle.valid ? "true" : "false", cycle.passSeconds, cycle.totalSeconds, (long)cycle.maxRpm,
+             cycle.factor[CYCLE_GROUP_MOVE], cycle.factor[CYCLE_GROUP_CUT], (unsigned)cycle.passesLearnt);
+  out.printf("\"queues\":{\"inputEvents\":%u,\"webCommands\":%u,\"gcodeStream\":%u,\"gcodeStreamCredits\":%u,\"webSocketBytes\":%u},",
+             (unsigned)inputEvents.pending(), (unsigned)webBridge.getCommandsPending(),
+             (unsigned)gcodeStream.buffered(), (unsigned)gcodeStream.credits(),
+             (unsigned)getClientQueueBytes());
+  out.printf("\"gcodeStream\":{\"active\":%s,\"linesConsumed\":%u,\"linesPerSecond\":%.1f,\"underruns\":%u},",
+             gcodeStream.isActive() ? "true" : "false", (unsigned)gcodeStream.getLinesConsumed(),
+             gcodeStream.getLinesPerSecond(), (unsigned)gcodeStream.getUnderruns());
+  out.printf("\"web\":{\"snapshotAgeMs\":%u,\"commandsDropped\":%u,\"slowClientDisconnects\":%u,\"telemetryFramesDropped\":%u,\"maxSendTimeUs\":%u}}",
+             (unsigned)(millis() - snapshot.publishedMs), (unsigned)webBridge.getCommandsDropped(),
+             (unsigned)slowClientDisconnects, (unsigned)getTelemetryDropped(), (unsigned)maxSendTimeUs);
+  out.end(millis());
+  
+  if (out.isTruncated()) {
+    Serial.println("WARNING: /status.json truncated, increase STATUS_JSON_BUFFER");
+  }
 }
 
-String WebInterface::urlDecode(String str) {
-  String decoded = "";
-  char temp[] = "0x00";
-  unsigned int len = str.length();
-  unsigned int i = 0;
+void WebInterface::renderMetrics() {
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  const int32_t* v = snapshot.sample.values;
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t maxAlloc = ESP.getMaxAllocHeap();
+  StatusBuffer<STATUS_METRICS_BUFFER>& out = statusMetrics;
   
-  while (i < len) {
-    char decodedChar;
-    char encodedChar = str.charAt(i++);
-    
-    if ((encodedChar == '%') && (i + 1 < len)) {
-      temp[2] = str.charAt(i++);
-      temp[3] = str.charAt(i++);
-      decodedChar = strtol(temp, NULL, 16);
-    } else if (encodedChar == '+') {
-      decodedChar = ' ';
-    } else {
-      decodedChar = encodedChar;
-    }
-    
-    decoded += decodedChar;
+  out.begin();
+  out.printf("# HELP nanoels_uptime_seconds Time since boot.\n# TYPE nanoels_uptime_seconds gauge\n");
+  out.printf("nanoels_uptime_seconds %u\n", (unsigned)(millis() / 1000));
+  out.printf("# HELP nanoels_boot_ready_ms Boot to motion ready.\n# TYPE nanoels_boot_ready_ms gauge\n");
+  out.printf("nanoels_boot_ready_ms %u\n", (unsigned)bootReadyMs);
+  out.printf("# HELP nanoels_wifi_up_ms Boot to first WiFi link (station or AP).\n# TYPE nanoels_wifi_up_ms gauge\n");
+  out.printf("nanoels_wifi_up_ms %u\n", (unsigned)wifiUpMs);
+  out.printf("# HELP nanoels_wifi_connected Station connected.\n# TYPE nanoels_wifi_connected gauge\n");
+  out.printf("nanoels_wifi_connected %d\n", wifiState == WIFI_LINK_CONNECTED ? 1 : 0);
+  out.printf("# HELP nanoels_wifi_reconnects_total Station link losses.\n# TYPE nanoels_wifi_reconnects_total counter\n");
+  out.printf("nanoels_wifi_reconnects_total %u\n", (unsigned)wifiReconnects);
+  
+  out.printf("# HELP nanoels_heap_free_bytes Free heap.\n# TYPE nanoels_heap_free_bytes gauge\n");
+  out.printf("nanoels_heap_free_bytes %u\n", (unsigned)freeHeap);
+  out.printf("# HELP nanoels_heap_min_free_bytes Lowest free heap since boot.\n# TYPE nanoels_heap_min_free_bytes gauge\n");
+  out.printf("nanoels_heap_min_free_bytes %u\n", (unsigned)ESP.getMinFreeHeap());
+  out.printf("# HELP nanoels_heap_max_alloc_bytes Largest allocatable block.\n# TYPE nanoels_heap_max_alloc_bytes gauge\n");
+  out.printf("nanoels_heap_max_alloc_bytes %u\n", (unsigned)maxAlloc);
+  out.printf("# HELP nanoels_heap_fragmentation_percent 100 - largest block / free heap.\n# TYPE nanoels_heap_fragmentation_percent gauge\n");
+  out.printf("nanoels_heap_fragmentation_percent %u\n", (unsigned)heapFragmentation(freeHeap, maxAlloc));
+  
+  out.printf("# HELP nanoels_loop_frequency_hz Scheduler loops per second of loop time.\n# TYPE nanoels_loop_frequency_hz gauge\n");
+  out.printf("nanoels_loop_frequency_hz %u\n", (unsigned)snapshot.loopFrequency);
+  out.printf("# HELP nanoels_loop_max_us Longest scheduler loop in the diagnostics window.\n# TYPE nanoels_loop_max_us gauge\n");
+  out.printf("nanoels_loop_max_us %u\n", (unsigned)snapshot.maxLoopUs);
+  out.printf("# HELP nanoels_loop_avg_us Average scheduler loop in the diagnostics window.\n# TYPE nanoels_loop_avg_us gauge\n");
+  out.printf("nanoels_loop_avg_us %u\n", (unsigned)snapshot.avgLoopUs);
+  out.printf("# HELP nanoels_task_max_us Longest run per scheduler task in the diagnostics window.\n# TYPE nanoels_task_max_us gauge\n");
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    out.printf("nanoels_task_max_us{task=\"%s\"} %u\n", snapshot.tasks[i].name, (unsigned)snapshot.tasks[i].maxUs);
+  }
+  out.printf("# HELP nanoels_task_runs Runs per scheduler task in the diagnostics window.\n# TYPE nanoels_task_runs gauge\n");
+  for (int i = 0; i < snapshot.taskCount; i++) {
+    out.printf("nanoels_task_runs{task=\"%s\"} %u\n", snapshot.tasks[i].name, (unsigned)snapshot.tasks[i].runs);
   }
   
-  return decoded;
+  out.printf("# HELP nanoels_estop Emergency stop active.\n# TYPE nanoels_estop gauge\n");
+  out.printf("nanoels_estop %d\n", (snapshot.sample.flags & TELEMETRY_FLAG_ESTOP) ? 1 : 0);
+  out.printf("# HELP nanoels_spindle_rpm Spindle speed.\n# TYPE nanoels_spindle_rpm gauge\n");
+  out.printf("nanoels_spindle_rpm %ld\n", (long)v[TELEMETRY_RPM]);
+  out.printf("# HELP nanoels_following_error_du Following error while threading, deci-microns.\n# TYPE nanoels_following_error_du gauge\n");
+  out.printf("nanoels_following_error_du{axis=\"x\"} %ld\n", (long)v[TELEMETRY_FOLLOW_ERR_X]);
+  out.printf("nanoels_following_error_du{axis=\"z\"} %ld\n", (long)v[TELEMETRY_FOLLOW_ERR_Z]);
+  out.printf("# HELP nanoels_operation_mode Current OperationMode.\n# TYPE nanoels_operation_mode gauge\n");
+  out.printf("nanoels_operation_mode %ld\n", (long)v[TELEMETRY_MODE]);
+  out.printf("# HELP nanoels_operation_state Current OperationState.\n# TYPE nanoels_operation_state gauge\n");
+  out.printf("nanoels_operation_state %ld\n", (long)v[TELEMETRY_STATE]);
+  
+  out.printf("# HELP nanoels_queue_depth Items waiting per queue.\n# TYPE nanoels_queue_depth gauge\n");
+  out.printf("nanoels_queue_depth{queue=\"input_events\"} %u\n", (unsigned)inputEvents.pending());
+  out.printf("nanoels_queue_depth{queue=\"web_commands\"} %u\n", (unsigned)webBridge.getCommandsPending());
+  out.printf("nanoels_queue_depth{queue=\"gcode_stream_bytes\"} %u\n", (unsigned)gcodeStream.buffered());
+  out.printf("nanoels_queue_depth{queue=\"websocket_bytes\"} %u\n", (unsigned)getClientQueueBytes());
+  
+  out.printf("# HELP nanoels_gcode_stream_lines_total Streamed G-code lines taken by the controller.\n# TYPE nanoels_gcode_stream_lines_total counter\n");
+  out.printf("nanoels_gcode_stream_lines_total %u\n", (unsigned)gcodeStream.getLinesConsumed());
+  out.printf("# HELP nanoels_gcode_stream_underruns_total Times the stream buffer ran dry mid-stream.\n# TYPE nanoels_gcode_stream_underruns_total counter\n");
+  out.printf("nanoels_gcode_stream_underruns_total %u\n", (unsigned)gcodeStream.getUnderruns());
+  out.printf("# HELP nanoels_web_commands_dropped_total Web commands lost to a full queue.\n# TYPE nanoels_web_commands_dropped_total counter\n");
+  out.printf("nanoels_web_commands_dropped_total %u\n", (unsigned)webBridge.getCommandsDropped());
+  out.printf("# HELP nanoels_websocket_slow_disconnects_total Clients dropped for not draining.\n# TYPE nanoels_websocket_slow_disconnects_total counter\n");
+  out.printf("nanoels_websocket_slow_disconnects_total %u\n", (unsigned)slowClientDisconnects);
+  out.printf("# HELP nanoels_telemetry_bytes_total Binary telemetry bytes sent.\n# TYPE nanoels_telemetry_bytes_total counter\n");
+  out.printf("nanoels_telemetry_bytes_total %u\n", (unsigned)telemetry.getBytesSent());
+  out.printf("# HELP nanoels_input_max_latency_us Worst key-to-handler latency per source.\n# TYPE nanoels_input_max_latency_us gauge\n");
+  for (int i = 0; i < INPUT_SOURCE_COUNT; i++) {
+    out.printf("nanoels_input_max_latency_us{source=\"%s\"} %u\n",
+               InputEventQueue::getSourceName((InputSource)i),
+               (unsigned)inputEvents.getLatencyStats((InputSource)i).maxUs);
+  }
+  out.end(millis());
+  
+  if (out.isTruncated()) {
+    Serial.println("WARNING: /metrics truncated, increase STATUS_METRICS_BUFFER");
+  }
 }
 
 bool WebInterface::isWiFiConnected() {
-  return wifiConnected && (WiFi.status() == WL_CONNECTED || WiFi.softAPgetStationNum() > 0);
+  return wifiState == WIFI_LINK_CONNECTED || apActive;
 }
 
 bool WebInterface::isWebServerRunning() {
@@ -553,27 +1499,237 @@ bool WebInterface::isWebServerRunning() {
 }
 
 String WebInterface::getIPAddress() {
-  if (WiFi.status() == WL_CONNECTED) {
-    return WiFi.localIP().toString();
-  } else {
-    return WiFi.softAPIP().toString();
-  }
+  return IPAddress(wifiIp).toString();
 }
 
 void WebInterface::broadcastMessage(const String& message) {
   if (webSocket && webServerRunning) {
-    // Create a non-const copy for WebSocket library compatibility
-    String messageCopy = message;
-    webSocket->broadcastTXT(messageCopy);
+    for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+      if (clients[i].connected) {
+        queueText(i, message);
+      }
+    }
   }
 }
 
-void WebInterface::sendMotionStatus() {
-  if (webSocket && webServerRunning) {
-    String status = "Motion: X=" + String(motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X)), 2) + 
-                   " Z=" + String(motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)), 2) + 
-                   " Spindle=" + String(motionControl.getSpindlePosition());
-    String statusCopy = status;
-    webSocket->broadcastTXT(statusCopy);
+void WebInterface::resetClient(uint8_t num, bool connected) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  
+  WebClient& client = clients[num];
+  client.connected = connected;
+  client.commandSeq = 0;
+  client.queue.clear();
+  client.lastProgressMs = millis();
+  client.subscribed = false;
+  client.synced = false;
+  client.telemetryPending = false;
+  client.telemetryDropped = 0;
+  client.overflowed = false;
+}
+
+void WebInterface::setTelemetryRate(uint8_t num, int hz) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+  
+  WebClient& client = clients[num];
+  if (hz <= 0) {
+    client.subscribed = false;
+    client.synced = false;
+    client.telemetryPending = false;
+    return;
+  }
+  
+  hz = constrain(hz, TELEMETRY_MIN_HZ, TELEMETRY_MAX_HZ);
+  client.subscribed = true;
+  client.synced = false;  // Start with a key frame
+  client.intervalMs = 1000 / hz;
+  client.nextDueMs = millis();
+}
+
+void WebInterface::sendTelemetry() {
+  if (!webSocket || !webServerRunning) return;
+  
+  uint32_t now = millis();
+  bool anyDue = false;
+  for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    if (clients[i].subscribed && (int32_t)(now - clients[i].nextDueMs) >= 0) {
+      anyDue = true;
+      break;
+    }
+  }
+  if (!anyDue) return;
+  
+  // One encode per tick from the latest controller snapshot, shared by every client
+  ControllerSnapshot snapshot;
+  webBridge.readSnapshot(snapshot);
+  telemetry.build(snapshot.sample);
+  
+  for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    WebClient& client = clients[i];
+    if (!client.subscribed) continue;
+    
+    // Drop-oldest: a frame still waiting from an earlier tick has just been
+    // replaced by the new sample (its delta is against what was last sent)
+    if (client.telemetryPending) {
+      client.telemetryDropped++;
+    }
+    if ((int32_t)(now - client.nextDueMs) < 0) continue;
+    
+    client.telemetryPending = true;
+    
+    client.nextDueMs += client.intervalMs;
+    if ((int32_t)(now - client.nextDueMs) >= 0) {
+      client.nextDueMs = now + client.intervalMs;  // Fell behind - don't burst to catch up
+    }
+  }
+}
+
+bool WebInterface::queueText(uint8_t num, const String& message) {
+  return queueText(num, message.c_str(), message.length());
+}
+
+bool WebInterface::queueText(uint8_t num, const char* message, size_t len) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !clients[num].connected) return false;
+  
+  WebClient& client = clients[num];
+  if (len > WS_MAX_MESSAGE) {
+    len = WS_MAX_MESSAGE;
+  }
+  
+  // Record: u16 length + text. Acks must not be lost, so a full queue
+  // means the client is not keeping up and gets disconnected.
+  if (client.queue.available() < len + 2) {
+    client.overflowed = true;  // Disconnected from the drain loop, not mid-callback
+    return false;
+  }
+  uint8_t header[2] = {(uint8_t)(len & 0xFF), (uint8_t)(len >> 8)};
+  client.queue.pushN(header, 2);
+  client.queue.pushN((const uint8_t*)message, len);
+  return true;
+}
+
+bool WebInterface::sendQueued(uint8_t num) {
+  static uint8_t record[WS_MAX_MESSAGE + 2];
+  WebClient& client = clients[num];
+  
+  // Peek, send, then consume: a record the socket refused stays queued
+  uint8_t header[2];
+  if (client.queue.peekN(header, 2) < 2) return false;
+  size_t recordLen = 2 + (header[0] | (header[1] << 8));
+  
+  // Send straight from the queue unless the record wraps around its end
+  size_t contiguous;
+  const uint8_t* data = client.queue.peekSpan(contiguous);
+  if (contiguous < recordLen) {
+    client.queue.peekN(record, recordLen);
+    data = record;
   }
-}
\ No newline at end of file
+  
+  if (!webSocket->sendTXT(num, data + 2, recordLen - 2)) return false;
+  client.queue.consume(recordLen);
+  return true;
+}
+
+bool WebInterface::sendPendingTelemetry(uint8_t num) {
+  WebClient& client = clients[num];
+  client.telemetryPending = false;
+  
+  // Delta against the sample this client last received, whatever its rate
+  static uint8_t frame[TelemetryEncoder::MAX_FRAME_SIZE];
+  bool delta = client.synced;
+  uint32_t seq = client.frameSeq + 1;
+  size_t len = delta ? telemetry.getDeltaFrame(client.lastSent, seq, frame) : telemetry.getKeyFrame(seq, frame);
+  
+  if (!webSocket->sendBIN(num, frame, len)) {
+    client.synced = false;
+    return false;
+  }
+  telemetry.recordSent(delta, len);
+  client.synced = true;
+  client.frameSeq = seq;
+  client.lastSent = telemetry.getSample();
+  return true;
+}
+
+// Largest frame we send (text record + WebSocket header) must fit the free
+// space lwIP guarantees to a writable socket: TCP_SNDLOWAT, two segments
+static_assert(WS_MAX_MESSAGE + 14 <= 2 * 536 && TelemetryEncoder::MAX_FRAME_SIZE + 14 <= 2 * 536,
+              "frame larger than the write space canWrite() checks for");
+
+bool PacedWebSocketsServer::canWrite(uint8_t num) {
+  // lwIP reports a socket writable only while more than TCP_SNDLOWAT bytes
+  // of its send buffer are free, so a zero-timeout select() tells whether
+  // the next frame goes out without waiting
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !_clients[num].tcp) return false;
+  int fd = _clients[num].tcp->fd();
+  if (fd < 0) return false;
+  fd_set writable;
+  FD_ZERO(&writable);
+  FD_SET(fd, &writable);
+  struct timeval poll = {0, 0};
+  return select(fd + 1, nullptr, &writable, nullptr, &poll) > 0;
+}
+
+void WebInterface::dropSlowClient(uint8_t num, const char* reason) {
+  Serial.printf("WebSocket[%u] too slow (%s) - disconnecting\n", num, reason);
+  slowClientDisconnects++;
+  resetClient(num, false);
+  webSocket->disconnect(num);
+}
+
+void WebInterface::drainClientQueues() {
+  uint32_t start = micros();
+  uint32_t now = millis();
+  bool budgetHit = false;
+  
+  // Round robin over clients: acks first, then the newest telemetry frame.
+  // Stop as soon as this tick's send budget is used up; the rest waits.
+  // Only sockets with room are written, so no single send can block and
+  // a client that cannot take data makes no progress until it stalls out.
+  for (int n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX && !budgetHit; n++) {
+    uint8_t num = (nextClientToDrain + n) % WEBSOCKETS_SERVER_CLIENT_MAX;
+    WebClient& client = clients[num];
+    if (!client.connected) continue;
+    
+    if (client.overflowed) {
+      dropSlowClient(num, "send queue full");
+      continue;
+    }
+    
+    if (client.queue.empty() && !client.telemetryPending) {
+      client.lastProgressMs = now;
+      continue;
+    }
+    
+    while (!client.queue.empty()) {
+      if (micros() - start >= WS_SEND_BUDGET_US) {
+        budgetHit = true;
+        break;
+      }
+      if (!webSocket->canWrite(num) || !sendQueued(num)) break;
+      client.lastProgressMs = now;
+    }
+    
+    if (!budgetHit && client.queue.empty() && client.telemetryPending) {
+      if (micros() - start >= WS_SEND_BUDGET_US) {
+        budgetHit = true;
+      } else if (webSocket->canWrite(num) && sendPendingTelemetry(num)) {
+        client.lastProgressMs = now;
+      }
+    }
+    
+    bool waiting = !client.queue.empty() || client.telemetryPending;
+    if (waiting && now - client.lastProgressMs > WS_CLIENT_STALL_MS) {
+      dropSlowClient(num, "stalled");
+    }
+  }
+  
+  nextClientToDrain = (nextClientToDrain + 1) % WEBSOCKETS_SERVER_CLIENT_MAX;
+  
+  uint32_t elapsed = micros() - start;
+  if (elapsed > maxSendTimeUs) {
+    maxSendTimeUs = elapsed;
+  }
+  if (budgetHit) {
+    sendBudgetExhausted++;
+  }
+}
@@ -8,62 +8,287 @@
 #include <LittleFS.h>
 #include <FS.h>
 #include "indexhtml.h"
+#include "indexhtml_gz.h"
 #include "MinimalMotionControl.h"
 #include "NextionDisplay.h"
+#include "InputEvents.h"
+#include "Telemetry.h"
+#include "CircularBuffer.h"
+#include "GCodeIndex.h"
+#include "WebBridge.h"
+#include "GCodeStream.h"
+#include "StatusBuffer.h"
+
+// Outbound WebSocket limits
+#define WS_CLIENT_QUEUE_BYTES 1024   // Per-client queue for acks/messages (power of 2)
+#define WS_MAX_MESSAGE 512           // Longest queued text message
+#define WS_SEND_BUDGET_US 3000       // Max time spent sending per web tick
+#define WS_CLIENT_STALL_MS 2000      // Data waiting without progress this long = slow client
+
+// WebSocket commands
+#define WS_ACK_MAX 96                // Longest ack line
+#define WS_LAST_COMMAND_MAX 32       // Kept for /status
+
+// Status pages
+#define STATUS_RENDER_INTERVAL_MS 1000       // Pages are re-rendered at most this often
+#define STATUS_TEXT_BUFFER 3072
+#define STATUS_JSON_BUFFER 3072
+#define STATUS_METRICS_BUFFER 8192
+
+// G-code storage
+#define GCODE_UPLOAD_TEMP "/gcode-upload.tmp"  // Upload target until complete
+#define GCODE_NAME_MAX (GCODE_INDEX_NAME_LEN - 1) // Program name length (without .gcode)
+#define GCODE_SIM_REPORT_MAX 640             // Dry run report text
+#define SERIAL_CONSOLE_LINE_MAX 48           // Longest serial console command
+
+// WiFi link backoff between station attempts
+#define WIFI_BACKOFF_MIN_MS 1000
+#define WIFI_BACKOFF_MAX_MS 60000
+
+// Web task (servers run here, off the scheduler loop)
+#define WEB_TASK_STACK 8192
+#define WEB_TASK_PRIORITY 1
+#define WEB_TASK_CORE 0                      // WiFi core; the scheduler runs on core 1
+
+// WiFi link configuration, filled from the sketch settings
+struct WiFiLinkConfig {
+  bool stationMode;           // false = access point only
+  const char* ssid;           // Station network
+  const char* password;
+  const char* apSsid;         // Access point (only mode or fallback)
+  const char* apPassword;
+  bool fallbackToAp;          // Start the AP when the station cannot connect
+  uint8_t attemptsBeforeFallback;
+  uint32_t connectTimeoutMs;  // Per station attempt
+};
+
+// WiFi link states, advanced by WebInterface::updateWiFi()
+enum WiFiLinkState : uint8_t {
+  WIFI_LINK_OFF,
+  WIFI_LINK_CONNECTING,       // Station attempt in progress
+  WIFI_LINK_CONNECTED,        // Station has an IP
+  WIFI_LINK_BACKOFF,          // Waiting before the next station attempt
+  WIFI_LINK_AP_ONLY           // Access point mode, no station
+};
+
+// One tokenized WebSocket command: opcode, optional signed integer argument
+// and any trailing text. Text points into the receive buffer (not terminated).
+struct WsCommand {
+  char op;
+  bool hasArg;
+  int32_t arg;
+  const char* text;
+  size_t textLen;
+  uint32_t seq;             // Per-client command sequence, echoed in the ack
+};
+
+// Per-client outbound state
+struct WebClient {
+  bool connected;
+  uint32_t commandSeq;      // Commands received on this connection
+  
+  // Acks and messages: length-prefixed records, never dropped. A client
+  // whose queue overflows or stops draining is disconnected instead.
+  CircularBuffer<uint8_t, WS_CLIENT_QUEUE_BYTES> queue;
+  uint32_t lastProgressMs;
+  bool overflowed;          // Queue overflowed, disconnect on next drain
+  
+  // Binary telemetry subscription - only the newest frame is kept
+  bool subscribed;
+  bool synced;              // Holds lastSent, can take a delta
+  bool telemetryPending;
+  uint32_t intervalMs;
+  uint32_t nextDueMs;
+  uint32_t frameSeq;        // Last frame sent on this connection
+  TelemetrySample lastSent; // Base of the next delta
+  uint32_t telemetryDropped;
+};
+
+// sendTXT()/sendBIN() write synchronously and retry until the TCP timeout,
+// so one slow client would hold up every other one. Frames only go to a
+// client whose socket can take them without blocking.
+class PacedWebSocketsServer : public WebSocketsServer {
+public:
+  PacedWebSocketsServer(uint16_t port) : WebSocketsServer(port) {}
+  bool canWrite(uint8_t num);
+};
 
 class WebInterface {
 private:
   WebServer* webServer;
-  WebSocketsServer* webSocket;
-  bool wifiConnected;
-  bool webServerRunning;
-  String lastCommand;
+  PacedWebSocketsServer* webSocket;
+  
+  // WiFi link state machine (web task), fed by WiFi events
+  WiFiLinkConfig wifiConfig;
+  volatile WiFiLinkState wifiState;
+  volatile bool apActive;
+  volatile bool wifiGotIpEvent;
+  volatile bool wifiDisconnectedEvent;
+  uint32_t wifiAttemptStartMs;
+  uint32_t wifiRetryAtMs;
+  uint32_t wifiBackoffMs;
+  uint8_t wifiFailedAttempts;
+  volatile uint32_t wifiIp;            // Address clients should use
+  volatile uint32_t wifiChanges;       // Bumped on every state change
+  uint32_t wifiChangesShown;           // Controller side, for the display
+  uint32_t wifiUpMs;                   // Boot to first link (station or AP)
+  uint32_t wifiReconnects;
+  uint32_t bootReadyMs;                // Boot to motion ready
+  volatile bool webServerRunning;
+  TaskHandle_t webTaskHandle;
+  volatile bool webTaskStopRequested;
+  char lastCommand[WS_LAST_COMMAND_MAX];
+  int binaryCheckNext;                 // Web task: next program to check, -1 = done
+  
+  // Serial console (web task): "sim <name>" dry-runs a stored program
+  char consoleLine[SERIAL_CONSOLE_LINE_MAX];
+  uint8_t consoleLen;
+  
+  // Streaming G-code upload state (one upload at a time)
+  File uploadFile;
+  String uploadName;
+  size_t uploadBytes;
+  uint32_t uploadStartUs;
+  bool uploadOk;
+  GCodeFileStats uploadStats;
+  String uploadError;
+  
+  // Binary telemetry, built once per tick for all subscribed clients
+  TelemetryEncoder telemetry;
+  WebClient clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+  uint8_t nextClientToDrain;   // Round-robin start so one client can't starve the rest
+  
+  // G-code streaming: credits last told to the streaming client
+  size_t streamCreditsAdvertised;
+  
+  // Rendered status pages, reused across requests
+  StatusBuffer<STATUS_TEXT_BUFFER> statusText;
+  StatusBuffer<STATUS_JSON_BUFFER> statusJson;
+  StatusBuffer<STATUS_METRICS_BUFFER> statusMetrics;
+  
+  // Send path statistics
+  uint32_t slowClientDisconnects;
+  uint32_t sendBudgetExhausted;
+  uint32_t maxSendTimeUs;
   
   // Web server route handlers
   void handleRoot();
   void handleStatus();
+  void handleStatusJson();
+  void handleMetrics();
   void handleGCodeList();
   void handleGCodeGet();
   void handleGCodeAdd();
+  void handleGCodeUpload();
   void handleGCodeRemove();
+  void handleGCodeSimulate();
+  void handleJobList();
+  void handleJobGet();
   void handleNotFound();
   
   // WebSocket handlers
   void webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
-  void processWebSocketCommand(String command);
+  void processWebSocketCommand(uint8_t num, const uint8_t* payload, size_t length);
+  static bool parseWebSocketCommand(const uint8_t* payload, size_t length, WsCommand& cmd);
+  void sendAck(uint8_t num, const WsCommand& cmd, bool ok, const char* format = nullptr, ...);
+  
+  // Command table: one handler per opcode
+  enum WsArgMode : uint8_t {
+    WS_ARG_NONE,            // Opcode only
+    WS_ARG_INT,             // Opcode followed by a signed integer
+    WS_ARG_TEXT             // Anything, checked by the handler
+  };
+  struct WsCommandSpec {
+    char op;
+    WsArgMode argMode;
+    void (WebInterface::*handler)(uint8_t num, const WsCommand& cmd);
+  };
+  static const WsCommandSpec wsCommands[];
+  
+  void cmdStatus(uint8_t num, const WsCommand& cmd);
+  void cmdKey(uint8_t num, const WsCommand& cmd);
+  void cmdEmergencyStop(uint8_t num, const WsCommand& cmd);
+  void cmdReleaseEmergencyStop(uint8_t num, const WsCommand& cmd);
+  void cmdJog(uint8_t num, const WsCommand& cmd);
+  void cmdPitch(uint8_t num, const WsCommand& cmd);
+  void cmdOverride(uint8_t num, const WsCommand& cmd);
+  void cmdMode(uint8_t num, const WsCommand& cmd);
+  void cmdStart(uint8_t num, const WsCommand& cmd);
+  void cmdStop(uint8_t num, const WsCommand& cmd);
+  void cmdTelemetry(uint8_t num, const WsCommand& cmd);
+  void cmdRemoveAllGCode(uint8_t num, const WsCommand& cmd);
+  void cmdStreamLines(uint8_t num, const WsCommand& cmd);
+  void cmdSelectProgram(uint8_t num, const WsCommand& cmd);
+  void cmdJob(uint8_t num, const WsCommand& cmd);
+  bool loadJob(const char* jobName);     // Job file I/O, web task only
+  void saveQueuedJobs();
+  void advertiseStreamCredits();
+  bool postKeyTap(uint16_t keyCode);
+  void setTelemetryRate(uint8_t num, int hz);
+  void resetClient(uint8_t num, bool connected);
+  
+  // Outbound queues
+  bool queueText(uint8_t num, const char* message, size_t len);
+  bool queueText(uint8_t num, const String& message);
+  bool sendQueued(uint8_t num);
+  bool sendPendingTelemetry(uint8_t num);
+  void dropSlowClient(uint8_t num, const char* reason);
+  void drainClientQueues();
   
   // GCode file management
-  bool saveGCodeFile(const String& name, const String& content);
-  String loadGCodeFile(const String& name);
+  bool saveGCodeFile(const String& name, const String& content, String& error);
+  bool commitGCodeFile(const String& name, String& error);
+  bool indexGCodeFile(const String& name, const GCodeFileStats& stats, String& error);
+  static bool isValidGCodeName(const String& name);
   bool deleteGCodeFile(const String& name);
-  String listGCodeFiles();
+  bool simulateGCode(const char* name, char* report, size_t len);
+  void pollSerialConsole();
+  void scanStoredPrograms();          // Web task start: index the stored programs
+  void checkNextBinary();             // One stored program per call until all are current
+  
+  // Web task body
+  static void webTask(void* param);
+  
+  // WiFi link
+  static void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+  void updateWiFi();
+  void startStationAttempt(uint32_t now);
+  void stationAttemptFailed(uint32_t now);
+  void startAccessPoint();
+  void setWiFiState(WiFiLinkState state);
+  static const char* getWiFiStateName(WiFiLinkState state);
   
   // Utility functions
-  String urlDecode(String str);
-  String getStatusInfo();
+  void renderStatusText();
+  void renderStatusJson();
+  void renderMetrics();
+  uint32_t getClientQueueBytes();
+  uint32_t getTelemetryDropped();
   
 public:
   WebInterface();
   ~WebInterface();
   
   // Initialization and control
-  bool initializeWiFi(const char* ssid, const char* password);
-  bool startAccessPoint(const char* ssid, const char* password = nullptr);
+  void beginWiFi(const WiFiLinkConfig& config);  // Returns at once, link comes up in the background
   bool startWebServer();
   void stopWebServer();
   
-  // Main update function
+  // Serve HTTP/WebSocket clients - called from the web task only
   void update();
   
   // Status and control
   bool isWiFiConnected();
+  WiFiLinkState getWiFiState() const { return wifiState; }
+  void showWiFiChanges();              // Controller side - display follows the link
+  void recordBootReady(uint32_t ms) { bootReadyMs = ms; }
   bool isWebServerRunning();
   String getIPAddress();
   void broadcastMessage(const String& message);
   
   // Command interface
   void processCommand(const String& command);
-  void sendMotionStatus();
+  void sendTelemetry();
 };
 
 // Global web interface instance
@@ -1,6 +1,8 @@
 #ifndef INDEXHTML_H
 #define INDEXHTML_H
 
+// Served gzip-compressed from indexhtml_gz.h - run tools/gzip_indexhtml.py after editing
+
 const char indexhtml[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html lang="en">
@@ -89,6 +91,15 @@ const char indexhtml[] PROGMEM = R"rawliteral(
     .remove-icon:hover {
       color: #c82333;
     }
+    .simulate-icon {
+      cursor: pointer;
+      color: #007bff;
+      font-size: 16px;
+      width: 20px;
+    }
+    .simulate-icon:hover {
+      color: #0056b3;
+    }
     button.disabled {
       background-color: #ccc;
       cursor: not-allowed;
@@ -114,6 +125,12 @@ const char indexhtml[] PROGMEM = R"rawliteral(
       font-size: 0.9em;
       color: #666;
     }
+    .override-container {
+      align-items: center;
+      display: flex;
+      gap: 10px;
+      margin-bottom: 10px;
+    }
     .checkbox-container {
       align-items: center;
       display: flex;
@@ -137,6 +154,7 @@ const char indexhtml[] PROGMEM = R"rawliteral(
   </p>
   <h2>Stored GCode</h2>
   <div id="gcode-list"></div>
+  <pre id="simulation" hidden></pre>
   <p id="free-space"></p>
   <h2>Add GCode</h2>
   <p>You can generate suitable GCode using <a href="https://kachurovskiy.com/lathecode/" target="_blank">lathecode</a> by uploading STL model of the part
@@ -149,6 +167,38 @@ const char indexhtml[] PROGMEM = R"rawliteral(
     <label for="remove-comments">Remove comments before saving</label>
   </div>
 
+  <h2>Override</h2>
+  <div class="override-container">
+    <label for="feed-override">Feed</label>
+    <input type="range" id="feed-override" min="10" max="200" step="5" value="100">
+    <span id="feed-override-value">100%</span>
+    <label for="rapid-override">Rapid</label>
+    <input type="range" id="rapid-override" min="10" max="100" step="5" value="100">
+    <span id="rapid-override-value">100%</span>
+  </div>
+
+  <h2>Job</h2>
+  <p>For batch production set up and run each operation of the part once, add it to the job and save the job.
+    Every following part is then a single Enter on the keyboard or Run part here; Esc leaves the job.</p>
+  <div class="override-container">
+    <button id="job-add">Add current setup</button>
+    <button id="job-clear">Clear</button>
+    <input type="text" id="job-name" placeholder="Job name">
+    <button id="job-save">Save</button>
+    <button id="job-run">Run part</button>
+    <button id="job-stop">Stop</button>
+  </div>
+  <div id="job-list"></div>
+  <p id="job-status"></p>
+
+  <h2>Cycle time</h2>
+  <p>Time left in the current pass and the whole operation for turn, face, cut and thread, once set up.
+    The estimate learns from every finished pass; above the max RPM the carriage cannot keep up with the spindle.</p>
+  <p id="cycle-status">No operation set up</p>
+
+  <h2>Live telemetry</h2>
+  <pre id="telemetry">Waiting for data...</pre>
+
   <h2>WebSocket realtime communication</h2>
   <div id="log"></div>
   <div id="command-container">
@@ -161,8 +211,23 @@ const char indexhtml[] PROGMEM = R"rawliteral(
     <li><code>=20</code> send key code 20 as if it's pressed on the keyboard</li>
     <li><code>!</code> turns the controller off</li>
     <li><code>~</code> turns the controller on</li>
+    <li><code>X100</code>, <code>Z-100</code> jog an axis by a number of steps</li>
+    <li><code>P12500</code> sets the pitch in deci-microns per revolution (not while an operation runs)</li>
+    <li><code>F120</code> sets the feed override in percent (10-200), <code>V50</code> the rapid override (10-100);
+      both apply live, threading keeps the programmed lead</li>
+    <li><code>M1</code> selects a mode (0 gearbox, 1 turn, 2 face, 3 thread, 4 cone, 5 cut, 6 async, 7 ellipse, 8 GCode)</li>
+    <li><code>S</code> advances setup or starts the operation, like Enter</li>
+    <li><code>H</code> stops a running operation</li>
     <li><code>""</code> removes all GCode</li>
+    <li><code>&gt;G1 X10</code> streams GCode lines (newline separated) for GCode mode, <code>&gt;</code> alone asks for credits;
+      never send more bytes than the credits in the last ack or <code>C&lt;credits&gt;</code> message (see <code>tools/gcode_stream.py</code>)</li>
+    <li><code>Rpart</code> runs the stored GCode <code>part</code> on the next GCode mode start, <code>R</code> alone runs streamed lines</li>
+    <li><code>Jadd</code> adds the operation set up by hand to the job, <code>Jclear</code> empties it,
+      <code>Jsave part</code> and <code>Jload part</code> store and load job <code>part</code>,
+      <code>Jrun</code> runs the next part and <code>Jstop</code> stops it and leaves the job</li>
+    <li><code>T10</code> streams binary telemetry to this client at 10 Hz (1-100, <code>T0</code> stops)</li>
   </ul>
+  <p>Every command is answered with one line <code>@&lt;seq&gt; &lt;command&gt; ok [value]</code> or <code>@&lt;seq&gt; &lt;command&gt; err &lt;reason&gt;</code>, where seq counts the commands sent on this connection.</p>
 
   <script>
     const log = document.getElementById('log');
@@ -174,14 +239,22 @@ const char indexhtml[] PROGMEM = R"rawliteral(
     const addGcodeButton = document.getElementById('add-gcode');
     const removeCommentsCheckbox = document.getElementById('remove-comments');
 
+    const telemetryElement = document.getElementById('telemetry');
+
     const ws = new WebSocket(`ws://${window.location.host.split(':')[0]}:81`);
+    ws.binaryType = 'arraybuffer';
 
     ws.onopen = () => {
       logMessage('Connected to server');
+      ws.send('T10\n');
     };
 
     ws.onmessage = (event) => {
-      logMessage('Received: ' + event.data);
+      if (event.data instanceof ArrayBuffer) {
+        decodeTelemetry(event.data);
+      } else {
+        logMessage('Received: ' + event.data);
+      }
     };
 
     ws.onclose = () => {
@@ -217,10 +290,95 @@ const char indexhtml[] PROGMEM = R"rawliteral(
       if (event.key === 'Enter') send();
     });
 
+    // Overrides apply on release; telemetry moves the sliders when the keys or MPG change them
+    const overrideControls = [['feed-override', 'F', 12], ['rapid-override', 'V', 13]].map(([id, op, field]) => {
+      const slider = document.getElementById(id);
+      const label = document.getElementById(id + '-value');
+      slider.addEventListener('input', () => label.textContent = slider.value + '%');
+      slider.addEventListener('change', () => ws.send(op + slider.value + '\n'));
+      return { slider, label, field };
+    });
+
     sendButton.addEventListener('click', () => {
       send();
     });
 
+    // Job commands go over the WebSocket; the outcome is read back from /status.json
+    const jobNameInput = document.getElementById('job-name');
+    const jobStatusElement = document.getElementById('job-status');
+    let jobStatus = null;
+
+    function formatPartTime(ms) {
+      const seconds = Math.round(ms / 1000);
+      return `${Math.floor(seconds / 60)}:${String(seconds % 60).padStart(2, '0')}`;
+    }
+
+    function showJobStatus() {
+      if (!jobStatus) return;
+      const parts = telemetry ? telemetry[14] : jobStatus.parts;
+      const partMs = telemetry ? telemetry[15] : jobStatus.partMs;
+      const running = jobStatus.state === 'running' ? `, running op ${jobStatus.operation + 1}` : '';
+      jobStatusElement.textContent = `${jobStatus.name || '(not saved)'}: ${jobStatus.operations} operations${running}, ` +
+        `${parts} parts, part ${formatPartTime(partMs)}, average ${formatPartTime(jobStatus.avgPartMs)}` +
+        (jobStatus.message ? ` - ${jobStatus.message}` : '');
+    }
+
+    // Remaining time is not in the telemetry, so /status.json is polled for it
+    const cycleStatusElement = document.getElementById('cycle-status');
+
+    function showCycleStatus(cycle) {
+      if (!cycle.valid) {
+        cycleStatusElement.textContent = 'No operation set up';
+        return;
+      }
+      const time = seconds => seconds < 0 ? '--:--' : formatPartTime(seconds * 1000);
+      cycleStatusElement.textContent = `Pass ${time(cycle.passSeconds)}, total ${time(cycle.totalSeconds)}` +
+        (cycle.maxRpm > 0 ? `, max ${cycle.maxRpm} RPM` : '') +
+        ` (learnt from ${cycle.passesLearnt} passes: moves x${cycle.moveFactor.toFixed(2)}, cuts x${cycle.cutFactor.toFixed(2)})`;
+    }
+
+    function fetchStatus() {
+      fetch('/status.json')
+        .then(response => response.json())
+        .then(data => {
+          jobStatus = data.job;
+          showJobStatus();
+          showCycleStatus(data.cycle);
+        });
+    }
+
+    function jobCommand(command) {
+      logMessage('Sent: ' + command);
+      ws.send(command + '\n');
+      setTimeout(() => { fetchStatus(); listJobs(); }, 300);
+    }
+
+    function listJobs() {
+      fetch('/job/list')
+        .then(response => response.text())
+        .then(data => {
+          const jobList = document.getElementById('job-list');
+          jobList.innerHTML = '';
+          data.split('\n').filter(name => !!name).forEach(name => {
+            const row = document.createElement('div');
+            row.className = 'gcode-row';
+            row.textContent = name;
+            row.title = 'Load job';
+            row.addEventListener('click', () => {
+              jobNameInput.value = name;
+              jobCommand('Jload ' + name);
+            });
+            jobList.appendChild(row);
+          });
+        });
+    }
+
+    document.getElementById('job-add').addEventListener('click', () => jobCommand('Jadd'));
+    document.getElementById('job-clear').addEventListener('click', () => jobCommand('Jclear'));
+    document.getElementById('job-save').addEventListener('click', () => jobCommand('Jsave ' + jobNameInput.value.trim()));
+    document.getElementById('job-run').addEventListener('click', () => jobCommand('Jrun'));
+    document.getElementById('job-stop').addEventListener('click', () => jobCommand('Jstop'));
+
     function removeComments(content) {
       return content.split('\n').map(line => line.split(';')[0].trim()).filter(line => !!line).join('\n');
     }
@@ -232,10 +390,12 @@ const char indexhtml[] PROGMEM = R"rawliteral(
         content = removeComments(content);
       }
       if (name && content) {
+        // Multipart upload is streamed to flash, so program size is not limited by controller RAM
+        const form = new FormData();
+        form.append('gcode', new Blob([content], { type: 'text/plain' }), name + '.gcode');
         fetch('/gcode/add', {
           method: 'POST',
-          headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
-          body: new URLSearchParams({ name, gcode: content })
+          body: form
         })
         .then(response => response.text())
         .then(data => {
@@ -255,13 +415,15 @@ const char indexhtml[] PROGMEM = R"rawliteral(
           gcodeList.innerHTML = '';
           gcodeList.classList.toggle('empty', !data);
           if (data) {
-            data.split('\n').map(g => g.trim()).filter(g => !!g).forEach(gcode => {
+            // Each line: name \t size \t lines \t crc32
+            data.split('\n').map(l => l.split('\t')).filter(f => !!f[0].trim()).forEach(([gcode, size, lines]) => {
               const row = document.createElement('div');
               row.className = 'gcode-row';
               row.dataset.name = gcode;
               row.innerHTML = `
                 <span class="gcode-item" data-name="${gcode}">${gcode}</span>
-                <span class="gcode-size"></span>
+                <span class="gcode-size">${(Number(size) / 1024).toFixed(1)} KB, ${lines} lines</span>
+                <span class="simulate-icon" data-name="${gcode}">&#9655;</span>
                 <span class="remove-icon" data-name="${gcode}">&times;</span>
               `;
               row.addEventListener('click', (event) => {
@@ -269,11 +431,13 @@ const char indexhtml[] PROGMEM = R"rawliteral(
               });
               row.title = 'Click to load G-code';
               gcodeList.appendChild(row);
-              fetch(`/gcode/get?name=${encodeURIComponent(gcode)}`)
-                .then(response => response.text())
-                .then(text => {
-                  row.querySelector('.gcode-size').textContent = `${(text.length / 1024).toFixed(1)} KB`;
-                })
+            });
+            document.querySelectorAll('.simulate-icon').forEach(icon => {
+              icon.title = 'Dry run from the current position: cycle time, travel and limits';
+              icon.addEventListener('click', (event) => {
+                event.stopPropagation();
+                simulateGcode(event.target.getAttribute('data-name'));
+              });
             });
             document.querySelectorAll('.remove-icon').forEach(icon => {
               icon.title = 'Click to remove G-code';
@@ -299,6 +463,17 @@ const char indexhtml[] PROGMEM = R"rawliteral(
         });
     }
 
+    function simulateGcode(name) {
+      const simulation = document.getElementById('simulation');
+      simulation.hidden = false;
+      simulation.textContent = `Simulating ${name}...`;
+      fetch(`/gcode/simulate?name=${encodeURIComponent(name)}`)
+        .then(response => response.text())
+        .then(data => {
+          simulation.textContent = `${name}\n${data}`;
+        });
+    }
+
     function removeGcode(name) {
       fetch('/gcode/remove', {
         method: 'POST',
@@ -324,6 +499,58 @@ const char indexhtml[] PROGMEM = R"rawliteral(
         });
     }
 
+    // Binary telemetry: key frames carry every field, delta frames only the changes
+    const TELEMETRY_FIELDS = ['X', 'Z', 'Target X', 'Target Z', 'Spindle', 'RPM',
+      'Following error X', 'Following error Z', 'Mode', 'State', 'Pass', 'Passes',
+      'Feed override %', 'Rapid override %', 'Job parts', 'Job part ms'];
+    let telemetry = null;
+    let telemetrySeq = 0;
+
+    function readVarint(view, pos) {
+      let value = 0, scale = 1, b;
+      do {
+        b = view.getUint8(pos.i++);
+        value += (b & 0x7f) * scale;
+        scale *= 128;
+      } while (b & 0x80);
+      return value;
+    }
+
+    function decodeTelemetry(buffer) {
+      const view = new DataView(buffer);
+      const type = view.getUint8(0);
+      const flags = view.getUint8(1);
+      const seq = view.getUint32(2, true);
+      const pos = { i: 6 };
+      if (type === 1) {
+        pos.i += 4;
+        const count = view.getUint8(pos.i++);
+        telemetry = [];
+        for (let f = 0; f < count; f++, pos.i += 4) telemetry.push(view.getInt32(pos.i, true));
+      } else if (type === 2 && telemetry && seq === telemetrySeq + 1) {
+        readVarint(view, pos);
+        const mask = view.getUint16(pos.i, true);
+        pos.i += 2;
+        for (let f = 0; f < TELEMETRY_FIELDS.length; f++) {
+          if (mask & (1 << f)) {
+            const z = readVarint(view, pos);
+            telemetry[f] += (z % 2) ? -(z + 1) / 2 : z / 2;
+          }
+        }
+      } else {
+        return;
+      }
+      telemetrySeq = seq;
+      const state = [flags & 1 ? 'E-STOP' : 'READY', flags & 2 ? 'X moving' : '', flags & 4 ? 'Z moving' : '',
+        flags & 32 ? 'threading' : ''].filter(s => !!s).join(', ');
+      overrideControls.filter(c => document.activeElement !== c.slider && telemetry[c.field] !== undefined).forEach(c => {
+        c.slider.value = telemetry[c.field];
+        c.label.textContent = telemetry[c.field] + '%';
+      });
+      telemetryElement.textContent = TELEMETRY_FIELDS.map((name, f) => `${name}: ${telemetry[f]}`).join('\n') + '\n' + state;
+      showJobStatus();
+    }
+
     function logMessage(message) {
       const p = document.createElement('p');
       p.textContent = message;
@@ -332,6 +559,9 @@ const char indexhtml[] PROGMEM = R"rawliteral(
     }
 
     listGcodes();
+    listJobs();
+    fetchStatus();
+    setInterval(fetchStatus, 1000);
   </script>
 </body>
 </html>
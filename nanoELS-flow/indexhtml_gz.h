@@ -0,0 +1,405 @@
+#ifndef INDEXHTML_GZ_H
+#define INDEXHTML_GZ_H
+
+// Generated by tools/gzip_indexhtml.py from indexhtml.h - do not edit
+// 20859 bytes -> 6270 bytes gzip
+
+#define INDEXHTML_ETAG "\"61348626026ef6dc\""
+
+const size_t indexhtml_gz_len = 6270;
+const uint8_t indexhtml_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0x6b, 0x77, 0xdb, 0xb6,
+  0x92, 0xdf, 0xfb, 0x2b, 0x10, 0x35, 0x8d, 0xa4, 0x46, 0x6f, 0xc7, 0x69, 0xae, 0x2c, 0xb9, 0x9b,
+  0x38, 0x76, 0x93, 0x6e, 0xdc, 0xfa, 0xd8, 0xee, 0xd3, 0xf5, 0xa9, 0x29, 0x12, 0x92, 0x58, 0x53,
+  0x24, 0x4b, 0x40, 0x76, 0x54, 0x5f, 0xed, 0x6f, 0xdf, 0x99, 0x01, 0x48, 0x02, 0x24, 0x25, 0x2b,
+  0xbd, 0xdb, 0x3d, 0x3d, 0x8d, 0x25, 0x62, 0x30, 0x18, 0xcc, 0x7b, 0x06, 0xa0, 0x3e, 0x1b, 0x3d,
+  0x79, 0xfb, 0xfd, 0xd1, 0xe5, 0x2f, 0x67, 0xc7, 0x6c, 0x2e, 0x17, 0xc1, 0xe1, 0x67, 0x23, 0xfc,
+  0xc3, 0x02, 0x27, 0x9c, 0x8d, 0x6b, 0x3c, 0xac, 0xe1, 0x03, 0xee, 0x78, 0x87, 0x9f, 0x31, 0x36,
+  0x5a, 0x70, 0xe9, 0x30, 0x77, 0xee, 0x24, 0x82, 0xcb, 0x71, 0xed, 0x87, 0xcb, 0x93, 0xf6, 0xab,
+  0x5a, 0x3e, 0x10, 0x3a, 0x0b, 0x3e, 0xae, 0xdd, 0xf9, 0xfc, 0x3e, 0x8e, 0x12, 0x59, 0x63, 0x6e,
+  0x14, 0x4a, 0x1e, 0x02, 0xe0, 0xbd, 0xef, 0xc9, 0xf9, 0xd8, 0xe3, 0x77, 0xbe, 0xcb, 0xdb, 0xf4,
+  0xa5, 0xc5, 0xfc, 0xd0, 0x97, 0xbe, 0x13, 0xb4, 0x85, 0xeb, 0x04, 0x7c, 0xdc, 0xef, 0xf4, 0x14,
+  0x22, 0xe9, 0xcb, 0x80, 0x1f, 0x7e, 0xe7, 0x84, 0xd1, 0x71, 0x20, 0xd8, 0xbb, 0xfd, 0x51, 0x57,
+  0x3d, 0xc1, 0xb1, 0xc0, 0x0f, 0x6f, 0x59, 0xc2, 0x83, 0x71, 0xcd, 0x07, 0xd4, 0x35, 0x36, 0x4f,
+  0xf8, 0x74, 0x5c, 0xf3, 0x1c, 0xe9, 0x0c, 0x0f, 0x26, 0x8e, 0xe0, 0x2f, 0x5f, 0xb4, 0x14, 0x12,
+  0x21, 0x57, 0x6a, 0x0a, 0x63, 0x93, 0xc8, 0x5b, 0xb1, 0x07, 0xfa, 0xc8, 0xd8, 0x14, 0x08, 0x6a,
+  0x4f, 0x9d, 0x85, 0x1f, 0xac, 0x86, 0xec, 0x3c, 0x9a, 0x44, 0x32, 0x6a, 0x31, 0xe1, 0x84, 0xa2,
+  0x2d, 0x78, 0xe2, 0x4f, 0x0f, 0x34, 0xd8, 0xc2, 0x49, 0x66, 0x7e, 0x38, 0x64, 0x3d, 0xe6, 0x2c,
+  0x65, 0x94, 0x3f, 0xfd, 0xa8, 0x68, 0x1f, 0xb2, 0x57, 0xbd, 0x5e, 0xfc, 0x31, 0x7d, 0x1e, 0x3b,
+  0x9e, 0xe7, 0x87, 0xb3, 0x21, 0x1b, 0x18, 0x0f, 0x27, 0x8e, 0x7b, 0x3b, 0x4b, 0xa2, 0x65, 0xe8,
+  0xb5, 0xdd, 0x28, 0x88, 0x92, 0x21, 0xfb, 0x7c, 0xfa, 0x02, 0xff, 0x53, 0x00, 0x6b, 0xfa, 0x77,
+  0xde, 0x6f, 0xb1, 0xf9, 0x20, 0xa3, 0x2e, 0x05, 0xdc, 0xdb, 0xdb, 0x33, 0xa1, 0xfc, 0x30, 0x5e,
+  0xca, 0x2b, 0xb9, 0x8a, 0xf9, 0x58, 0xf2, 0x8f, 0xf2, 0xba, 0xc5, 0xf0, 0x8f, 0x93, 0x70, 0x27,
+  0x9b, 0xa9, 0xc9, 0xea, 0xf7, 0x7a, 0x5f, 0x98, 0x33, 0x3f, 0x0f, 0xa2, 0x59, 0x06, 0x33, 0xe7,
+  0xfe, 0x6c, 0x2e, 0x91, 0x4a, 0x83, 0xcc, 0xe8, 0x8e, 0x27, 0xd3, 0x20, 0xba, 0x6f, 0x03, 0x3f,
+  0x84, 0x9b, 0x44, 0x41, 0x90, 0x6d, 0x20, 0x4a, 0x3c, 0x0e, 0xd4, 0xf4, 0xe3, 0x8f, 0x4c, 0x44,
+  0x81, 0xef, 0xb1, 0xcf, 0x5d, 0xd7, 0x2d, 0xed, 0xb9, 0xff, 0xc8, 0x9e, 0xa7, 0x05, 0xa6, 0xb6,
+  0x81, 0xe7, 0x32, 0x5a, 0x98, 0xcc, 0x32, 0x68, 0x8d, 0x33, 0x6a, 0xb3, 0x05, 0x7a, 0x25, 0xa1,
+  0x58, 0xb3, 0xdc, 0x68, 0xb1, 0x70, 0x68, 0xc1, 0x50, 0x3a, 0x7e, 0xc8, 0x93, 0x16, 0xfb, 0x7c,
+  0xe6, 0x46, 0x1e, 0xcf, 0x9f, 0x64, 0x38, 0x3d, 0x5f, 0xc4, 0x81, 0x03, 0x3b, 0x9d, 0x06, 0x3c,
+  0x23, 0xda, 0x09, 0xfc, 0x59, 0xd8, 0xf6, 0x25, 0x5f, 0x88, 0x21, 0x73, 0x41, 0x5b, 0x79, 0xb2,
+  0x2b, 0xc5, 0x7a, 0xed, 0x5c, 0xbb, 0x00, 0x2d, 0x70, 0x64, 0x3b, 0x8f, 0xb6, 0xb2, 0x55, 0x8d,
+  0xb6, 0x13, 0xc7, 0xf3, 0x97, 0x40, 0xce, 0x8b, 0x7c, 0x9e, 0xa6, 0x25, 0x51, 0x32, 0xec, 0x17,
+  0x48, 0x99, 0x2c, 0x81, 0xc4, 0xb0, 0xcc, 0x3c, 0x84, 0xb3, 0xd5, 0x52, 0x2f, 0x1f, 0x46, 0x21,
+  0x7f, 0x7c, 0x51, 0x77, 0x99, 0x08, 0x14, 0x63, 0x1c, 0xf9, 0x26, 0x5f, 0x2a, 0x84, 0x5b, 0x21,
+  0xfa, 0x41, 0xff, 0xd5, 0xab, 0xbd, 0x57, 0x65, 0x2a, 0x87, 0x73, 0x54, 0xba, 0x8c, 0xd6, 0x8a,
+  0x99, 0xfd, 0xde, 0xfe, 0x64, 0xd0, 0xb7, 0x58, 0xad, 0x44, 0x1a, 0xf8, 0x42, 0x66, 0x13, 0x35,
+  0x47, 0x64, 0x14, 0x3f, 0x6e, 0x79, 0x39, 0xa1, 0x65, 0xbd, 0xfa, 0x7b, 0x12, 0x29, 0xd1, 0xd5,
+  0xe1, 0x8b, 0x58, 0xae, 0xaa, 0x45, 0x90, 0x22, 0x43, 0xbb, 0x6d, 0x93, 0xc2, 0xd9, 0xaa, 0x66,
+  0x21, 0x43, 0x27, 0x6a, 0x29, 0x31, 0x00, 0xe6, 0xdc, 0x8a, 0x3e, 0xb6, 0x85, 0xff, 0x17, 0x61,
+  0xd6, 0xa4, 0xc1, 0xa3, 0x7f, 0x52, 0xe3, 0x52, 0xed, 0x2f, 0xaa, 0xdc, 0x06, 0x02, 0x2b, 0xbd,
+  0x4c, 0xc2, 0x81, 0x66, 0x3e, 0x64, 0x20, 0x77, 0xe9, 0x83, 0xbb, 0x37, 0xf1, 0x74, 0x12, 0xbe,
+  0x00, 0x85, 0x68, 0xa3, 0x47, 0xcf, 0x3d, 0xe1, 0x76, 0xc5, 0xf3, 0xdc, 0xbd, 0xfd, 0x17, 0xfb,
+  0x07, 0xa6, 0x53, 0x57, 0x0b, 0xf4, 0x5f, 0xe6, 0x8b, 0x6a, 0x9f, 0x58, 0xb4, 0x5a, 0x73, 0xbd,
+  0x82, 0x2a, 0xa6, 0xe8, 0xdd, 0x57, 0x83, 0x82, 0x0b, 0xee, 0x08, 0x7f, 0xb1, 0x0c, 0x1c, 0xf9,
+  0x69, 0x64, 0xf6, 0x7a, 0x5f, 0x4d, 0x72, 0xcd, 0xfb, 0x44, 0x32, 0xad, 0x15, 0x37, 0x10, 0xda,
+  0xeb, 0xed, 0xbf, 0x9c, 0xec, 0x95, 0x4d, 0xac, 0x03, 0x9e, 0xce, 0x99, 0x04, 0xdc, 0xdb, 0x66,
+  0x65, 0x86, 0x12, 0xa4, 0xfb, 0x08, 0x23, 0x54, 0x4f, 0x08, 0x07, 0xdc, 0xdb, 0x82, 0xf4, 0x71,
+  0x03, 0xce, 0x50, 0xeb, 0xbd, 0x28, 0x55, 0x49, 0xa2, 0xfb, 0xed, 0xae, 0xf8, 0x8f, 0xa5, 0x90,
+  0xfe, 0x74, 0x95, 0xea, 0x14, 0x44, 0xa4, 0xd8, 0x81, 0x7c, 0x61, 0xc2, 0xe5, 0x3d, 0xe7, 0xe1,
+  0x0e, 0x0e, 0xbb, 0x52, 0xff, 0x2b, 0x85, 0x54, 0x24, 0xec, 0xf1, 0x3d, 0x4d, 0x7b, 0xf8, 0x5f,
+  0xc5, 0x6c, 0xa4, 0xa4, 0x3a, 0x04, 0x58, 0x60, 0x28, 0x79, 0x0b, 0xac, 0x0d, 0x19, 0x8b, 0x2f,
+  0x30, 0x97, 0xc8, 0x69, 0x35, 0x74, 0xa4, 0xd7, 0xf9, 0x17, 0x5f, 0x14, 0x35, 0xea, 0xe5, 0xcb,
+  0x97, 0x16, 0x6a, 0x24, 0x3a, 0xf1, 0x2b, 0x83, 0xdd, 0x16, 0x36, 0x55, 0x32, 0x7f, 0xe6, 0xc4,
+  0x36, 0xdf, 0x1e, 0xb1, 0xff, 0x8e, 0x3b, 0xe7, 0xee, 0x2d, 0xfa, 0xa3, 0xff, 0x7c, 0xed, 0xbf,
+  0xb1, 0x14, 0x25, 0x45, 0x85, 0x58, 0xa0, 0xe3, 0x5d, 0xfe, 0x8f, 0x6d, 0x54, 0xa3, 0xae, 0x4e,
+  0x0b, 0x47, 0x5d, 0x95, 0xcf, 0x8e, 0x30, 0x37, 0xa4, 0x7c, 0x71, 0xde, 0xb7, 0x32, 0x4e, 0xf8,
+  0x8a, 0x4f, 0xe3, 0xc3, 0xcb, 0xb9, 0x2f, 0xd8, 0x4f, 0x7c, 0xc2, 0x7e, 0x78, 0xcf, 0xe0, 0x13,
+  0x24, 0x89, 0x77, 0x60, 0x54, 0xd3, 0x24, 0x5a, 0xb0, 0x55, 0xb4, 0x4c, 0x58, 0x3a, 0x09, 0xe9,
+  0xc2, 0xe4, 0x09, 0x08, 0x5b, 0x80, 0x7b, 0x49, 0x56, 0x1d, 0xf6, 0x5e, 0x32, 0x2f, 0xe2, 0x22,
+  0xac, 0x4b, 0x16, 0x72, 0x98, 0xf4, 0x1e, 0xb9, 0x10, 0x72, 0x89, 0xb0, 0x21, 0x77, 0xa5, 0x0f,
+  0x16, 0xc5, 0x5e, 0x87, 0x2b, 0x08, 0xc4, 0x0c, 0x5c, 0x0a, 0xa1, 0x0b, 0x22, 0x70, 0x8e, 0x00,
+  0x2e, 0xef, 0xa3, 0xe4, 0x96, 0xcd, 0x1d, 0xc1, 0x1c, 0xd7, 0xe5, 0x42, 0x30, 0x19, 0x31, 0x5f,
+  0x76, 0x46, 0xdd, 0x58, 0xd3, 0x45, 0x7b, 0x7a, 0x8f, 0xb8, 0x16, 0x8b, 0x65, 0x08, 0x2e, 0x55,
+  0x72, 0x01, 0x9e, 0x44, 0xce, 0x33, 0x8a, 0xfc, 0x90, 0x0d, 0xd8, 0xbd, 0xb3, 0x12, 0x1d, 0x76,
+  0x12, 0x25, 0x90, 0xe3, 0xde, 0x81, 0x61, 0xb4, 0x60, 0x05, 0x07, 0x2d, 0x84, 0x61, 0xda, 0x42,
+  0x8e, 0x10, 0xbf, 0x08, 0x19, 0x25, 0x40, 0xe1, 0x37, 0x47, 0xa0, 0xa7, 0x6c, 0xea, 0x07, 0x80,
+  0xcb, 0x97, 0x6c, 0x29, 0xe0, 0xef, 0xbb, 0xcb, 0xcb, 0x33, 0x06, 0x44, 0x01, 0x46, 0x39, 0x77,
+  0x60, 0x41, 0x27, 0x64, 0x62, 0x09, 0x44, 0x01, 0x3c, 0xa0, 0x9d, 0x3a, 0x7e, 0xa0, 0x73, 0x54,
+  0xcf, 0xbf, 0xf3, 0xbd, 0x25, 0x40, 0xae, 0x08, 0xb9, 0x9f, 0x6f, 0xdf, 0x99, 0x4e, 0x61, 0xbf,
+  0x30, 0x9f, 0xc3, 0x92, 0x4e, 0x20, 0xfd, 0x05, 0x37, 0x08, 0x07, 0x3e, 0x28, 0xca, 0x71, 0xbc,
+  0xcc, 0xcf, 0x0e, 0x09, 0xce, 0xda, 0x37, 0xee, 0x67, 0x03, 0xa2, 0x94, 0x6c, 0x10, 0xd9, 0x45,
+  0xe4, 0xde, 0x72, 0xa9, 0xa8, 0x06, 0xd1, 0x39, 0x01, 0x32, 0x83, 0x45, 0x31, 0x0f, 0x89, 0x3e,
+  0xdc, 0xc8, 0x84, 0x23, 0xb4, 0x87, 0xdc, 0x15, 0x1c, 0x9f, 0xa9, 0x7c, 0x8e, 0xd8, 0x8d, 0xd4,
+  0x18, 0x52, 0x55, 0xfc, 0x72, 0xb9, 0x7f, 0x87, 0x9b, 0x10, 0x71, 0x14, 0xe2, 0x32, 0xa4, 0x08,
+  0x20, 0x18, 0x22, 0xeb, 0x3c, 0x25, 0x09, 0x13, 0x59, 0x44, 0xef, 0x04, 0x22, 0xca, 0xd6, 0x98,
+  0x02, 0xd1, 0x1e, 0x9f, 0x2c, 0x67, 0x33, 0xe2, 0xb8, 0x1f, 0xba, 0x1c, 0xd5, 0x09, 0x0a, 0xa0,
+  0x2a, 0x5e, 0x64, 0x7c, 0x50, 0x54, 0xc6, 0x49, 0x04, 0x8e, 0x77, 0x01, 0x00, 0x2e, 0x73, 0x52,
+  0x49, 0xcc, 0x1d, 0xd0, 0xa3, 0x00, 0xf7, 0x46, 0x0b, 0x4c, 0x56, 0x44, 0x33, 0x24, 0xf1, 0xe0,
+  0x2b, 0x4d, 0xae, 0xcd, 0x07, 0x87, 0x17, 0x86, 0x80, 0x41, 0xbb, 0x07, 0xf4, 0x1c, 0x04, 0xc6,
+  0x7c, 0x6f, 0x5c, 0xcb, 0x53, 0x98, 0xda, 0xe1, 0xa8, 0x0b, 0x4f, 0x15, 0xaf, 0x13, 0x4e, 0xa3,
+  0x3a, 0x0c, 0xf9, 0x54, 0x6e, 0xf9, 0x9e, 0xc7, 0x43, 0x00, 0x82, 0x41, 0x05, 0x44, 0x20, 0x53,
+  0x58, 0xb1, 0x4d, 0xae, 0x1a, 0x11, 0x64, 0x8b, 0xbe, 0xf6, 0x8a, 0x2b, 0xc6, 0x87, 0xbf, 0x44,
+  0x4b, 0xda, 0xd3, 0x8c, 0x83, 0x0d, 0x83, 0xd2, 0x82, 0x2e, 0xf9, 0x12, 0x83, 0x8a, 0x56, 0xbe,
+  0xa5, 0x40, 0xee, 0x8c, 0x1c, 0x5d, 0xd9, 0xcd, 0xa5, 0x8c, 0xc5, 0xb0, 0xdb, 0xbd, 0x75, 0xdc,
+  0xf9, 0x32, 0x89, 0xee, 0xc4, 0xad, 0xbf, 0xea, 0x00, 0xbb, 0xba, 0x40, 0x11, 0xb8, 0x04, 0x98,
+  0xd1, 0xad, 0x31, 0xa8, 0x84, 0x66, 0x58, 0x8c, 0xfe, 0x3e, 0x81, 0x8a, 0xf5, 0xb6, 0x76, 0x98,
+  0x8d, 0x8d, 0xba, 0xce, 0x21, 0xb2, 0x65, 0x19, 0xa7, 0x5a, 0x7f, 0x71, 0xf9, 0x81, 0x2d, 0x60,
+  0x24, 0x60, 0xd1, 0x94, 0xb8, 0x15, 0x3b, 0x89, 0x24, 0xe1, 0xa1, 0x7c, 0x45, 0xcc, 0x5d, 0x08,
+  0x3f, 0x08, 0x18, 0xc1, 0x60, 0x82, 0xa3, 0x90, 0x8b, 0x81, 0xd9, 0x0a, 0x16, 0xf8, 0xb7, 0x1c,
+  0xd4, 0x22, 0x0a, 0x14, 0xa4, 0x04, 0xe5, 0x02, 0x57, 0xa6, 0x46, 0x33, 0xbb, 0x54, 0x3e, 0x89,
+  0x0a, 0xb5, 0x1a, 0xa6, 0x7a, 0x35, 0x83, 0xbf, 0x98, 0xd5, 0xd5, 0x18, 0xb8, 0x3e, 0x97, 0xcf,
+  0xa3, 0x00, 0x52, 0xae, 0x71, 0x4d, 0x6d, 0x59, 0x0d, 0x24, 0xfc, 0xcf, 0xa5, 0x8f, 0x32, 0x5a,
+  0xf8, 0x61, 0xc0, 0xc3, 0x19, 0x54, 0xcb, 0xb5, 0x81, 0x2e, 0x88, 0xd3, 0x62, 0x2f, 0x47, 0xa6,
+  0x03, 0x64, 0x25, 0xbe, 0x6c, 0x6c, 0x03, 0x4a, 0xa8, 0xa7, 0x35, 0xc2, 0x4c, 0x0b, 0xdc, 0xc0,
+  0x11, 0x62, 0x5c, 0x2b, 0x7b, 0xd9, 0x9a, 0x32, 0xb8, 0x91, 0x2e, 0x2f, 0x90, 0x00, 0x88, 0xb0,
+  0x6d, 0x22, 0xa2, 0x76, 0x78, 0xe1, 0xdc, 0x01, 0x8f, 0xd5, 0x98, 0x06, 0x34, 0x39, 0x90, 0xa2,
+  0x53, 0x5c, 0xd0, 0x59, 0x17, 0xea, 0x3a, 0x50, 0x27, 0x6a, 0x8c, 0x86, 0xb9, 0xa7, 0x27, 0x06,
+  0xce, 0x04, 0xa4, 0x02, 0x46, 0x52, 0x86, 0x3c, 0x3c, 0xa7, 0x07, 0x2c, 0x7d, 0x00, 0x06, 0x01,
+  0x70, 0x5c, 0xbb, 0xb4, 0x51, 0x97, 0xa6, 0xd2, 0x5e, 0x94, 0xf2, 0x6a, 0xf5, 0xfb, 0x5e, 0x87,
+  0x46, 0x4b, 0xdf, 0xf5, 0x4e, 0xcb, 0x61, 0xb3, 0x56, 0xa6, 0x63, 0x0a, 0x3e, 0xae, 0x9d, 0x42,
+  0xd6, 0x0e, 0x4f, 0xe0, 0xab, 0xb1, 0x58, 0x61, 0xb3, 0x89, 0x13, 0xce, 0xb8, 0xda, 0xa9, 0x3d,
+  0x0f, 0xb9, 0x3f, 0xae, 0xf5, 0x7b, 0x35, 0x6c, 0x1f, 0x80, 0x00, 0x7a, 0xf0, 0x49, 0x48, 0x1e,
+  0x8f, 0x6b, 0xfb, 0x35, 0x76, 0xe7, 0x04, 0x4b, 0x8e, 0xa3, 0xbd, 0x74, 0x7d, 0x30, 0xa3, 0xb0,
+  0x8c, 0xa5, 0x4d, 0x80, 0xb5, 0x43, 0xac, 0xef, 0x21, 0x8a, 0x01, 0x4c, 0x05, 0xdb, 0x9c, 0xd8,
+  0x37, 0xe9, 0x3d, 0xc7, 0xef, 0x3b, 0x11, 0x5c, 0x98, 0x59, 0xa0, 0xb8, 0xbf, 0x2b, 0xc5, 0x36,
+  0x9a, 0x6a, 0x92, 0x6d, 0x11, 0x7d, 0x1b, 0x4d, 0x0c, 0xdf, 0x80, 0x6e, 0x7d, 0xe2, 0x48, 0x77,
+  0x8e, 0xee, 0xce, 0x5b, 0x52, 0x84, 0x04, 0x17, 0x09, 0x1e, 0x3d, 0x56, 0xee, 0x77, 0x19, 0x32,
+  0x0e, 0x8e, 0x00, 0x7d, 0x78, 0xa2, 0x7c, 0xa5, 0x61, 0xc5, 0x10, 0x43, 0x5d, 0x28, 0x9b, 0x40,
+  0x3d, 0x31, 0x08, 0x68, 0x07, 0xfe, 0x47, 0x34, 0x51, 0xf6, 0x0a, 0x9a, 0x9a, 0x3e, 0x50, 0xce,
+  0xfa, 0x18, 0xc8, 0x5c, 0x01, 0xe3, 0x30, 0xd9, 0x45, 0x83, 0x27, 0x14, 0x3e, 0xba, 0x56, 0x8c,
+  0x0f, 0xe8, 0x9f, 0x67, 0xe0, 0x94, 0x8e, 0x31, 0x66, 0x63, 0x74, 0xc6, 0xb9, 0xb7, 0x7c, 0x35,
+  0x89, 0x9c, 0x84, 0xe2, 0xde, 0x39, 0xd0, 0x42, 0x53, 0xc0, 0x4d, 0xf0, 0x03, 0x76, 0x2c, 0x5c,
+  0x16, 0x70, 0x58, 0x44, 0x64, 0xab, 0xa4, 0x3e, 0x61, 0x27, 0xad, 0x33, 0xec, 0x0b, 0xe6, 0xb6,
+  0x61, 0x13, 0x35, 0x72, 0x9f, 0x90, 0xba, 0x26, 0x58, 0x5c, 0x01, 0x17, 0x96, 0x71, 0xc1, 0xd4,
+  0x0a, 0x73, 0x5c, 0x58, 0x1f, 0xf0, 0x1d, 0xe1, 0x9f, 0x2d, 0x46, 0x99, 0xbb, 0x25, 0x9c, 0x54,
+  0xe1, 0x94, 0x40, 0x26, 0xca, 0x25, 0x55, 0x2f, 0x83, 0x9c, 0xac, 0xb4, 0xfc, 0x02, 0x1c, 0x08,
+  0x0b, 0x54, 0x50, 0x73, 0x69, 0x3b, 0x28, 0x38, 0xd3, 0xb8, 0x86, 0x21, 0xca, 0xda, 0x61, 0x1e,
+  0x89, 0xd2, 0x38, 0x85, 0xb0, 0xa5, 0x28, 0x65, 0x60, 0x71, 0xe4, 0x52, 0xe8, 0x00, 0xa4, 0xf5,
+  0xeb, 0x68, 0x05, 0x5c, 0x61, 0x18, 0x93, 0x0d, 0x35, 0xbb, 0xa4, 0x10, 0xcd, 0xa7, 0x12, 0x53,
+  0x24, 0x8a, 0xf2, 0x9a, 0xc9, 0x31, 0x08, 0x89, 0xb4, 0x05, 0x1f, 0xde, 0x03, 0x3f, 0xb8, 0xa1,
+  0x69, 0x18, 0xbe, 0xe5, 0x32, 0x09, 0x5b, 0x90, 0xf2, 0xa0, 0x9e, 0xb9, 0xc0, 0x51, 0x05, 0x0b,
+  0x8e, 0xd4, 0x6b, 0x91, 0xf6, 0x69, 0x65, 0x55, 0x0a, 0x76, 0x09, 0x48, 0x38, 0x94, 0x33, 0x0b,
+  0x8c, 0x72, 0x28, 0x94, 0x50, 0xa7, 0x0b, 0x5c, 0x69, 0x9e, 0x1f, 0xfa, 0x62, 0x0e, 0xce, 0x19,
+  0x57, 0x3d, 0x60, 0xce, 0x24, 0xd2, 0x1a, 0x0a, 0x36, 0xc7, 0xce, 0xcf, 0x4e, 0x15, 0x65, 0x0e,
+  0xe8, 0x8b, 0x33, 0xc3, 0x0f, 0x21, 0x94, 0x66, 0xa0, 0x81, 0x3c, 0x46, 0x6b, 0xc8, 0xd2, 0x25,
+  0x11, 0x43, 0xde, 0x15, 0xf0, 0x3c, 0x31, 0x24, 0x76, 0xb8, 0xb8, 0xed, 0x8c, 0x21, 0xdf, 0x45,
+  0xc6, 0x36, 0x14, 0x85, 0x26, 0x8f, 0x3e, 0x60, 0x46, 0x23, 0x39, 0x64, 0x17, 0x5c, 0x26, 0xab,
+  0x9c, 0x4f, 0x3a, 0xfc, 0x67, 0x23, 0xb5, 0xc3, 0x9f, 0x1c, 0x5f, 0xa2, 0xa9, 0x50, 0x26, 0xe3,
+  0x48, 0xa7, 0xd3, 0xe9, 0xe8, 0x4c, 0x40, 0xa3, 0xca, 0x93, 0xae, 0xea, 0xec, 0xac, 0x94, 0x79,
+  0x40, 0xa2, 0x64, 0x0a, 0x33, 0x7d, 0x5c, 0x6a, 0xe9, 0xd5, 0xb6, 0x2a, 0xb2, 0x06, 0x2f, 0xe8,
+  0xb1, 0x32, 0xdd, 0x6c, 0x4c, 0xfb, 0xad, 0xaf, 0x6b, 0x66, 0x34, 0xec, 0xe7, 0x41, 0xb2, 0xac,
+  0x9a, 0x98, 0x11, 0x82, 0x5a, 0xc2, 0xbf, 0xd5, 0x6a, 0x19, 0x1f, 0x5e, 0x2c, 0x63, 0x6c, 0x73,
+  0x83, 0x10, 0xef, 0xf9, 0x44, 0xa8, 0x9d, 0xa7, 0x29, 0xe4, 0x30, 0x15, 0xc9, 0x32, 0x75, 0xbe,
+  0x81, 0x7f, 0x38, 0xc2, 0xb8, 0x79, 0xf8, 0xf5, 0xa8, 0x4b, 0x7f, 0x69, 0x6d, 0x50, 0x11, 0xab,
+  0x7a, 0x50, 0x52, 0x03, 0xb7, 0xed, 0x17, 0xa7, 0x8d, 0x07, 0xbd, 0x74, 0x22, 0x25, 0xab, 0xe0,
+  0x8e, 0x18, 0x7e, 0x85, 0x22, 0x07, 0x73, 0x42, 0x7f, 0x0a, 0x7e, 0xaf, 0x2e, 0xc0, 0x77, 0x42,
+  0xbd, 0x80, 0xc9, 0xb9, 0xed, 0xb4, 0xaa, 0x30, 0x3e, 0x49, 0xf1, 0xa1, 0x62, 0x8b, 0x62, 0xc6,
+  0x1b, 0x4d, 0xa7, 0x55, 0x93, 0xfe, 0x67, 0xfb, 0xa4, 0xb0, 0x6a, 0xce, 0xcf, 0x10, 0x04, 0xf4,
+  0xb4, 0x16, 0x53, 0x8f, 0x7e, 0x6d, 0xe7, 0xcf, 0xc0, 0x5f, 0x62, 0x41, 0xc2, 0x9c, 0x8f, 0xe0,
+  0x80, 0x21, 0x5f, 0x73, 0x58, 0xb8, 0x5c, 0x4c, 0x88, 0x04, 0x0a, 0x3c, 0x95, 0xec, 0x38, 0xeb,
+  0x0f, 0xf6, 0x7b, 0x06, 0x47, 0xa4, 0xa2, 0x25, 0xf6, 0x31, 0x80, 0x80, 0x65, 0x7b, 0x90, 0xcb,
+  0xb5, 0x17, 0xbe, 0x9b, 0x40, 0xa6, 0xce, 0x40, 0xff, 0x81, 0xdb, 0x77, 0x51, 0xb0, 0x24, 0x2b,
+  0x68, 0xa0, 0x31, 0xdd, 0xcf, 0xa1, 0xd0, 0xc1, 0x65, 0x73, 0xeb, 0x00, 0xa7, 0x25, 0x9a, 0x55,
+  0x8b, 0x9d, 0xf4, 0x07, 0xe5, 0xa5, 0xa6, 0x54, 0x03, 0x69, 0x9f, 0x8e, 0x4b, 0x02, 0x1e, 0xac,
+  0x75, 0x59, 0xa3, 0xdf, 0x6b, 0x43, 0x9c, 0x6f, 0xa6, 0x7b, 0xfd, 0x71, 0x3f, 0x9b, 0x4c, 0x35,
+  0x10, 0xc6, 0xc9, 0x7c, 0x22, 0x42, 0x03, 0x2f, 0x9a, 0x79, 0x43, 0x0e, 0x8c, 0xdb, 0x89, 0x63,
+  0xa8, 0xa3, 0x02, 0xb0, 0xcd, 0x96, 0x76, 0x31, 0x68, 0x79, 0x68, 0xff, 0x7a, 0x9b, 0x49, 0x34,
+  0x83, 0xdc, 0x74, 0x01, 0x14, 0x80, 0x6f, 0xa9, 0x94, 0xee, 0x69, 0x3f, 0xa7, 0x38, 0x80, 0xfa,
+  0x0b, 0x7c, 0x1b, 0xe5, 0xbe, 0xac, 0xd1, 0x83, 0xf4, 0xdb, 0x49, 0x20, 0x33, 0x6b, 0xb1, 0xbe,
+  0x76, 0x6a, 0x03, 0xed, 0xd6, 0xf6, 0x32, 0x87, 0xf6, 0x02, 0xc5, 0x0a, 0x4f, 0xf6, 0xd1, 0xd5,
+  0xb5, 0xd8, 0x4b, 0xd0, 0xb1, 0x55, 0xe8, 0xb6, 0xd8, 0x57, 0x8c, 0x07, 0x81, 0x1f, 0x0b, 0x18,
+  0x7a, 0xa5, 0x92, 0xf6, 0x4a, 0x8e, 0x5d, 0xa4, 0x8b, 0x3b, 0xde, 0x9d, 0x03, 0xbe, 0x51, 0xa8,
+  0x18, 0x86, 0xb1, 0x13, 0x54, 0x3c, 0xd1, 0x2c, 0xcc, 0x58, 0xdf, 0x52, 0x09, 0x36, 0x19, 0x6d,
+  0x15, 0xba, 0x77, 0xd9, 0x5e, 0x20, 0x4c, 0xe0, 0x4e, 0x40, 0x54, 0x21, 0x25, 0xea, 0x29, 0x86,
+  0xaa, 0x59, 0xb5, 0x5a, 0x6e, 0x6a, 0x98, 0x42, 0x62, 0x15, 0x18, 0xa4, 0x35, 0x49, 0x19, 0xfc,
+  0xd9, 0x4c, 0x1e, 0x7c, 0xd3, 0x67, 0xa0, 0xad, 0xf9, 0x6a, 0xc0, 0x8c, 0x85, 0xd0, 0xc5, 0x49,
+  0x00, 0xbe, 0x48, 0x80, 0xf2, 0xf0, 0x7b, 0xfc, 0x04, 0x1b, 0xc2, 0xfa, 0x00, 0xcc, 0xbf, 0x49,
+  0x2e, 0x51, 0xc1, 0x20, 0x87, 0x53, 0xb9, 0x23, 0xbe, 0x8c, 0x0d, 0x01, 0xd6, 0xf9, 0x8e, 0xb8,
+  0x15, 0x04, 0x0c, 0x45, 0x9a, 0xe7, 0x4b, 0x91, 0xca, 0x3c, 0xc4, 0xa0, 0xa0, 0xcc, 0x7a, 0x81,
+  0xa9, 0xed, 0x64, 0x25, 0x29, 0x95, 0x70, 0x74, 0x84, 0x52, 0xd0, 0x69, 0xc0, 0x82, 0x6c, 0x02,
+  0x82, 0x0f, 0x14, 0x20, 0x80, 0x48, 0xad, 0x74, 0xf4, 0x2c, 0x90, 0x07, 0x1a, 0xca, 0x5c, 0x75,
+  0x01, 0xbe, 0x00, 0xe3, 0x47, 0x43, 0x70, 0xae, 0x41, 0xb1, 0x86, 0x11, 0x5d, 0xca, 0xe0, 0x7f,
+  0x57, 0xdb, 0xeb, 0xc4, 0x2b, 0x0d, 0x5f, 0x29, 0xc9, 0x73, 0x15, 0xc1, 0x35, 0x1f, 0x97, 0xda,
+  0xe6, 0xad, 0x96, 0x81, 0x02, 0x34, 0xe1, 0xb4, 0xf7, 0x09, 0xc1, 0x49, 0x1b, 0x8c, 0x51, 0xa2,
+  0x4f, 0xd9, 0x73, 0x6e, 0xf3, 0x86, 0x50, 0x2b, 0x8a, 0x50, 0xab, 0x91, 0xd7, 0x55, 0xe4, 0x7c,
+  0x0b, 0xc9, 0x51, 0xae, 0x5b, 0x5e, 0x41, 0x8f, 0xd2, 0x7c, 0x11, 0xbc, 0xc8, 0x9c, 0xc2, 0x73,
+  0x96, 0x07, 0xa6, 0xab, 0x7e, 0xeb, 0xaa, 0x0c, 0x49, 0x61, 0xc0, 0x9e, 0xbd, 0x4f, 0xed, 0x8e,
+  0x96, 0x16, 0x85, 0x86, 0xa2, 0x8c, 0xd1, 0xdc, 0x11, 0x62, 0xd3, 0x63, 0x58, 0x4d, 0x5a, 0x63,
+  0xc4, 0x0c, 0x82, 0xa0, 0x21, 0xcc, 0x3a, 0x4b, 0x2c, 0x29, 0xe0, 0x87, 0xdd, 0x96, 0x78, 0x4a,
+  0xdc, 0xa2, 0xac, 0xd2, 0x58, 0x4c, 0x50, 0x5e, 0x64, 0x2a, 0xbf, 0xaf, 0xc6, 0xed, 0x7c, 0xb3,
+  0x8a, 0x55, 0x97, 0x65, 0x45, 0x9e, 0xf8, 0xa1, 0x03, 0xd9, 0x47, 0x16, 0xd5, 0x15, 0x83, 0xc0,
+  0xed, 0xba, 0x81, 0x8f, 0xae, 0xcb, 0x91, 0xac, 0xdf, 0x63, 0xef, 0xfe, 0x02, 0xaf, 0x84, 0x4e,
+  0x29, 0x65, 0xda, 0x65, 0xcf, 0x22, 0x21, 0xd3, 0x93, 0x51, 0x57, 0x85, 0x37, 0x08, 0x86, 0x2a,
+  0xa1, 0x4e, 0x4f, 0xc4, 0xb0, 0xe1, 0x12, 0x8a, 0x7b, 0x8e, 0x3a, 0x42, 0xd9, 0x0a, 0x4a, 0x98,
+  0xac, 0x46, 0x21, 0xfc, 0x2f, 0x54, 0x58, 0xc1, 0xff, 0x44, 0x65, 0x65, 0xa4, 0xbc, 0x6a, 0x22,
+  0x7d, 0x8f, 0x6e, 0xd9, 0x15, 0xc5, 0xeb, 0xeb, 0x4c, 0x9d, 0x92, 0x5d, 0xe6, 0x81, 0x43, 0xa5,
+  0x67, 0xb0, 0x55, 0x11, 0x85, 0x86, 0x1d, 0xb4, 0xc0, 0xd9, 0x73, 0xac, 0x18, 0xf9, 0x9f, 0x40,
+  0xe1, 0x32, 0x94, 0x69, 0xdc, 0xd2, 0xed, 0x1e, 0x81, 0x5b, 0x27, 0x95, 0xf5, 0x85, 0xd9, 0x9e,
+  0xcb, 0xf2, 0x24, 0xe1, 0x26, 0x7e, 0x2c, 0x15, 0x7f, 0x61, 0x1c, 0xcc, 0x0f, 0x7b, 0x3c, 0x63,
+  0xe6, 0x45, 0xee, 0x12, 0x6b, 0xd2, 0xce, 0x8c, 0xcb, 0x63, 0x64, 0x69, 0x28, 0xdf, 0xac, 0xde,
+  0x7b, 0x8d, 0x3a, 0x0c, 0xd7, 0xb5, 0x47, 0x57, 0xf0, 0x7a, 0xad, 0xf7, 0x94, 0xc1, 0x6c, 0x99,
+  0xa8, 0xe1, 0xec, 0xc9, 0xe8, 0x18, 0xde, 0xa8, 0xcc, 0x64, 0xcb, 0x54, 0x84, 0xb2, 0xe7, 0x91,
+  0x95, 0x7f, 0xc0, 0x33, 0xb3, 0x2d, 0xd3, 0xf2, 0xf6, 0x4f, 0xc5, 0xe4, 0xef, 0xc0, 0x18, 0x1f,
+  0xa5, 0x39, 0x6f, 0x70, 0x54, 0x60, 0x38, 0x52, 0xed, 0x88, 0x1d, 0x91, 0xe8, 0xe6, 0x85, 0x8d,
+  0x07, 0xcc, 0xfc, 0x1b, 0x1c, 0x7d, 0x9c, 0x05, 0x59, 0x73, 0xc2, 0x46, 0xa0, 0xbc, 0xff, 0x91,
+  0xee, 0x1f, 0x1c, 0xe9, 0xbe, 0xc4, 0x36, 0x44, 0x85, 0x1e, 0x04, 0xa2, 0x33, 0xf0, 0x65, 0xe6,
+  0xa3, 0xe7, 0x6c, 0xc3, 0x94, 0xc1, 0x16, 0x70, 0xdc, 0x0b, 0x98, 0x05, 0xa1, 0x24, 0x6f, 0x55,
+  0x36, 0x6e, 0xee, 0xb1, 0xd7, 0xf5, 0xf4, 0x01, 0x0a, 0x52, 0x2f, 0xba, 0xef, 0x60, 0x33, 0x98,
+  0xd4, 0x70, 0x1e, 0x09, 0xd9, 0x11, 0x71, 0xe0, 0xcb, 0x46, 0x7d, 0x58, 0x6f, 0x5e, 0xf5, 0xae,
+  0xd7, 0xc3, 0x57, 0xfd, 0x1b, 0xbd, 0xc5, 0x7b, 0xd1, 0x51, 0x56, 0x7d, 0x09, 0x79, 0x31, 0xe0,
+  0xac, 0x43, 0xd1, 0xe0, 0xac, 0x26, 0xcb, 0xe9, 0x94, 0x27, 0x75, 0xbd, 0x24, 0xc0, 0x44, 0x21,
+  0xb5, 0x3e, 0xc7, 0xac, 0xd1, 0x64, 0xe3, 0xc3, 0xac, 0x71, 0x0e, 0x8a, 0x7a, 0xaa, 0x82, 0x44,
+  0xa3, 0x7e, 0xa4, 0x34, 0x3f, 0x6d, 0x88, 0x26, 0x60, 0xd1, 0xf5, 0x2c, 0x2d, 0x01, 0x14, 0xa8,
+  0x60, 0x8d, 0x3a, 0x78, 0x95, 0xdf, 0xc2, 0xf4, 0xf9, 0xda, 0x5c, 0x20, 0x8d, 0x36, 0xb0, 0x06,
+  0xc4, 0xb3, 0x50, 0x5a, 0x0b, 0x41, 0x7e, 0xaa, 0x9e, 0x76, 0xb0, 0x76, 0x80, 0x50, 0x06, 0xb1,
+  0x00, 0xf2, 0x02, 0x48, 0xf1, 0x5e, 0x23, 0xbd, 0x6f, 0x88, 0xde, 0x66, 0x06, 0xce, 0x30, 0x81,
+  0x03, 0x41, 0x5e, 0xa6, 0xec, 0x33, 0x26, 0x67, 0x34, 0xad, 0x21, 0x17, 0x11, 0xdc, 0x98, 0x63,
+  0xee, 0xe6, 0x5c, 0x75, 0x6b, 0xbd, 0x21, 0xab, 0xb3, 0xe7, 0xac, 0x6a, 0x76, 0x79, 0x07, 0x6e,
+  0x10, 0x09, 0xbe, 0x95, 0x47, 0x6f, 0x7d, 0xe1, 0x66, 0x6c, 0xa2, 0x7a, 0xce, 0x66, 0x54, 0x8a,
+  0x6e, 0xba, 0x0c, 0x55, 0x03, 0x63, 0x19, 0xc3, 0xa2, 0x5a, 0x75, 0x2f, 0x24, 0xf6, 0xe9, 0x1b,
+  0xf9, 0x2e, 0x73, 0xc3, 0xce, 0x4f, 0xec, 0xc6, 0x96, 0xaf, 0xe8, 0x90, 0x23, 0xec, 0xc8, 0xc4,
+  0x5f, 0x34, 0x9a, 0x1d, 0x55, 0xb8, 0xb0, 0x51, 0x7e, 0xc7, 0xc0, 0xb6, 0x0d, 0x13, 0x8b, 0x6d,
+  0xbf, 0x1b, 0xf0, 0x0c, 0xd8, 0xbf, 0xff, 0x5d, 0xb6, 0xd3, 0x4d, 0xc0, 0x07, 0x65, 0xb2, 0xa9,
+  0xb5, 0x81, 0x2e, 0xa6, 0x23, 0xa3, 0xd9, 0x2c, 0x00, 0x0e, 0xa5, 0x24, 0xd4, 0x5b, 0x55, 0xdb,
+  0x6b, 0x6e, 0x20, 0x7c, 0x2b, 0x9e, 0x0d, 0x9b, 0x4c, 0x59, 0x9e, 0x9a, 0x95, 0xc1, 0x35, 0x98,
+  0x71, 0x8c, 0x12, 0x47, 0x8c, 0xd8, 0x6a, 0x6e, 0xd4, 0xa9, 0x76, 0x04, 0x5c, 0x65, 0x79, 0x68,
+  0x34, 0x05, 0x7e, 0xfd, 0x5d, 0x0c, 0x16, 0x1f, 0x3f, 0x11, 0x09, 0x61, 0xc9, 0x3c, 0x49, 0x79,
+  0xf2, 0xdb, 0xef, 0x4f, 0x35, 0xfa, 0x0f, 0x90, 0x67, 0x10, 0x6b, 0x6c, 0x4d, 0xad, 0x52, 0x36,
+  0xcd, 0xa4, 0x66, 0x51, 0x31, 0xc9, 0x9a, 0x9b, 0xc6, 0x91, 0xb2, 0x11, 0xa6, 0xb6, 0x29, 0xe1,
+  0x81, 0x61, 0xd0, 0x1a, 0xa8, 0xb9, 0xc1, 0x04, 0x2f, 0xe8, 0x10, 0x17, 0xcd, 0x2f, 0x05, 0x3c,
+  0xc8, 0xe0, 0x52, 0x7f, 0x92, 0xae, 0xf8, 0x9c, 0xd5, 0x73, 0xb7, 0x52, 0x92, 0x27, 0x11, 0x80,
+  0xce, 0xad, 0x9e, 0x03, 0x6c, 0xde, 0x6c, 0x66, 0xdb, 0x3b, 0x69, 0x06, 0x94, 0xc8, 0xe0, 0x6e,
+  0x43, 0x64, 0xe6, 0x36, 0xb7, 0x85, 0xf5, 0xf6, 0x78, 0x0c, 0x24, 0x50, 0x91, 0x52, 0x6f, 0x6a,
+  0x06, 0x16, 0xd8, 0xdb, 0xed, 0xb2, 0xb4, 0xf1, 0x2c, 0x74, 0x15, 0x87, 0x85, 0x25, 0x78, 0x31,
+  0x47, 0xf0, 0x03, 0x23, 0xf1, 0x52, 0xf5, 0x08, 0xa5, 0xd2, 0x01, 0x00, 0x27, 0x02, 0x73, 0x94,
+  0xac, 0x66, 0x17, 0x98, 0xf2, 0x9c, 0x9e, 0x7d, 0x43, 0xa7, 0x3c, 0x33, 0xea, 0x0c, 0x2d, 0x8c,
+  0xe0, 0x91, 0x16, 0x8f, 0x47, 0xaa, 0xf2, 0xc6, 0x50, 0x72, 0x75, 0x55, 0xb7, 0x5a, 0xc6, 0xb0,
+  0x9d, 0xfa, 0x09, 0xfc, 0xd3, 0x1f, 0x5c, 0xb7, 0xd8, 0x55, 0xdd, 0x6e, 0xce, 0xe2, 0xe0, 0x8f,
+  0x38, 0xb8, 0x77, 0x7d, 0xdd, 0x59, 0x38, 0x71, 0xa3, 0x71, 0xe5, 0x63, 0x13, 0x2b, 0x6e, 0xb1,
+  0xa9, 0xcf, 0x03, 0xef, 0xda, 0xe2, 0x81, 0x4e, 0x42, 0x88, 0xcc, 0x2d, 0xa1, 0xce, 0xcf, 0xc5,
+  0xab, 0x73, 0x24, 0x6a, 0x4e, 0x6f, 0x9b, 0x80, 0x52, 0x57, 0x8d, 0xe2, 0x5c, 0xf2, 0x6a, 0x9d,
+  0x2d, 0xa6, 0xa3, 0x54, 0x9e, 0x90, 0x77, 0xb0, 0x0b, 0xa4, 0x4d, 0x02, 0x16, 0xd2, 0x53, 0x95,
+  0xb2, 0x00, 0xea, 0x2f, 0x76, 0xc0, 0xaa, 0x18, 0x9c, 0xa1, 0x4d, 0xd5, 0x32, 0x8a, 0x01, 0x41,
+  0x11, 0x1f, 0x2a, 0x68, 0x33, 0xbf, 0xd3, 0x82, 0xa5, 0x33, 0x7b, 0xd0, 0x50, 0x2d, 0x45, 0x91,
+  0x66, 0x20, 0xc6, 0x01, 0x4b, 0x2f, 0x0c, 0x57, 0x58, 0x41, 0x43, 0xe0, 0xbb, 0xb7, 0x25, 0x63,
+  0xde, 0xa4, 0x5f, 0xd8, 0xa1, 0xcd, 0x52, 0xd7, 0x59, 0x44, 0xca, 0x40, 0x7a, 0x93, 0x65, 0x12,
+  0x07, 0xaa, 0x28, 0x5a, 0x4a, 0x00, 0xe3, 0x98, 0x8b, 0x63, 0x49, 0x4f, 0x77, 0x1a, 0x54, 0xc8,
+  0xea, 0xaa, 0x2e, 0x53, 0xe7, 0x0f, 0x48, 0x93, 0x0d, 0xad, 0x82, 0x32, 0x62, 0xa7, 0x7c, 0x2f,
+  0xed, 0x1c, 0xdb, 0x49, 0x16, 0x3c, 0xbd, 0x20, 0xb4, 0x3b, 0x24, 0x45, 0x79, 0xc3, 0x36, 0xc5,
+  0x11, 0x70, 0x03, 0x03, 0x66, 0x46, 0x4b, 0xbc, 0x89, 0x68, 0x7b, 0x2c, 0x28, 0x9c, 0x17, 0x8e,
+  0x3c, 0x83, 0x02, 0x09, 0x7b, 0xb8, 0x8d, 0x85, 0x28, 0x7a, 0x2f, 0x01, 0x29, 0x03, 0x32, 0x65,
+  0xcc, 0x4e, 0x1d, 0x39, 0xef, 0xd0, 0xfd, 0x0d, 0x00, 0x63, 0x5d, 0xbc, 0x18, 0xd9, 0x2b, 0x4a,
+  0xee, 0xe6, 0xe9, 0x03, 0x81, 0x4d, 0x83, 0x28, 0x4a, 0x1a, 0xe9, 0xdc, 0x2e, 0x7b, 0xd9, 0x6b,
+  0xae, 0x87, 0x4f, 0x1f, 0x2e, 0xc0, 0xdd, 0x85, 0xb3, 0xec, 0xf9, 0x17, 0xf8, 0xbc, 0x13, 0x3b,
+  0xde, 0x05, 0xd6, 0xb0, 0x8d, 0x01, 0x58, 0x50, 0xaf, 0xde, 0x5c, 0xdf, 0x58, 0x31, 0x28, 0x77,
+  0xae, 0xf3, 0xe8, 0xfe, 0xdb, 0x74, 0x3b, 0x86, 0x97, 0x45, 0x77, 0xf2, 0x24, 0xdb, 0x67, 0x53,
+  0x93, 0x62, 0x9b, 0x4d, 0x4c, 0xed, 0x91, 0xb1, 0xe1, 0x2b, 0xbe, 0xce, 0x3f, 0x5f, 0xf5, 0x5f,
+  0x5c, 0xb3, 0x61, 0xce, 0xaa, 0x0e, 0x41, 0x97, 0x11, 0x9c, 0x6e, 0xc1, 0xb0, 0x5f, 0xc6, 0x70,
+  0x5a, 0x40, 0x91, 0xb6, 0x57, 0xc6, 0x06, 0x1c, 0x0a, 0x8c, 0x2b, 0x17, 0xa8, 0x87, 0xeb, 0x80,
+  0xf7, 0xa6, 0x65, 0xf4, 0x62, 0xd8, 0xd3, 0x87, 0x1c, 0x3e, 0x2f, 0xca, 0x9f, 0xb3, 0xfe, 0xfa,
+  0x06, 0xd6, 0xcc, 0xbd, 0x77, 0x51, 0x59, 0x0a, 0x86, 0x7c, 0x63, 0xe2, 0x41, 0x55, 0xc3, 0x34,
+  0xa5, 0x4e, 0x6d, 0x3b, 0x2c, 0xcc, 0xbd, 0x66, 0x7d, 0x3d, 0xac, 0x5e, 0x4b, 0xac, 0xf3, 0x66,
+  0x80, 0x78, 0xfa, 0xa0, 0x49, 0x5b, 0xb7, 0xd8, 0x0d, 0x7b, 0x9e, 0x45, 0x0e, 0x40, 0x4f, 0x6c,
+  0x5b, 0x2b, 0x5e, 0xb7, 0x54, 0xd1, 0xfd, 0xf4, 0xa1, 0xa0, 0x60, 0x8a, 0x31, 0x4d, 0x98, 0x0c,
+  0x6b, 0x26, 0x98, 0xd9, 0x96, 0x40, 0x72, 0x0a, 0x9c, 0xbb, 0xd9, 0x99, 0x86, 0x37, 0x97, 0x32,
+  0x20, 0xd2, 0xf4, 0x18, 0x78, 0xc6, 0xda, 0x16, 0xf5, 0x7a, 0x44, 0xf3, 0xc8, 0x4e, 0x6b, 0xc0,
+  0xe0, 0xcf, 0xf9, 0xc2, 0xf1, 0x89, 0xc3, 0xd4, 0x53, 0x07, 0x7b, 0x46, 0x46, 0xe8, 0x66, 0x50,
+  0x26, 0x57, 0x48, 0xb7, 0x22, 0xcb, 0xb2, 0x11, 0x30, 0xc6, 0xb6, 0xac, 0xba, 0x7c, 0xe0, 0x4b,
+  0xb3, 0x1c, 0xc5, 0x23, 0x82, 0x9d, 0xcd, 0xd5, 0x3c, 0x50, 0xa8, 0x97, 0x13, 0x09, 0xd0, 0xf5,
+  0xa3, 0x1c, 0x5f, 0x83, 0xa0, 0x0b, 0x2a, 0x4f, 0xcf, 0xd0, 0x91, 0xfa, 0x56, 0xb2, 0x50, 0x26,
+  0xa3, 0xa0, 0x08, 0xf5, 0x8a, 0xd3, 0x0b, 0x23, 0x05, 0xb0, 0xcd, 0x67, 0x6d, 0xa9, 0x30, 0xf1,
+  0x6a, 0x9c, 0xfb, 0x84, 0xc3, 0xec, 0xe3, 0x88, 0xf5, 0x40, 0x08, 0xf5, 0x76, 0x7b, 0xd8, 0x6e,
+  0xd7, 0x81, 0xe5, 0x05, 0x99, 0xa6, 0x60, 0x5f, 0xda, 0x5e, 0xe3, 0x51, 0x5a, 0x6f, 0xce, 0xf0,
+  0x00, 0xe9, 0xe9, 0x03, 0x2e, 0xac, 0x98, 0xd0, 0xc1, 0xc3, 0x9d, 0x0b, 0x85, 0x0e, 0xd5, 0x48,
+  0x46, 0xd2, 0x09, 0x6c, 0x08, 0x7a, 0x94, 0x81, 0x58, 0x9a, 0xa3, 0x00, 0x16, 0xce, 0xc7, 0xf3,
+  0x78, 0xc1, 0x0e, 0x89, 0x66, 0x30, 0x36, 0x3c, 0x1f, 0x7a, 0xfa, 0x60, 0x8e, 0xad, 0xf1, 0xbc,
+  0x48, 0xab, 0x8e, 0xa9, 0xe4, 0xac, 0x41, 0xc7, 0x4e, 0x52, 0xf9, 0xfc, 0x74, 0x0e, 0x92, 0xc4,
+  0xc5, 0x07, 0x1a, 0x59, 0x33, 0xf5, 0x6d, 0xa8, 0xb3, 0x91, 0x8f, 0x19, 0x62, 0xf8, 0x7a, 0xe2,
+  0xb8, 0x32, 0x4a, 0x80, 0xc0, 0x13, 0xff, 0x23, 0xf7, 0x1a, 0x03, 0xdc, 0x80, 0xbb, 0x94, 0x06,
+  0x14, 0x7c, 0x2b, 0x03, 0x35, 0x37, 0x78, 0xc4, 0x29, 0x97, 0xee, 0xbc, 0xe4, 0x0f, 0xe9, 0x69,
+  0xa3, 0x6e, 0xaa, 0x6d, 0xbd, 0x99, 0x6d, 0xa1, 0x83, 0xa7, 0xb1, 0x8d, 0xf4, 0xba, 0x0d, 0x8a,
+  0x30, 0xfd, 0x4c, 0x90, 0x8d, 0x66, 0x11, 0x94, 0x4a, 0x4b, 0x23, 0x84, 0x5a, 0xae, 0x06, 0x35,
+  0x1c, 0x8f, 0xad, 0xe0, 0xc1, 0x81, 0x31, 0x5e, 0x70, 0xd5, 0xc5, 0x21, 0x53, 0xb3, 0x69, 0xba,
+  0x52, 0xef, 0x1c, 0x6c, 0xdd, 0xac, 0xde, 0x30, 0x2c, 0x73, 0xa4, 0xa2, 0x74, 0x39, 0x4d, 0xde,
+  0x2d, 0x49, 0x7e, 0x24, 0x45, 0x06, 0x6b, 0x40, 0x7d, 0x85, 0x30, 0xdf, 0xd0, 0x89, 0x83, 0xcd,
+  0xe4, 0x03, 0x86, 0x4d, 0x1d, 0xd8, 0x1a, 0x7d, 0x06, 0xe9, 0xed, 0x65, 0xda, 0x5c, 0xa4, 0x35,
+  0x07, 0x2c, 0x49, 0x06, 0xb6, 0xd1, 0x55, 0xcd, 0xa1, 0x5d, 0xc4, 0x82, 0x16, 0xb1, 0x9b, 0x58,
+  0xb2, 0xa4, 0xe1, 0xb1, 0xfe, 0x54, 0x7a, 0xec, 0x5b, 0xb7, 0x44, 0xa3, 0x27, 0x76, 0x7c, 0xa8,
+  0xc5, 0x93, 0x77, 0x97, 0xa7, 0x1f, 0x0a, 0xc5, 0x01, 0x53, 0xb2, 0xd6, 0x5d, 0x13, 0x64, 0x5b,
+  0x67, 0xea, 0x07, 0x90, 0xb8, 0x37, 0x28, 0x9c, 0x00, 0x31, 0x4f, 0x9e, 0xe0, 0x27, 0x78, 0x1c,
+  0x25, 0xc7, 0x0e, 0x6c, 0x35, 0x7d, 0x6e, 0x12, 0x99, 0x85, 0xc3, 0xe8, 0xde, 0x24, 0xd1, 0x85,
+  0x7c, 0x4a, 0x72, 0x4d, 0x25, 0x56, 0xaa, 0x77, 0x36, 0x71, 0x0c, 0x27, 0xa8, 0x92, 0xf6, 0x3b,
+  0xc2, 0xca, 0xea, 0xd9, 0x45, 0xd3, 0x7a, 0x19, 0xd0, 0x76, 0x23, 0x48, 0x47, 0x05, 0x0c, 0xbe,
+  0x03, 0x83, 0x88, 0x3e, 0xe8, 0x0e, 0x73, 0x05, 0x9e, 0x5d, 0x13, 0x4b, 0x83, 0x87, 0x85, 0xfe,
+  0x40, 0xe5, 0xf2, 0xcc, 0x54, 0xe5, 0xba, 0xea, 0x7e, 0xa3, 0xba, 0x12, 0xfb, 0x6c, 0xd0, 0x75,
+  0xe1, 0x7b, 0x2a, 0x25, 0x28, 0x84, 0x40, 0x91, 0x8f, 0xe6, 0x7e, 0xe0, 0x35, 0x80, 0x52, 0x0b,
+  0x6a, 0xbd, 0xd9, 0x96, 0xb6, 0xea, 0x04, 0xec, 0x16, 0x84, 0xfa, 0xd8, 0x9e, 0x2d, 0xd2, 0x69,
+  0x8a, 0x5e, 0x62, 0x2b, 0x6e, 0x3a, 0x23, 0xf8, 0x54, 0xec, 0x7a, 0xd2, 0x2e, 0xf8, 0x31, 0x89,
+  0xf9, 0x54, 0xf4, 0x74, 0x22, 0x81, 0x7c, 0x2f, 0x8b, 0x4d, 0x57, 0xe6, 0x3b, 0x2d, 0x0d, 0x19,
+  0xd1, 0xa7, 0xae, 0x4c, 0x53, 0x76, 0xda, 0x96, 0x8c, 0xe2, 0x4f, 0xde, 0x16, 0xcd, 0x29, 0x25,
+  0x15, 0x76, 0xcb, 0xb6, 0xa1, 0xfb, 0xc2, 0xb9, 0x7b, 0xd2, 0x39, 0xbc, 0x7e, 0x6e, 0xd9, 0x39,
+  0xd6, 0xb3, 0x74, 0xd4, 0x80, 0x55, 0x22, 0xfc, 0x4d, 0x07, 0x0f, 0xa8, 0x75, 0x9a, 0xf2, 0x2a,
+  0x75, 0x07, 0x29, 0xe4, 0x93, 0x27, 0xf8, 0xa9, 0x09, 0xd1, 0xc1, 0x0f, 0x1b, 0x86, 0x9f, 0xd5,
+  0xaa, 0x58, 0x68, 0x41, 0xed, 0x6a, 0x6a, 0xca, 0x7d, 0x28, 0xd7, 0xb2, 0xad, 0x23, 0x97, 0x9a,
+  0x40, 0xa0, 0xee, 0x07, 0x6b, 0x57, 0xb0, 0xbd, 0x31, 0x67, 0x36, 0x62, 0xaa, 0x3b, 0xdc, 0x1d,
+  0x7d, 0xc7, 0xce, 0x4a, 0xb9, 0x32, 0xec, 0x1b, 0x58, 0x5c, 0xcc, 0xa6, 0x10, 0x3d, 0x6d, 0xe0,
+  0xd9, 0x33, 0x56, 0x12, 0x03, 0xe5, 0xa7, 0xa7, 0xcb, 0x40, 0xfa, 0x94, 0x42, 0xab, 0x9b, 0x96,
+  0x74, 0x53, 0x3a, 0x3d, 0xc8, 0x93, 0x11, 0x9b, 0x82, 0x23, 0x9c, 0x53, 0x7a, 0xaa, 0x8f, 0xad,
+  0x19, 0xdd, 0x85, 0xd7, 0x79, 0x6c, 0xe0, 0x2f, 0x7c, 0xa9, 0xee, 0xaf, 0x1a, 0x17, 0x09, 0xce,
+  0x5f, 0x9f, 0x7e, 0x66, 0xfb, 0x60, 0xcc, 0xd2, 0x74, 0xcb, 0xfc, 0x04, 0x3e, 0xbe, 0x05, 0xf7,
+  0x6e, 0x46, 0x6b, 0x1c, 0xd6, 0x7e, 0x46, 0x1f, 0x26, 0x80, 0x30, 0x10, 0xf8, 0x4d, 0x10, 0x4d,
+  0x1a, 0x57, 0x9a, 0xf2, 0xeb, 0x16, 0x44, 0x49, 0xbc, 0x40, 0x02, 0x11, 0x17, 0xdd, 0x6e, 0x37,
+  0x0e, 0x20, 0xb5, 0xae, 0x83, 0xe3, 0x69, 0x29, 0x29, 0x41, 0x8c, 0xed, 0x58, 0x27, 0x08, 0x66,
+  0x2c, 0xa4, 0x81, 0x2e, 0x7a, 0x91, 0x96, 0xe5, 0x4c, 0x21, 0xff, 0x9e, 0x47, 0xd8, 0x68, 0x3e,
+  0xfb, 0xfe, 0xe2, 0xb2, 0xde, 0x32, 0x46, 0xf0, 0x82, 0xb9, 0x4a, 0x30, 0x0d, 0x1f, 0xf7, 0x7f,
+  0x1b, 0x48, 0x8d, 0x5c, 0xc2, 0x6a, 0x6f, 0xd3, 0x18, 0xa8, 0x27, 0xa9, 0x6d, 0x21, 0xb1, 0xa9,
+  0xd2, 0xc4, 0x52, 0x00, 0xdd, 0xa0, 0x7d, 0x25, 0xb8, 0x6d, 0x7d, 0x38, 0xd3, 0xbd, 0xaf, 0x37,
+  0x34, 0x22, 0x4d, 0x22, 0x4b, 0xe9, 0x87, 0x62, 0xf9, 0x3f, 0x91, 0x80, 0x64, 0x87, 0x63, 0x5b,
+  0x72, 0x88, 0x1c, 0xa6, 0xdc, 0x9f, 0xa6, 0xd7, 0xbd, 0x40, 0x11, 0x9e, 0x94, 0xb8, 0x8e, 0x16,
+  0x43, 0x0f, 0x0b, 0x11, 0x17, 0x4c, 0x05, 0x33, 0x0d, 0x72, 0x4a, 0x43, 0xa5, 0x6e, 0xbf, 0x49,
+  0x65, 0x0b, 0xbf, 0x49, 0x7d, 0xbb, 0x00, 0x3e, 0xb8, 0x89, 0xbb, 0x37, 0xb0, 0x26, 0x96, 0x52,
+  0x19, 0x72, 0x71, 0xe4, 0xdf, 0xb2, 0xc7, 0xc0, 0x9f, 0xcc, 0xa7, 0x4d, 0x95, 0x43, 0x9b, 0x5a,
+  0xee, 0x4e, 0xa7, 0x39, 0x8d, 0x2b, 0xda, 0x54, 0x8b, 0xd6, 0x6d, 0xa9, 0x55, 0xaf, 0x2b, 0xd3,
+  0x83, 0xbf, 0x99, 0xfa, 0x7c, 0x42, 0xf2, 0xa3, 0x40, 0x71, 0x77, 0x90, 0xcb, 0x76, 0x4c, 0x2f,
+  0x59, 0x05, 0x67, 0x8a, 0xe9, 0xa6, 0x30, 0x9e, 0xde, 0x43, 0xd5, 0x37, 0x2d, 0xf3, 0x17, 0x73,
+  0x6a, 0xc4, 0xbc, 0xb6, 0x7a, 0x31, 0xf9, 0xe9, 0x03, 0x0d, 0xac, 0x6b, 0x87, 0xe9, 0x27, 0xf3,
+  0x32, 0xed, 0x23, 0xd8, 0x90, 0x5f, 0x38, 0xb1, 0xf1, 0x1d, 0x5d, 0x4e, 0x6a, 0xe0, 0xf7, 0x26,
+  0xb5, 0x96, 0x06, 0x2f, 0x9a, 0x59, 0x05, 0xd4, 0x6f, 0xae, 0xd9, 0x7f, 0xbf, 0x69, 0x41, 0xb9,
+  0x45, 0x9c, 0x5d, 0xa7, 0x17, 0x19, 0x76, 0x58, 0xc6, 0x7a, 0xe1, 0x6b, 0x03, 0xdd, 0xcf, 0x3e,
+  0xff, 0xd7, 0xcb, 0xfd, 0xfd, 0x83, 0x9d, 0xf0, 0x19, 0xef, 0xb9, 0x6d, 0xc2, 0x86, 0x85, 0xa8,
+  0xd8, 0x80, 0xed, 0xa6, 0x4a, 0x06, 0x5b, 0xe2, 0x5e, 0xb9, 0x77, 0x6e, 0xfa, 0x28, 0x47, 0x85,
+  0x4f, 0xdd, 0x4b, 0x57, 0x57, 0xf6, 0x2d, 0xc9, 0x97, 0xb4, 0x68, 0x5d, 0xa9, 0x57, 0x59, 0x1e,
+  0x7c, 0x84, 0xeb, 0x62, 0x74, 0xa1, 0x88, 0xf3, 0x4d, 0x9b, 0x7c, 0x76, 0x71, 0x46, 0x6e, 0xbf,
+  0xdb, 0x32, 0xd0, 0xf2, 0x5a, 0x99, 0xba, 0xff, 0xb9, 0xe4, 0xc9, 0xea, 0x82, 0xee, 0x4f, 0x45,
+  0xc9, 0xeb, 0x20, 0x68, 0xd4, 0xed, 0xf7, 0xf2, 0xea, 0xb9, 0x61, 0xd1, 0x8b, 0x81, 0x15, 0xbb,
+  0xc7, 0xe7, 0x39, 0xd9, 0x6f, 0x93, 0x15, 0x5d, 0x64, 0xa6, 0x9a, 0xdc, 0xba, 0x7d, 0x1a, 0x09,
+  0x1f, 0xdd, 0xe1, 0x50, 0x35, 0x1a, 0xa8, 0x7d, 0xd1, 0x62, 0x32, 0x81, 0xac, 0x4f, 0xbd, 0x73,
+  0x40, 0x71, 0x52, 0x94, 0xb6, 0x48, 0xe8, 0xff, 0xa6, 0x58, 0x94, 0x30, 0x30, 0x03, 0x3b, 0x4b,
+  0xa2, 0xd8, 0x99, 0x51, 0x97, 0xa5, 0x51, 0xe2, 0x3b, 0x94, 0x9a, 0x7a, 0xcf, 0x15, 0x32, 0x84,
+  0xff, 0x5f, 0x4b, 0x70, 0x32, 0x93, 0xa5, 0xc4, 0x43, 0xbb, 0x54, 0xcd, 0x8c, 0x46, 0xf9, 0x26,
+  0x26, 0x7f, 0x0a, 0xd3, 0x0d, 0x5d, 0xfe, 0x64, 0x96, 0x67, 0x9a, 0xa2, 0x90, 0x6c, 0xd2, 0x95,
+  0xff, 0x84, 0x91, 0x56, 0x9a, 0xb7, 0x1b, 0x7b, 0xca, 0x4c, 0x56, 0xe4, 0x29, 0x16, 0xef, 0x64,
+  0x11, 0xf6, 0xf7, 0xd2, 0x61, 0xf8, 0x96, 0x20, 0xf7, 0x5d, 0xa4, 0xb9, 0xa0, 0xef, 0x71, 0x59,
+  0xcc, 0x58, 0x1b, 0x9f, 0x29, 0x0c, 0x9f, 0x24, 0x9c, 0x5f, 0xe0, 0xeb, 0x3d, 0x8d, 0x1d, 0xda,
+  0x1e, 0xb9, 0xa9, 0xd3, 0x1e, 0x0a, 0x01, 0xfd, 0x46, 0x07, 0x74, 0x60, 0xcb, 0xd7, 0xe4, 0x8d,
+  0x9e, 0x3e, 0xf0, 0x10, 0x9f, 0xfc, 0x70, 0xfe, 0x1e, 0x32, 0x51, 0x88, 0xe1, 0x18, 0x56, 0x68,
+  0xe6, 0xfa, 0xe6, 0x9f, 0x08, 0xf8, 0x8f, 0x17, 0xbc, 0x9b, 0xd3, 0x1e, 0x44, 0xfa, 0xe9, 0x89,
+  0x4f, 0xe9, 0x68, 0xc0, 0xb2, 0x25, 0x9b, 0x49, 0xfa, 0x18, 0x23, 0x7b, 0xe5, 0x6a, 0xeb, 0x75,
+  0x9f, 0x0c, 0xca, 0x68, 0x09, 0x65, 0xcf, 0x3a, 0xea, 0x5d, 0x2d, 0x40, 0x30, 0x75, 0x40, 0x2d,
+  0x2a, 0x00, 0x0a, 0xcd, 0xcb, 0x0b, 0x3d, 0x12, 0xce, 0x20, 0x76, 0x21, 0x55, 0xeb, 0x4e, 0xa7,
+  0x93, 0xc5, 0x00, 0x5b, 0x7a, 0xe9, 0x16, 0xfe, 0xdf, 0x45, 0xb8, 0x99, 0x7c, 0x4d, 0xf3, 0x6f,
+  0xe1, 0xd3, 0x07, 0x9c, 0xb8, 0xbe, 0x79, 0x5c, 0x10, 0x25, 0x7b, 0xdb, 0x90, 0x7c, 0x2a, 0x38,
+  0x2b, 0xe5, 0xdf, 0x94, 0xf0, 0xe3, 0x6b, 0xa5, 0x3c, 0x11, 0x43, 0x28, 0x32, 0xea, 0x9a, 0xb8,
+  0x36, 0x5e, 0xcb, 0xa9, 0x03, 0x28, 0x1e, 0x06, 0xeb, 0x8b, 0xf0, 0xdd, 0x8f, 0xed, 0xfb, 0xfb,
+  0xfb, 0x36, 0x96, 0x05, 0xed, 0x65, 0x12, 0x28, 0xf6, 0x79, 0x50, 0x85, 0xe4, 0x98, 0x54, 0xe1,
+  0x80, 0xf5, 0xcb, 0x0f, 0xe7, 0x1f, 0x2e, 0xb8, 0x93, 0xb8, 0xf3, 0x33, 0x7c, 0x1b, 0x4d, 0x34,
+  0x1e, 0x94, 0x9f, 0xc9, 0xca, 0x88, 0xec, 0xc3, 0xce, 0x1c, 0xde, 0xc4, 0xdf, 0xcd, 0x95, 0x44,
+  0x55, 0x1d, 0xb1, 0x89, 0xad, 0x45, 0x97, 0xb1, 0xa1, 0xd7, 0xfb, 0xcf, 0xf4, 0x13, 0xa7, 0xe9,
+  0xba, 0x6f, 0xe8, 0x06, 0xed, 0x98, 0xe9, 0x64, 0xad, 0xa2, 0x19, 0x08, 0x75, 0x62, 0x9a, 0x42,
+  0xd3, 0x85, 0xe4, 0x9f, 0x7c, 0x09, 0xd4, 0x7d, 0xf0, 0x25, 0x84, 0x8d, 0x93, 0x8b, 0x4e, 0x86,
+  0x69, 0x8c, 0x89, 0xb5, 0x58, 0x4e, 0xa0, 0xa2, 0xad, 0x1e, 0xd6, 0x17, 0x64, 0x9a, 0xa5, 0x1a,
+  0xc0, 0x26, 0xa6, 0x59, 0xd9, 0x59, 0xcc, 0x60, 0x76, 0x38, 0x86, 0xc9, 0xdf, 0xb3, 0x2c, 0x86,
+  0x8f, 0x22, 0x96, 0xa2, 0x75, 0xa0, 0x38, 0xd4, 0xcb, 0xf4, 0x78, 0x6c, 0x66, 0x9c, 0x7a, 0x16,
+  0xf8, 0xa5, 0xb3, 0x59, 0x4c, 0x61, 0x6f, 0xaa, 0x43, 0xc2, 0xba, 0x74, 0x3a, 0xf5, 0xa6, 0x70,
+  0xa5, 0x74, 0x48, 0x6f, 0x26, 0x4c, 0xf1, 0xcd, 0x49, 0x41, 0x6f, 0xb0, 0xac, 0xb2, 0x57, 0x5e,
+  0x78, 0xe0, 0xb5, 0x98, 0xc7, 0x03, 0x90, 0x9e, 0x1e, 0x8f, 0xc2, 0x40, 0xbd, 0xb6, 0xaa, 0x8e,
+  0xe1, 0x85, 0x71, 0x44, 0x75, 0x79, 0xfc, 0xe1, 0xf8, 0xf4, 0xf8, 0xf2, 0xfc, 0x97, 0xdf, 0x4f,
+  0xde, 0x1f, 0x7f, 0x78, 0x7b, 0x81, 0x77, 0x1c, 0xea, 0x3f, 0xe3, 0xcd, 0x85, 0x5f, 0xf1, 0x9f,
+  0x4b, 0x8a, 0xaf, 0xec, 0x67, 0xe3, 0x33, 0x3d, 0xbf, 0x50, 0xaf, 0xc4, 0xe0, 0xc7, 0xf3, 0xb3,
+  0xd3, 0xcc, 0x36, 0xeb, 0x27, 0xd9, 0xab, 0x5e, 0x3c, 0x49, 0xa2, 0x44, 0x4d, 0x2c, 0x3e, 0x24,
+  0x0c, 0xa7, 0xaa, 0x77, 0x50, 0x27, 0x97, 0x8e, 0x1f, 0xf0, 0x5c, 0x27, 0xfd, 0xcb, 0x85, 0x81,
+  0xd2, 0x7a, 0x01, 0xe0, 0x0b, 0x5a, 0xd2, 0xbe, 0xdb, 0x4f, 0xcf, 0xf0, 0xbc, 0x9e, 0xce, 0x19,
+  0xcd, 0x2f, 0x6c, 0x21, 0xea, 0xd7, 0xf9, 0xd1, 0x77, 0x7e, 0x52, 0x9b, 0x1e, 0x7d, 0x97, 0x46,
+  0x2e, 0xf8, 0x9f, 0x30, 0xd8, 0x2b, 0x37, 0xca, 0x1c, 0xef, 0x47, 0x27, 0xf1, 0xc1, 0xe7, 0xe2,
+  0xef, 0x2e, 0xb5, 0x30, 0x91, 0x34, 0x0e, 0x1a, 0x00, 0x43, 0x1a, 0xbe, 0x7a, 0x50, 0xf3, 0xe1,
+  0x4f, 0x2d, 0xc1, 0xc7, 0x7e, 0x8b, 0x65, 0x67, 0x20, 0x5e, 0x64, 0x28, 0xe6, 0x04, 0x06, 0x11,
+  0x0d, 0xea, 0xde, 0x0f, 0x80, 0xf3, 0x55, 0x03, 0xd0, 0x75, 0xfc, 0xe7, 0xcf, 0x0d, 0x85, 0xd3,
+  0xd7, 0x21, 0xc6, 0xac, 0x31, 0x61, 0xcf, 0x58, 0xef, 0xe3, 0x57, 0xd3, 0x26, 0xfb, 0x52, 0xa1,
+  0xce, 0x81, 0xd4, 0x4a, 0x5f, 0xc2, 0x52, 0x83, 0x57, 0xf9, 0x75, 0x3d, 0xf5, 0xce, 0x85, 0x9e,
+  0xf7, 0xaa, 0x74, 0x22, 0x4f, 0x98, 0xab, 0xbd, 0x4a, 0xf1, 0x36, 0xe0, 0xa4, 0x70, 0x5f, 0x50,
+  0xe9, 0x0c, 0x92, 0xae, 0x7b, 0x44, 0xd8, 0x1f, 0xfa, 0x11, 0xbe, 0xa6, 0x90, 0xf6, 0xf9, 0xb6,
+  0x54, 0x77, 0x25, 0xed, 0xad, 0xf6, 0x0a, 0x40, 0xd3, 0xc0, 0x99, 0x89, 0x12, 0x54, 0xbf, 0x00,
+  0x25, 0x48, 0x2e, 0x26, 0xcc, 0xde, 0x00, 0xaf, 0x07, 0xc8, 0x64, 0xc9, 0x0b, 0xa0, 0xc0, 0x4b,
+  0x00, 0x7d, 0x60, 0xfe, 0x90, 0xbd, 0x4c, 0x6f, 0x88, 0x28, 0x57, 0xa1, 0xe8, 0x19, 0x03, 0xbb,
+  0x4c, 0x37, 0x41, 0xbc, 0x47, 0x4e, 0xbf, 0x38, 0x28, 0x34, 0xc3, 0xe8, 0x16, 0xf3, 0x0e, 0xb2,
+  0x32, 0xf5, 0xea, 0xea, 0xda, 0xea, 0x96, 0xe1, 0xf1, 0x20, 0xec, 0x91, 0x74, 0x0a, 0xfe, 0x8c,
+  0x14, 0x4e, 0xf8, 0xf8, 0xfc, 0x79, 0xcb, 0x58, 0xb9, 0x99, 0xe3, 0xe8, 0xc4, 0x4b, 0x31, 0x6f,
+  0xa4, 0x4b, 0xbe, 0xa7, 0x8d, 0x12, 0xa0, 0xde, 0x6c, 0xf1, 0x5e, 0xa6, 0xb5, 0xb1, 0x01, 0xf6,
+  0x0f, 0x73, 0x72, 0xe0, 0x0b, 0x31, 0x6e, 0x3c, 0xb6, 0x35, 0xfc, 0xb9, 0xcd, 0x81, 0x4a, 0xed,
+  0x2e, 0x32, 0x63, 0xe1, 0x88, 0xdb, 0x02, 0x2f, 0xfa, 0x2f, 0x2d, 0xca, 0x0e, 0xca, 0x2c, 0x1d,
+  0x6c, 0x67, 0x46, 0xd1, 0xfb, 0x68, 0x27, 0x4f, 0xec, 0xb1, 0x3d, 0x39, 0xee, 0x92, 0x28, 0x78,
+  0xc6, 0x1a, 0x7d, 0x36, 0x1a, 0xb1, 0x69, 0xb3, 0xda, 0xd5, 0xff, 0x45, 0x3d, 0xd7, 0xad, 0xfb,
+  0xb1, 0x44, 0x76, 0x35, 0xbd, 0x26, 0x2b, 0xfb, 0x8b, 0x7d, 0xc1, 0x06, 0x4d, 0xf6, 0x35, 0x6b,
+  0xc3, 0x47, 0xe2, 0x4f, 0x17, 0xb8, 0x39, 0x04, 0x7c, 0x5d, 0x73, 0x17, 0x96, 0x97, 0xde, 0x74,
+  0x41, 0xb6, 0xfa, 0xc0, 0xbc, 0xe0, 0x63, 0x40, 0x30, 0x05, 0x15, 0x57, 0x37, 0x3f, 0xd8, 0x95,
+  0xb2, 0x88, 0x67, 0xac, 0x8f, 0xe7, 0xe7, 0xc7, 0xed, 0x8b, 0xcb, 0xef, 0xcf, 0xf0, 0x00, 0xbd,
+  0x7e, 0x7e, 0xfc, 0xfa, 0xed, 0x2f, 0xe0, 0xde, 0xd2, 0xf1, 0x01, 0x8e, 0xff, 0xcc, 0xd4, 0xcf,
+  0x4b, 0x10, 0x84, 0x31, 0xf8, 0x02, 0x07, 0x7f, 0xb5, 0x07, 0x73, 0x59, 0x68, 0xa0, 0x3d, 0x42,
+  0x91, 0xbd, 0xfa, 0xa4, 0xc0, 0xae, 0xd3, 0x06, 0x97, 0x50, 0x0d, 0x2e, 0x91, 0xb6, 0xeb, 0xc1,
+  0xb1, 0x36, 0xcd, 0x5f, 0x34, 0x33, 0xef, 0xc6, 0xa5, 0x73, 0x5c, 0x9c, 0x93, 0x5f, 0xae, 0x04,
+  0xb7, 0x72, 0x97, 0x05, 0xdd, 0x27, 0xa0, 0x86, 0x6e, 0x47, 0xdf, 0x70, 0x33, 0xf5, 0xf4, 0xca,
+  0xed, 0xa8, 0x0b, 0x71, 0x04, 0xb2, 0x0c, 0x3d, 0x0e, 0x89, 0x03, 0xf7, 0xf2, 0x12, 0xd4, 0xb5,
+  0xf3, 0x90, 0x14, 0x49, 0x56, 0x33, 0x94, 0x31, 0x19, 0xda, 0xdb, 0xa9, 0xba, 0xc4, 0x56, 0xb1,
+  0x36, 0x5d, 0x65, 0x2b, 0xe6, 0x5d, 0xac, 0x74, 0x0d, 0xbd, 0x80, 0xa8, 0xa4, 0xc2, 0x74, 0xd1,
+  0x4f, 0xfd, 0xba, 0xd4, 0x94, 0x0a, 0xd9, 0x34, 0x6b, 0xc6, 0xa4, 0xc0, 0x54, 0x3b, 0xc8, 0xdb,
+  0x8d, 0x73, 0x10, 0x7d, 0xee, 0x8c, 0xf7, 0xe1, 0x50, 0x0f, 0xb2, 0x52, 0xa2, 0xea, 0xdc, 0xbc,
+  0x5c, 0x0d, 0x66, 0x29, 0xa5, 0xbe, 0xe4, 0x52, 0x74, 0xd9, 0xf1, 0x96, 0xee, 0x62, 0x9c, 0x4b,
+  0x35, 0x2e, 0x6c, 0x4e, 0x63, 0x3b, 0xc8, 0x0f, 0xd4, 0xad, 0x16, 0x4f, 0xdc, 0x34, 0x47, 0xd4,
+  0x0f, 0xdb, 0x5d, 0x46, 0xb8, 0x56, 0xfe, 0xfd, 0x1d, 0xfd, 0x52, 0x95, 0x45, 0x77, 0x39, 0xcf,
+  0x35, 0x8e, 0xd0, 0x3f, 0xcb, 0x92, 0x58, 0x7b, 0xcf, 0x82, 0x7c, 0x21, 0x4f, 0x40, 0xe4, 0x0d,
+  0x63, 0xb8, 0x95, 0x5f, 0x1f, 0x19, 0x75, 0xd3, 0x17, 0x48, 0x46, 0x5d, 0xf5, 0x93, 0x33, 0xa3,
+  0xae, 0xfa, 0xa5, 0xc5, 0xff, 0x05, 0x13, 0xac, 0x66, 0xa0, 0x7b, 0x51, 0x00, 0x00,
+};
+
+#endif // INDEXHTML_GZ_H
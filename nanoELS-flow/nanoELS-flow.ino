@@ -47,10 +47,14 @@
 #include "SetupConstants.h"      // Hardware configuration constants
 #include "MinimalMotionControl.h" // h5.ino-inspired minimal motion controller
 #include "OperationManager.h"     // Touch-off based operation management
+#include "FeedOverride.h"         // Live feed/rapid override
+#include "JobQueue.h"             // Batch production jobs
 #include "WebInterface.h"
+#include "WebBridge.h"          // Snapshot/command exchange with the web task
 #include "NextionDisplay.h"
 // MyHardware.h merged into SetupConstants.h
 #include "StateMachine.h"
+#include "InputEvents.h"         // Unified key event queue
 
 // Global Objects
 // ==============
@@ -118,24 +122,30 @@ const char* AP_PASSWORD = "nanoels123";
 // Home WiFi credentials are defined in setup section above
 
 // WiFi troubleshooting options
-#define WIFI_CONNECTION_TIMEOUT 20  // seconds to wait for connection
-#define WIFI_RETRY_COUNT 2          // number of connection attempts
-#define FALLBACK_TO_AP true         // create AP if WiFi connection fails
+#define WIFI_CONNECTION_TIMEOUT 20  // seconds to wait for each connection attempt
+#define WIFI_RETRY_COUNT 2          // failed attempts before the AP fallback starts
+#define FALLBACK_TO_AP true         // create AP if WiFi connection fails (station keeps retrying)
 
 // Function Prototypes
 // ==================
 void initializeWebInterface();  // Web interface initialization
-void processKeypadEvent();  // Enhanced PS2 keyboard processing
+void processKeypadEvent();  // PS2 keyboard scan (input event producer)
+void processInputEvents();  // Input event queue consumer
+void handleKeyEvent(int keyCode, bool isPress);  // Key dispatch for all input sources
 
 // Manual movement functions
 void performManualMovement(int keyCode);      // Simple manual movement
 void resetArrowKeyStates();                   // Reset all key states (for emergency stop)
+void showFeedOverride();                      // Override percentages on t3
+bool isModeKey(int keyCode);                  // F1..F9
+void formatCycleTime(float seconds, char* text, size_t len);  // "m:ss", "--:--" if unknown
 
 // Task functions for scheduler
 void taskEmergencyCheck();
 void taskMotionUpdate();
 void taskOperationUpdate();
 void taskDisplayUpdate();
+void taskNextionReceive();
 void taskWebUpdate();
 void taskDiagnostics();
 
@@ -155,10 +165,6 @@ void setup() {
   nextionDisplay.initialize();
   Serial.println("Display initialized, splash screen should be visible");
   
-  // Initialize WiFi and web interface
-  Serial.println("Initializing WiFi and web interface...");
-  initializeWebInterface();
-  
   // Initialize minimal motion control after display splash
   Serial.println("Initializing minimal motion control...");
   if (motionControl.initialize()) {
@@ -178,6 +184,10 @@ void setup() {
   motionControl.setMPGStepSize(AXIS_Z, (int32_t)10000); // 1mm default step size
   Serial.println("✓ MPGs enabled for both axes (1mm step size)");
   
+  // WiFi comes up in the background - motion does not wait for it
+  Serial.println("Initializing WiFi and web interface...");
+  initializeWebInterface();
+  
   Serial.println("Setup complete - SAFETY READY");
   Serial.println("======================================");
   Serial.println("HARDWARE CONFIGURATION:");
@@ -210,10 +220,12 @@ void setup() {
   // Add tasks in priority order
   scheduler.addTask("EmergencyCheck", taskEmergencyCheck, PRIORITY_CRITICAL, 0);  // Every loop
   scheduler.addTask("KeyboardScan", processKeypadEvent, PRIORITY_CRITICAL, 0);      // Every loop
+  scheduler.addTask("InputDispatch", processInputEvents, PRIORITY_CRITICAL, 0);     // Every loop
   scheduler.addTask("MotionUpdate", taskMotionUpdate, PRIORITY_CRITICAL, 0);      // Every loop (~100kHz)
   scheduler.addTask("OperationUpdate", taskOperationUpdate, PRIORITY_CRITICAL, 0); // Every loop for operations
+  scheduler.addTask("NextionRx", taskNextionReceive, PRIORITY_HIGH, 5);          // 200Hz - touch and acks
   scheduler.addTask("DisplayUpdate", taskDisplayUpdate, PRIORITY_NORMAL, 50);     // 20Hz
-  scheduler.addTask("WebUpdate", taskWebUpdate, PRIORITY_NORMAL, 20);             // 50Hz
+  scheduler.addTask("WebUpdate", taskWebUpdate, PRIORITY_NORMAL, 10);             // 100Hz (max telemetry rate)
   scheduler.addTask("Diagnostics", taskDiagnostics, PRIORITY_LOW, 5000);          // 0.2Hz
   
   // Initialize arrow key states
@@ -232,6 +244,11 @@ void setup() {
   Serial.println("✓ Non-blocking operation enabled");
   Serial.println("✓ Emergency stop response: <15ms");
   Serial.println("======================================");
+  
+  // Ready to cut from here on
+  uint32_t bootReadyMs = millis();
+  webInterface.recordBootReady(bootReadyMs);
+  Serial.printf("✓ Boot to ready: %u ms\n", (unsigned)bootReadyMs);
 }
 
 void loop() {
@@ -250,57 +267,34 @@ void loop() {
 // Motion control test function removed - clean minimal version
 
 void initializeWebInterface() {
-  bool wifiSuccess = false;
-  
+  // Non-blocking: the link is brought up (and kept up) by the web task
+  WiFiLinkConfig config;
 #if WIFI_MODE == 1
-  // Try to connect to existing WiFi network
-  Serial.println("Attempting to connect to home WiFi...");
-  
-  for (int retry = 0; retry < WIFI_RETRY_COUNT && !wifiSuccess; retry++) {
-    if (retry > 0) {
-      Serial.printf("WiFi connection retry %d/%d\n", retry + 1, WIFI_RETRY_COUNT);
-    }
-    
-    wifiSuccess = webInterface.initializeWiFi(HOME_WIFI_SSID, HOME_WIFI_PASSWORD);
-    
-    if (!wifiSuccess) {
-      Serial.println("WiFi connection failed, waiting before retry...");
-      delay(2000);
-    }
-  }
-  
-#if FALLBACK_TO_AP == true
-  // If WiFi connection failed, fall back to Access Point mode
-  if (!wifiSuccess) {
-    Serial.println("WiFi connection failed after all retries.");
-    Serial.println("Falling back to Access Point mode...");
-    wifiSuccess = webInterface.startAccessPoint(AP_SSID, AP_PASSWORD);
-  }
-#endif
-
+  config.stationMode = true;
 #else
-  // Access Point mode
-  Serial.println("Starting in Access Point mode...");
-  wifiSuccess = webInterface.startAccessPoint(AP_SSID, AP_PASSWORD);
+  config.stationMode = false;
 #endif
+  config.ssid = HOME_WIFI_SSID;
+  config.password = HOME_WIFI_PASSWORD;
+  config.apSsid = AP_SSID;
+  config.apPassword = AP_PASSWORD;
+  config.fallbackToAp = FALLBACK_TO_AP;
+  config.attemptsBeforeFallback = WIFI_RETRY_COUNT;
+  config.connectTimeoutMs = WIFI_CONNECTION_TIMEOUT * 1000UL;
+  webInterface.beginWiFi(config);
 
-  if (wifiSuccess) {
-    if (webInterface.startWebServer()) {
-      Serial.println("✓ Web interface ready!");
-      Serial.println("Access the web interface at:");
-      Serial.println("http://" + webInterface.getIPAddress());
-      Serial.println("WebSocket port: 81");
-      
+  if (webInterface.startWebServer()) {
+    Serial.println("✓ Web interface ready, WiFi connecting in the background");
+    Serial.println("WebSocket port: 81");
+    
 #if WIFI_MODE == 0
-      Serial.println("Connect to WiFi network: " + String(AP_SSID));
-      Serial.println("WiFi password: " + String(AP_PASSWORD));
+    Serial.println("Connect to WiFi network: " + String(AP_SSID));
+    Serial.println("WiFi password: " + String(AP_PASSWORD));
+    Serial.println("Access the web interface at: http://" + webInterface.getIPAddress());
 #endif
-      
-    } else {
-      Serial.println("✗ Failed to start web server");
-    }
+    
   } else {
-    Serial.println("✗ Failed to initialize WiFi");
+    Serial.println("✗ Failed to start web server");
     Serial.println("Web interface not available");
   }
 }
@@ -308,7 +302,7 @@ void initializeWebInterface() {
 // Keyboard and display initialization removed - handled in setup()
 
 void processKeypadEvent() {
-  // Enhanced keyboard processing based on original h5.ino approach
+  // PS2 keyboard producer - timestamps key events into the unified queue
   if (!keyboard.available()) {
     return;
   }
@@ -317,16 +311,27 @@ void processKeypadEvent() {
   int keyCode = event & 0xFF;
   bool isPress = !(event & PS2_BREAK);
   
-  // Track timing for debugging and safety
-  static unsigned long keypadTimeUs = 0;
-  keypadTimeUs = micros();
-  
   // Some keyboards send this code and expect an answer to initialize
   if (keyCode == 170) {
     keyboard.echo();
     return;
   }
   
+  inputEvents.post(INPUT_SOURCE_KEYBOARD, keyCode, isPress);
+}
+
+void processInputEvents() {
+  // Single consumer for keyboard, web and Nextion key events
+  // Emergency stop events are returned first, everything else in arrival order
+  InputEvent event;
+  while (inputEvents.next(event)) {
+    handleKeyEvent(event.keyCode, event.isPress);
+    inputEvents.markHandled(event);
+  }
+}
+
+void handleKeyEvent(int keyCode, bool isPress) {
+  // Key handling based on original h5.ino approach
   // Emergency stop (B_OFF) gets highest priority - handle immediately on press
   if (keyCode == B_OFF) {
     if (isPress) {
@@ -338,8 +343,11 @@ void processKeypadEvent() {
         // Re-enable manual movement when clearing emergency stop
         operationManager.setArrowKeyMode(ARROW_MOTION_MODE);
       } else {
-        // Check if we're in setup mode - ESC goes back to setupIndex 0 
-        if (operationManager.getMode() != MODE_NORMAL && !operationManager.isRunning() && operationManager.getSetupIndex() > 0) {
+        // Between parts ESC leaves the job; the setup stays as the last operation left it
+        if (jobQueue.isArmed() && !operationManager.isRunning()) {
+          jobQueue.stop();
+          nextionDisplay.showMessage("Job stopped");
+        } else if (operationManager.getMode() != MODE_NORMAL && !operationManager.isRunning() && operationManager.getSetupIndex() > 0) {
           // Return to setupIndex 0 (direction selection) and reset state
           operationManager.resetSetupIndex();
           operationManager.clearCurrentInput();  // Reset state and numpad
@@ -396,11 +404,25 @@ void processKeypadEvent() {
     return;
   }
   
+  // Choosing a mode by hand leaves the job (stops a part in progress)
+  if (isModeKey(keyCode) && jobQueue.isArmed()) {
+    jobQueue.stop();
+  }
+  
   // Process key according to MyHardware.txt mappings
   switch (keyCode) {
     case B_ON:     // ENTER - Start operation or advance setup (h5.ino style)
       if (!motionControl.getEmergencyStop()) {
-        if (operationManager.isInNumpadInput()) {
+        if (jobQueue.isArmed() && !operationManager.isRunning()) {
+          // Batch production: one key press runs every operation of the next part
+          if (jobQueue.runPart()) {
+            nextionDisplay.showMessage("Part started");
+          } else {
+            nextionDisplay.showMessage("Cannot start part - check job");
+          }
+        } else if (jobQueue.isRunning()) {
+          // Operations follow on by themselves; ENTER must not restart one
+        } else if (operationManager.isInNumpadInput()) {
           // Handle numpad input confirmation (touch-offs and parameters)
           OperationState state = operationManager.getState();
           if (state == STATE_TOUCHOFF_X || state == STATE_TOUCHOFF_Z) {
@@ -513,6 +535,8 @@ void processKeypadEvent() {
                                operationManager.getMode() == MODE_FACE || 
                                operationManager.getMode() == MODE_THREAD)) {
               operationManager.advancePass();
+            } else if (isOn && operationManager.getMode() == MODE_GCODE) {
+              operationManager.resumeOperation();  // After M0/M1
             }
           }
           
@@ -625,15 +649,15 @@ void processKeypadEvent() {
       
       if (showDiagnostics) {
         // Show status on display
-        String statusText = "X:" + String(motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X)), 2) + 
-                           " Z:" + String(motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)), 2);
-        Serial1.print("t3.txt=\"" + statusText + "\"");
-        Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+        char statusText[NEXTION_FIELD_LEN];
+        snprintf(statusText, sizeof(statusText), "X:%.2f Z:%.2f",
+                 motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X)),
+                 motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)));
+        nextionDisplay.setStatusLine(statusText);
         nextionDisplay.showMessage("Diagnostics ON");
       } else {
         // Clear display
-        Serial1.print("t3.txt=\"\"");
-        Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+        nextionDisplay.setStatusLine("");
         nextionDisplay.showMessage("Diagnostics OFF");
       }
       break;
@@ -641,8 +665,12 @@ void processKeypadEvent() {
     
     // Plus/Minus keys - Context-aware functionality
     case B_PLUS:   // Numpad plus - increment pitch or parameters
-      // Pitch adjustment always works (user requirement)
-      if (!operationManager.isInNumpadInput()) {
+      if (operationManager.isRunning()) {
+        // Feed override while cutting - the pitch must not jump under a cut
+        feedOverride.adjustFeed(OVERRIDE_KEY_STEP_PERCENT);
+        showFeedOverride();
+      } else if (!operationManager.isInNumpadInput()) {
+        // Pitch adjustment always works outside a running operation (user requirement)
         // Increment pitch by small amount (like h5.ino)
         long currentDupr = motionControl.getDupr();  // Get current pitch
         long delta = (operationManager.getCurrentMeasure() == MEASURE_METRIC) ? 100 : 254; // 0.01mm or 0.001"
@@ -681,8 +709,12 @@ void processKeypadEvent() {
       break;
       
     case B_MINUS:  // Numpad minus - decrement pitch or parameters  
-      // Pitch adjustment always works (user requirement)
-      if (!operationManager.isInNumpadInput()) {
+      if (operationManager.isRunning()) {
+        // Feed override while cutting - the pitch must not jump under a cut
+        feedOverride.adjustFeed(-OVERRIDE_KEY_STEP_PERCENT);
+        showFeedOverride();
+      } else if (!operationManager.isInNumpadInput()) {
+        // Pitch adjustment always works outside a running operation (user requirement)
         // Decrement pitch by small amount (like h5.ino)
         long currentDupr = motionControl.getDupr();  // Get current pitch
         long delta = (operationManager.getCurrentMeasure() == MEASURE_METRIC) ? 100 : 254; // 0.01mm or 0.001"
@@ -878,8 +910,14 @@ void taskEmergencyCheck() {
   // Ultra-fast emergency stop check - runs every loop
   static uint32_t lastEmergencyTime = 0;
   
+  // Web E-stop and release arrive here directly, never behind queued commands
+  WebEmergencyRequest webRequest = webBridge.takeEmergencyRequest();
+  if (webRequest == WEB_ESTOP_RELEASE) {
+    motionControl.setEmergencyStop(false);
+  }
+  
   // Check if emergency key was detected
-  if (emergencyKeyDetected) {
+  if (emergencyKeyDetected || webRequest == WEB_ESTOP_STOP) {
     motionControl.setEmergencyStop(true);
     resetArrowKeyStates();  // Stop any movement
     nextionDisplay.showEmergencyStop();
@@ -900,8 +938,25 @@ void taskMotionUpdate() {
 }
 
 void taskOperationUpdate() {
+  // While an operation runs the MPGs set the overrides (Z feed, X rapid)
+  // instead of moving axes the operation owns
+  motionControl.setMPGOverride(operationManager.isRunning());
+  int32_t feedPulses = motionControl.takeMPGOverridePulses(AXIS_Z);
+  int32_t rapidPulses = motionControl.takeMPGOverridePulses(AXIS_X);
+  if (feedPulses != 0 || rapidPulses != 0) {
+    feedOverride.addMPGPulses(AXIS_Z, feedPulses);
+    feedOverride.addMPGPulses(AXIS_X, rapidPulses);
+    showFeedOverride();
+  }
+  
+  // Override ramps before the operation plans this tick's motion
+  feedOverride.update();
+  
   // Operation manager update - runs every loop for operations
   operationManager.update();
+  
+  // Next operation of a job part once the previous one completed
+  jobQueue.update();
 }
 
 void taskDisplayUpdate() {
@@ -916,29 +971,60 @@ void taskDisplayUpdate() {
   //   updateDiagnosticsDisplay();  // DISABLED - was interfering with t3 operation display
   // }
   
-  // Update operation status display
+  // Update operation status display (goes through the shared display frame,
+  // so unchanged text costs no UART bytes)
   if (splashHandled && operationManager.getMode() != MODE_NORMAL) {
     // Show operation status on line 0
-    String status = operationManager.getStatusText();
-    Serial1.print("t0.txt=\"" + status + "\"");
-    Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+    nextionDisplay.setTopLine(operationManager.getStatusText());
     
     // Show operation prompt or progress on line 3
     if (operationManager.getState() != STATE_RUNNING) {
-      String prompt = operationManager.getPromptText();
-      Serial1.print("t3.txt=\"" + prompt + "\"");
-      Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+      if (jobQueue.isArmed()) {
+        // Between parts: counter, last cycle time and what ENTER does
+        char jobText[NEXTION_FIELD_LEN];
+        jobQueue.formatStatus(jobText, sizeof(jobText));
+        nextionDisplay.setStatusLine(jobText);
+      } else {
+        nextionDisplay.setStatusLine(operationManager.getPromptText());
+      }
     } else {
-      // Show progress during operation
+      // Show progress during operation, led by the part and operation in a job
       float progress = operationManager.getProgress();
-      String progressText = "Pass " + String(operationManager.getCurrentPass() + 1) + 
-                           "/" + String(operationManager.getTotalPasses()) + 
-                           " " + String(int(progress * 100)) + "%";
-      Serial1.print("t3.txt=\"" + progressText + "\"");
-      Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+      char progressText[NEXTION_FIELD_LEN];
+      int len = 0;
+      if (jobQueue.isRunning()) {
+        len = jobQueue.formatStatus(progressText, sizeof(progressText) - 1);
+        progressText[len++] = ' ';
+      }
+      // Pass modes show the time left in the pass and in total instead of a percentage
+      const CycleEstimate& estimate = operationManager.getCycleEstimate();
+      int n;
+      if (estimate.valid) {
+        char passLeft[12], totalLeft[12];
+        formatCycleTime(estimate.passSeconds, passLeft, sizeof(passLeft));
+        formatCycleTime(estimate.totalSeconds, totalLeft, sizeof(totalLeft));
+        n = snprintf(progressText + len, sizeof(progressText) - len, "Pass %d/%d %s total %s",
+                     operationManager.getCurrentPass() + 1,
+                     operationManager.getTotalPasses(),
+                     passLeft, totalLeft);
+      } else {
+        n = snprintf(progressText + len, sizeof(progressText) - len, "Pass %d/%d %d%%",
+                     operationManager.getCurrentPass() + 1,
+                     operationManager.getTotalPasses(),
+                     int(progress * 100));
+      }
+      len = n > 0 ? min(len + n, (int)sizeof(progressText) - 1) : len;
+      if (feedOverride.isActive() && len > 0 && len < (int)sizeof(progressText)) {
+        snprintf(progressText + len, sizeof(progressText) - len, " F%d R%d",
+                 feedOverride.getFeedPercent(), feedOverride.getRapidPercent());
+      }
+      nextionDisplay.setStatusLine(progressText);
     }
   }
   
+  // One coalesced, non-blocking TX burst for everything written this tick
+  nextionDisplay.flush();
+  
   // Additional display updates can go here
   if (!splashHandled && millis() > 2000) {
     splashHandled = true;
@@ -946,9 +1032,17 @@ void taskDisplayUpdate() {
   }
 }
 
+void taskNextionReceive() {
+  // Nextion return frames - touch events feed the input queue, acks pace flush()
+  nextionDisplay.receive();
+}
+
 void taskWebUpdate() {
-  // Web interface update - runs at 50Hz (20ms)
-  webInterface.update();
+  // Web bridge - runs at 100Hz (10ms). The servers themselves run in their own
+  // task; here we only hand them a fresh snapshot and apply their commands.
+  webBridge.publishSnapshot();
+  webBridge.processCommands();
+  webInterface.showWiFiChanges();
 }
 
 void taskDiagnostics() {
@@ -965,6 +1059,8 @@ void taskDiagnostics() {
                  motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)));
     Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
     Serial.printf("Loop frequency: %d Hz\n", scheduler.getLoopFrequency());
+    inputEvents.printDiagnostics();
+    nextionDisplay.printBandwidthReport();
     Serial.println("===================\n");
     
     lastDiagnosticRun = currentTime;
@@ -985,6 +1081,29 @@ void resetArrowKeyStates() {
   statusInfo.lastKeyMode = "ESTOP_RESET";
 }
 
+void showFeedOverride() {
+  char text[NEXTION_FIELD_LEN];
+  snprintf(text, sizeof(text), "Feed %d%% Rapid %d%%%s",
+           feedOverride.getFeedPercent(), feedOverride.getRapidPercent(),
+           operationManager.isFeedOverrideLocked() ? " (feed locked)" : "");
+  nextionDisplay.showMessage(text);
+}
+
+bool isModeKey(int keyCode) {
+  return keyCode == B_MODE_GEARS || keyCode == B_MODE_TURN || keyCode == B_MODE_FACE ||
+         keyCode == B_MODE_CONE || keyCode == B_MODE_CUT || keyCode == B_MODE_THREAD ||
+         keyCode == B_MODE_ASYNC || keyCode == B_MODE_ELLIPSE || keyCode == B_MODE_GCODE;
+}
+
+void formatCycleTime(float seconds, char* text, size_t len) {
+  if (seconds < 0) {
+    snprintf(text, len, "--:--");
+    return;
+  }
+  uint32_t s = (uint32_t)(seconds + 0.5f);
+  snprintf(text, len, "%lu:%02lu", (unsigned long)(s / 60), (unsigned long)(s % 60));
+}
+
 void updateDiagnosticsDisplay() {
   // Update diagnostics information on t3 display - runs at 20Hz
   static uint32_t lastDiagnosticsUpdate = 0;
@@ -996,21 +1115,20 @@ void updateDiagnosticsDisplay() {
     diagnosticsRotation = (diagnosticsRotation + 1) % 3;
     lastDiagnosticsUpdate = currentTime;
     
-    String diagnosticsText;
+    char diagnosticsText[NEXTION_FIELD_LEN];
     switch (diagnosticsRotation) {
       case 0:
-        diagnosticsText = "X:" + String(motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X)), 2) + "mm";
+        snprintf(diagnosticsText, sizeof(diagnosticsText), "X:%.2fmm", motionControl.stepsToMM(AXIS_X, motionControl.getPosition(AXIS_X)));
         break;
       case 1:
-        diagnosticsText = "Z:" + String(motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)), 2) + "mm";
+        snprintf(diagnosticsText, sizeof(diagnosticsText), "Z:%.2fmm", motionControl.stepsToMM(AXIS_Z, motionControl.getPosition(AXIS_Z)));
         break;
-      case 2:
-        diagnosticsText = "Step:" + String(manualStepSize, 2) + "mm";
+      default:
+        snprintf(diagnosticsText, sizeof(diagnosticsText), "Step:%.2fmm", manualStepSize);
         break;
     }
     
-    Serial1.print("t3.txt=\"" + diagnosticsText + "\"");
-    Serial1.write(0xFF); Serial1.write(0xFF); Serial1.write(0xFF);
+    nextionDisplay.setStatusLine(diagnosticsText);
   }
 }
 
@@ -0,0 +1,148 @@
+// Host stress test and throughput benchmark of CircularBuffer.
+//
+// One producer thread and one consumer thread move a numbered sequence
+// through the ring the way the web task and the controller share
+// GCodeStream and WebBridge: single push/pop, batched pushN/popN and
+// zero-copy reserve/commit with peekSpan/consume, each on its own and all
+// mixed. The consumer checks that every item arrives once, in order and
+// not torn, then the items/s of each run are printed. A small ring keeps
+// both sides on the full/empty edges and the wrap; a large one measures
+// throughput.
+//
+//   g++ -O2 -std=c++17 -pthread -I nanoELS-flow -o /tmp/circular_buffer_stress tools/circular_buffer_stress.cpp
+//   /tmp/circular_buffer_stress
+
+#include "CircularBuffer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+static const uint32_t ITEMS = 4000000;
+static const size_t BATCH_MAX = 37;  // Not a power of 2, so batches straddle the wrap
+
+enum Mode { MODE_SINGLE, MODE_BATCH, MODE_SPAN, MODE_MIXED };
+static const char* const MODE_NAMES[] = {"push/pop", "pushN/popN", "reserve/peekSpan", "mixed"};
+
+// Both words are written per item, so a torn copy shows as a bad check
+struct Item {
+    uint32_t seq;
+    uint32_t check;
+};
+
+static uint32_t checkFor(uint32_t seq) {
+    return ~seq * 2654435761u;
+}
+
+template <size_t N>
+static void produce(CircularBuffer<Item, N>& ring, Mode mode) {
+    Item batch[BATCH_MAX];
+    uint32_t seq = 0;
+    uint32_t round = 0;
+    while (seq < ITEMS) {
+        Mode m = mode == MODE_MIXED ? (Mode)(round++ % 3) : mode;
+        uint32_t before = seq;
+        size_t want = 1 + (seq % BATCH_MAX);
+        if (want > ITEMS - seq) want = ITEMS - seq;
+
+        if (m == MODE_SINGLE) {
+            Item item = {seq, checkFor(seq)};
+            if (ring.push(item)) seq++;
+        } else if (m == MODE_BATCH) {
+            for (size_t i = 0; i < want; i++) {
+                batch[i] = {seq + (uint32_t)i, checkFor(seq + (uint32_t)i)};
+            }
+            seq += (uint32_t)ring.pushN(batch, want);
+        } else {
+            size_t len;
+            Item* slot = ring.reserve(len);
+            if (len > want) len = want;
+            for (size_t i = 0; i < len; i++) {
+                slot[i] = {seq + (uint32_t)i, checkFor(seq + (uint32_t)i)};
+            }
+            ring.commit(len);
+            seq += (uint32_t)len;
+        }
+        if (seq == before) {
+            std::this_thread::yield();  // Full; lets the consumer run on a single core
+        }
+    }
+}
+
+// Returns the number of bad items, 0 on success
+template <size_t N>
+static uint32_t consume(CircularBuffer<Item, N>& ring, Mode mode) {
+    Item batch[BATCH_MAX];
+    uint32_t expected = 0;
+    uint32_t errors = 0;
+    uint32_t round = 0;
+
+    auto check = [&](const Item& item) {
+        if (item.seq != expected || item.check != checkFor(item.seq)) {
+            if (errors < 5) {
+                printf("  expected %u, got seq %u check %08x\n", expected, item.seq, item.check);
+            }
+            errors++;
+            expected = item.seq;
+        }
+        expected++;
+    };
+
+    while (expected < ITEMS) {
+        Mode m = mode == MODE_MIXED ? (Mode)(round++ % 3) : mode;
+        uint32_t before = expected;
+        if (m == MODE_SINGLE) {
+            Item item;
+            if (ring.pop(item)) check(item);
+        } else if (m == MODE_BATCH) {
+            size_t n = ring.popN(batch, 1 + (expected % BATCH_MAX));
+            for (size_t i = 0; i < n; i++) check(batch[i]);
+        } else {
+            size_t len;
+            const Item* span = ring.peekSpan(len);
+            for (size_t i = 0; i < len; i++) check(span[i]);
+            ring.consume(len);
+        }
+        if (expected == before) {
+            std::this_thread::yield();  // Empty
+        }
+    }
+
+    if (!ring.empty()) {
+        printf("  %zu items left after the last one\n", ring.size());
+        errors++;
+    }
+    return errors;
+}
+
+template <size_t N>
+static bool run(Mode mode) {
+    static CircularBuffer<Item, N> ring;
+    ring.clear();
+    ring.resetPeakUtilization();
+
+    uint32_t errors = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] { produce(ring, mode); });
+    std::thread consumer([&] { errors = consume(ring, mode); });
+    producer.join();
+    consumer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%5zu slots  %-17s %7.1f M items/s  peak %4zu  %s\n", N, MODE_NAMES[mode],
+           ITEMS / seconds / 1e6, ring.getPeakUtilization(), errors == 0 ? "ok" : "FAILED");
+    return errors == 0;
+}
+
+int main() {
+    bool ok = true;
+    for (int m = MODE_SINGLE; m <= MODE_MIXED; m++) {
+        ok &= run<16>((Mode)m);
+    }
+    for (int m = MODE_SINGLE; m <= MODE_MIXED; m++) {
+        ok &= run<4096>((Mode)m);
+    }
+    printf("%s\n", ok ? "All runs passed" : "Sequence errors found");
+    return ok ? 0 : 1;
+}
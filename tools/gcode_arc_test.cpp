@@ -0,0 +1,175 @@
+// Host check of the G2/G3 chord generator.
+//
+// Cuts full circles of several radii in both directions the way
+// GCodeInterpreter does (GCodeArc chords, step rounding, GCodePlanner at a
+// fixed tick) and measures every commanded step position against the true
+// circle. Fails unless the radial error stays below one step of the finer
+// axis, the circle closes exactly and the path speed holds the feed.
+// Also compiles the same arc in I/K and R form and compares the centres.
+//
+//   g++ -O2 -std=c++17 -I nanoELS-flow -o /tmp/gcode_arc_test tools/gcode_arc_test.cpp nanoELS-flow/GCodeParser.cpp nanoELS-flow/GCodeCompiler.cpp nanoELS-flow/GCodeArc.cpp nanoELS-flow/GCodePlanner.cpp
+//   /tmp/gcode_arc_test
+
+#include "GCodeArc.h"
+#include "GCodeCompiler.h"
+#include "GCodePlanner.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static const float TICK_S = 0.0001f;
+static const float FEED_DU_SEC = 20000;   // 120 mm/min
+
+// X then Z, as in SetupConstants.cpp
+static const GCodeAxisScale SCALE = {{4000, 4000}, {40000, 50000}};
+
+static double duPerStep(int axis) {
+    return (double)SCALE.screwPitch[axis] / SCALE.motorSteps[axis];
+}
+
+struct ArcResult {
+    uint32_t chords;
+    double maxRadialDu;
+    double minSpeed;
+    double maxSpeed;
+    bool closed;
+};
+
+// Full circle starting at +Z from the centre, centre at (0, 0) in steps
+static ArcResult cutCircle(int32_t radiusDu, bool clockwise) {
+    ArcResult result = {0, 0, 1e30, 0, false};
+    int32_t origin[2] = {0, GCodeCompiler::duToSteps(SCALE, 1, radiusDu)};
+    double centerDu[2] = {0, 0};
+    double startDu[2] = {0, origin[1] * duPerStep(1)};
+    double radius = startDu[1];
+
+    PlannerLimits limits;
+    for (int axis = 0; axis < 2; axis++) {
+        limits.duPerStep[axis] = (float)duPerStep(axis);
+        limits.maxSpeed[axis] = 32000.0f * limits.duPerStep[axis];
+        limits.acceleration[axis] = 100000.0f * limits.duPerStep[axis];
+    }
+    limits.junctionDeviation = GCODE_JUNCTION_DEVIATION_DU;
+    static GCodePlanner planner;
+    planner.reset(origin, limits);
+
+    GCodeArc arc;
+    int32_t center[2] = {0, -(int32_t)lround(startDu[1])};
+    int32_t end[2] = {0, 0};
+    if (!arc.begin(center, end, clockwise)) {
+        return result;
+    }
+    result.chords = arc.getChords();
+
+    int32_t last[2] = {origin[0], origin[1]};
+    std::vector<double> speeds;
+    while (!arc.isDone() || !planner.isEmpty()) {
+        while (!arc.isDone() && !planner.isFull()) {
+            int32_t point[2];
+            arc.next(point);
+            if (arc.isDone()) {
+                planner.addLine(origin, FEED_DU_SEC);
+                last[0] = origin[0];
+                last[1] = origin[1];
+                break;
+            }
+            GCodeAxisScale substeps = SCALE;
+            int32_t target[2];
+            for (int axis = 0; axis < 2; axis++) {
+                substeps.motorSteps[axis] *= 1 << GCODE_SUBSTEP_BITS;
+                target[axis] = origin[axis] * (1 << GCODE_SUBSTEP_BITS) +
+                               GCodeCompiler::duToSteps(substeps, axis, point[axis]);
+            }
+            planner.addLineSubsteps(target, FEED_DU_SEC);
+        }
+
+        int32_t at[2];
+        planner.advance(TICK_S, at);
+        double x = at[0] * duPerStep(0) - centerDu[0];
+        double z = at[1] * duPerStep(1) - centerDu[1];
+        double error = fabs(sqrt(x * x + z * z) - radius);
+        if (error > result.maxRadialDu) {
+            result.maxRadialDu = error;
+        }
+        speeds.push_back(planner.getSpeed());
+    }
+
+    // Feed away from the acceleration at the start and braking at the end
+    for (size_t i = speeds.size() / 10; i < speeds.size() * 9 / 10; i++) {
+        if (speeds[i] < result.minSpeed) result.minSpeed = speeds[i];
+        if (speeds[i] > result.maxSpeed) result.maxSpeed = speeds[i];
+    }
+    result.closed = last[0] == origin[0] && last[1] == origin[1];
+    return result;
+}
+
+class LastCenter : public GCodeRecordSink {
+public:
+    int32_t center[2] = {0, 0};
+    bool put(const GCodeRecord& record) override {
+        if (record.type == GCODE_REC_ARC_CENTER) {
+            center[0] = record.a;
+            center[1] = record.b;
+        }
+        return true;
+    }
+};
+
+static bool compileArc(const char* text, LastCenter& out) {
+    GCodeCompiler compiler;
+    compiler.reset(SCALE);
+    const char* setup = "G90 G0 X0 Z0";
+    compiler.compileLine(setup, strlen(setup), 1, out);
+    if (!compiler.compileLine(text, strlen(text), 2, out)) {
+        printf("  %s: %s\n", text, compiler.getError());
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    bool ok = true;
+    double limit = duPerStep(0) < duPerStep(1) ? duPerStep(0) : duPerStep(1);
+
+    printf("radius      dir  chords  radial error  feed min..max (du/s)\n");
+    const int32_t radii[] = {5000, 20000, 100000, 500000, 3000000};
+    for (int32_t radius : radii) {
+        for (int dir = 0; dir < 2; dir++) {
+            ArcResult r = cutCircle(radius, dir == 0);
+            bool pass = r.closed && r.maxRadialDu < limit &&
+                        r.minSpeed > FEED_DU_SEC * 0.99 && r.maxSpeed <= FEED_DU_SEC * 1.001;
+            printf("%7.1fmm  %s  %6u  %6.2f du      %.0f..%.0f %s\n", radius / 10000.0,
+                   dir == 0 ? "G2" : "G3", r.chords, r.maxRadialDu, r.minSpeed, r.maxSpeed,
+                   pass ? "ok" : "FAIL");
+            ok = ok && pass;
+        }
+    }
+
+    // From X0 Z0 to X5 Z-5: the short way round is a quarter circle about
+    // X5 Z0 clockwise or X0 Z-5 counter-clockwise; negative R takes the
+    // other centre
+    const char* forms[][2] = {
+        {"G2 X5 Z-5 I5 K0", "G2 X5 Z-5 R5"},
+        {"G3 X5 Z-5 I0 K-5", "G3 X5 Z-5 R5"},
+        {"G2 X5 Z-5 I0 K-5", "G2 X5 Z-5 R-5"},
+        {"G3 X5 Z-5 I5 K0", "G3 X5 Z-5 R-5"},
+    };
+    for (auto& form : forms) {
+        LastCenter ik, r;
+        bool same = compileArc(form[0], ik) && compileArc(form[1], r) &&
+                    ik.center[0] == r.center[0] && ik.center[1] == r.center[1];
+        printf("%-20s = %-16s centre %d,%d %s\n", form[0], form[1], r.center[0], r.center[1],
+               same ? "ok" : "FAIL");
+        ok = ok && same;
+    }
+
+    LastCenter bad;
+    bool rejected = !compileArc("G2 X5 Z-5 I0 K-4", bad);
+    printf("off-radius I/K rejected %s\n", rejected ? "ok" : "FAIL");
+    ok = ok && rejected;
+
+    printf("%s (limit %.1f du = one X step)\n", ok ? "PASS" : "FAIL", limit);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+// Host benchmark of the G-code tokenizer used in G-code mode.
+//
+// Generates a 1 MB turning program (or reads the file given as argument),
+// then splits and parses it repeatedly the same way GCodeInterpreter does
+// and prints the throughput in lines/s. No Arduino headers involved.
+//
+//   g++ -O2 -std=c++17 -I nanoELS-flow -o /tmp/gcode_parse_bench tools/gcode_parse_bench.cpp nanoELS-flow/GCodeParser.cpp
+//   /tmp/gcode_parse_bench [program.gcode]
+
+#include "GCodeParser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static const size_t PROGRAM_BYTES = 1 << 20;
+static const int ROUNDS = 20;
+
+static std::string generateProgram() {
+    std::string program = "%\n(Generated roughing program)\nG21 G90 G94 G18\nF120\n";
+    char line[96];
+    int n = 10;
+    while (program.size() < PROGRAM_BYTES) {
+        double x = 10.0 - (n % 500) * 0.0125;
+        double z = -0.25 * (n % 200);
+        snprintf(line, sizeof(line), "N%d G1 X%.4f Z%.4f ; pass %d\n", n, x, z, n / 200);
+        program += line;
+        snprintf(line, sizeof(line), "N%d G0 X%.3f\n", n + 1, x + 0.5);
+        program += line;
+        n += 2;
+    }
+    program += "M30\n%\n";
+    return program;
+}
+
+static bool readProgram(const char* path, std::string& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        out.append(buffer, n);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::string program;
+    if (argc > 1) {
+        if (!readProgram(argv[1], program)) {
+            fprintf(stderr, "cannot read %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        program = generateProgram();
+    }
+
+    GCodeBlock block;
+    size_t lines = 0;
+    size_t errors = 0;
+    int64_t checksum = 0;  // Keeps the optimiser from dropping the parse
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        const char* p = program.data();
+        const char* end = p + program.size();
+        while (p < end) {
+            const char* eol = (const char*)memchr(p, '\n', end - p);
+            if (!eol) {
+                eol = end;
+            }
+            if (GCodeParser::parse(p, eol - p, block)) {
+                checksum += block.words + block.gCount;
+                if (block.has('X')) {
+                    checksum += block.get('X');
+                }
+            } else {
+                errors++;
+            }
+            lines++;
+            p = eol + 1;
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    printf("%zu bytes, %zu lines x %d rounds in %.3f s\n",
+           program.size(), lines / ROUNDS, ROUNDS, elapsed);
+    printf("%.0f lines/s, %.1f MB/s, %zu errors (checksum %lld)\n",
+           lines / elapsed, program.size() * ROUNDS / elapsed / 1e6,
+           errors / ROUNDS, (long long)checksum);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+// Host simulation of the G-code look-ahead planner.
+//
+// Compiles a profile program with GCodeCompiler, runs the records through
+// GCodePlanner at a fixed tick and reports the cycle time with junction blending against
+// stop-and-go (junction deviation 0, every move starts and ends at rest,
+// which is what h5.ino's wait after each move amounts to).
+//
+//   g++ -O2 -std=c++17 -I nanoELS-flow -o /tmp/gcode_planner_sim tools/gcode_planner_sim.cpp nanoELS-flow/GCodeParser.cpp nanoELS-flow/GCodeCompiler.cpp nanoELS-flow/GCodeArc.cpp nanoELS-flow/GCodePlanner.cpp
+//   /tmp/gcode_planner_sim [program.gcode]
+//
+// Without an argument a built-in profile is used: facing, a 10mm radius
+// ball end in 0.25mm chords, a taper and a chamfer. Axis limits and
+// scales are the SetupConstants.cpp defaults.
+
+#include "GCodeCompiler.h"
+#include "GCodePlanner.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const float TICK_S = 0.0001f;   // 10 kHz, about the controller loop rate
+
+static std::string builtInProfile() {
+    std::string program = "G21 G90 G94\nG0 X12 Z1\nG1 X0 Z1 F300\nG0 X0 Z2\nG0 X0 Z0\nF240\n";
+    char line[64];
+    const double radius = 10.0;
+    const int chords = (int)(radius * M_PI / 2 / 0.25);
+    for (int i = 1; i <= chords; i++) {
+        double a = (M_PI / 2) * i / chords;
+        snprintf(line, sizeof(line), "G1 X%.4f Z%.4f\n", radius * sin(a), -radius + radius * cos(a));
+        program += line;
+    }
+    program += "G1 X12 Z-30\n";         // Taper
+    program += "G1 X12 Z-40\n";
+    program += "G1 X13 Z-41\n";         // Chamfer
+    program += "G0 X15\nG0 Z1\nM30\n";
+    return program;
+}
+
+static bool readProgram(const char* path, std::string& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        out.append(buffer, n);
+    }
+    fclose(f);
+    return true;
+}
+
+// X then Z, as in SetupConstants.cpp
+static const GCodeAxisScale SCALE = {{4000, 4000}, {40000, 50000}};
+
+class RecordList : public GCodeRecordSink {
+public:
+    std::vector<GCodeRecord> records;
+    bool put(const GCodeRecord& record) override {
+        records.push_back(record);
+        return true;
+    }
+};
+
+static bool compileProgram(const std::string& program, RecordList& out) {
+    GCodeCompiler compiler;
+    compiler.reset(SCALE);
+    const char* p = program.data();
+    const char* end = p + program.size();
+    uint32_t line = 0;
+    while (p < end) {
+        const char* eol = (const char*)memchr(p, '\n', end - p);
+        if (!eol) {
+            eol = end;
+        }
+        if (!compiler.compileLine(p, eol - p, ++line, out)) {
+            fprintf(stderr, "%s\n", compiler.getError());
+            return false;
+        }
+        p = eol + 1;
+    }
+    return true;
+}
+
+struct SimResult {
+    double seconds;
+    size_t moves;
+    double maxSpeed;
+};
+
+static SimResult simulate(const std::vector<GCodeRecord>& records, float junctionDeviation) {
+    PlannerLimits limits;
+    for (int axis = 0; axis < 2; axis++) {
+        limits.duPerStep[axis] = (float)SCALE.screwPitch[axis] / SCALE.motorSteps[axis];
+        limits.maxSpeed[axis] = 32000.0f * limits.duPerStep[axis];      // SPEED_MANUAL_MOVE_X/Z
+        limits.acceleration[axis] = 100000.0f * limits.duPerStep[axis]; // ACCELERATION_X/Z
+    }
+    limits.junctionDeviation = junctionDeviation;
+
+    static GCodePlanner planner;
+    int32_t start[2] = {0, 0};
+    planner.reset(start, limits);
+
+    float feed = GCODE_FEED_DEFAULT_DU_SEC;
+    SimResult result = {0, 0, 0};
+
+    size_t next = 0;
+    while (next < records.size() || !planner.isEmpty()) {
+        // Same rule as the interpreter: queue only while there is room
+        while (next < records.size() && !planner.isFull()) {
+            const GCodeRecord& r = records[next++];
+            if (r.type == GCODE_REC_FEED) {
+                feed = r.a;
+            } else if (r.type == GCODE_REC_RAPID || r.type == GCODE_REC_LINE) {
+                int32_t target[2] = {r.a, r.b};  // Start is 0, FROM_START needs no offset
+                planner.addLine(target, r.type == GCODE_REC_RAPID ? 0 : feed);
+                result.moves++;
+            }
+        }
+
+        int32_t at[2];
+        planner.advance(TICK_S, at);
+        result.seconds += TICK_S;
+        if (planner.getSpeed() > result.maxSpeed) {
+            result.maxSpeed = planner.getSpeed();
+        }
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::string program;
+    if (argc > 1) {
+        if (!readProgram(argv[1], program)) {
+            fprintf(stderr, "cannot read %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        program = builtInProfile();
+    }
+
+    RecordList compiled;
+    if (!compileProgram(program, compiled)) {
+        return 1;
+    }
+    SimResult blended = simulate(compiled.records, GCODE_JUNCTION_DEVIATION_DU);
+    SimResult stopGo = simulate(compiled.records, 0);
+
+    printf("%zu moves, look-ahead window %d segments\n", blended.moves, GCODE_PLANNER_SEGMENTS);
+    printf("stop-and-go : %8.3f s\n", stopGo.seconds);
+    printf("look-ahead  : %8.3f s (peak %.1f mm/s)\n", blended.seconds, blended.maxSpeed / 10000);
+    printf("saved       : %8.3f s (%.0f%%)\n", stopGo.seconds - blended.seconds,
+           100.0 * (stopGo.seconds - blended.seconds) / stopGo.seconds);
+    return 0;
+}
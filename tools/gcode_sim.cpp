@@ -0,0 +1,82 @@
+// Command line dry run of a G-code program, for checking CAM output.
+//
+// Compiles the program with the controller's GCodeCompiler and runs the
+// records through GCodeSimulator, the same code behind the web UI's
+// simulate action and the "sim" serial command, then prints its report.
+// Axis scales and limits are the SetupConstants.cpp defaults; the program
+// starts at X0 Z0 and the soft limits are +-MAX_TRAVEL_MM around it.
+//
+//   g++ -O2 -std=c++17 -I nanoELS-flow -o /tmp/gcode_sim tools/gcode_sim.cpp nanoELS-flow/GCodeParser.cpp nanoELS-flow/GCodeCompiler.cpp nanoELS-flow/GCodeArc.cpp nanoELS-flow/GCodePlanner.cpp nanoELS-flow/GCodeSimulator.cpp
+//   /tmp/gcode_sim program.gcode [spindle rpm]
+//
+// Exit status is 1 on a compile error, 2 when a point is outside the soft
+// limits, 0 otherwise.
+
+#include "GCodeCompiler.h"
+#include "GCodeSimulator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// X then Z, as in SetupConstants.cpp
+static const GCodeAxisScale SCALE = {{4000, 4000}, {40000, 50000}};
+static const int32_t MAX_TRAVEL_MM[2] = {100, 300};
+static const float MAX_SPEED_STEPS = 32000.0f;       // SPEED_MANUAL_MOVE_X/Z
+static const float ACCELERATION_STEPS = 100000.0f;   // ACCELERATION_X/Z
+
+static GCodeSimulator simulator;
+static GCodeCompiler compiler;
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s program.gcode [spindle rpm]\n", argv[0]);
+        return 1;
+    }
+    FILE* file = fopen(argv[1], "r");
+    if (!file) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    GCodeSimSetup setup = {};
+    setup.scale = SCALE;
+    for (int axis = 0; axis < 2; axis++) {
+        setup.limits.duPerStep[axis] = (float)SCALE.screwPitch[axis] / SCALE.motorSteps[axis];
+        setup.limits.maxSpeed[axis] = MAX_SPEED_STEPS * setup.limits.duPerStep[axis];
+        setup.limits.acceleration[axis] = ACCELERATION_STEPS * setup.limits.duPerStep[axis];
+        setup.maxSteps[axis] = GCodeCompiler::duToSteps(SCALE, axis, MAX_TRAVEL_MM[axis] * 10000);
+        setup.minSteps[axis] = -setup.maxSteps[axis];
+    }
+    setup.limits.junctionDeviation = GCODE_JUNCTION_DEVIATION_DU;
+    setup.spindleRpm = argc > 2 ? atoi(argv[2]) : 0;
+
+    auto started = std::chrono::steady_clock::now();
+    simulator.begin(setup);
+    compiler.reset(SCALE);
+    char text[256];
+    uint32_t line = 0;
+    bool ok = true;
+    while (ok && fgets(text, sizeof(text), file)) {
+        size_t len = strcspn(text, "\r\n");
+        ok = compiler.compileLine(text, len, ++line, simulator);
+        while (ok && compiler.isExpanding()) {
+            ok = compiler.expand(simulator);
+        }
+    }
+    fclose(file);
+    ok = ok && compiler.finishProgram(line);
+    if (!ok) {
+        fprintf(stderr, "%s: %s\n", argv[1], compiler.getError());
+        return 1;
+    }
+
+    const GCodeSimResult& result = simulator.finish();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    static char report[1024];
+    GCodeSimulator::format(result, SCALE, report, sizeof(report));
+    fputs(report, stdout);
+    printf("simulated in %.1f ms\n", ms);
+    return result.limitViolations > 0 ? 2 : 0;
+}
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Stream a G-code file to the controller over the WebSocket.
+
+Sends lines with the ">" command and never more bytes than the controller
+has granted as credits. Credits come back in every ack ("@<seq> > ok <n>")
+and as unsolicited "C<n>" messages while the controller drains its buffer.
+
+    python3 tools/gcode_stream.py 192.168.1.50 part.gcode
+
+Prints the achieved rate at the end; the controller's own view (sustained
+lines/s, underruns) is on http://<ip>/status under GCodeStream.*.
+Uses only the standard library.
+"""
+
+import base64
+import os
+import socket
+import struct
+import sys
+import time
+
+PORT = 81
+FRAME_BYTES = 1024  # Upper bound per WebSocket message
+
+
+def connect(host):
+    sock = socket.create_connection((host, PORT), timeout=10)
+    key = base64.b64encode(os.urandom(16)).decode()
+    sock.sendall((
+        "GET / HTTP/1.1\r\n"
+        f"Host: {host}:{PORT}\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        f"Sec-WebSocket-Key: {key}\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n").encode())
+    response = b""
+    while b"\r\n\r\n" not in response:
+        chunk = sock.recv(1024)
+        if not chunk:
+            raise ConnectionError("handshake failed")
+        response += chunk
+    if b" 101 " not in response.split(b"\r\n", 1)[0]:
+        raise ConnectionError(response.split(b"\r\n", 1)[0].decode())
+    return sock
+
+
+def send_text(sock, text):
+    payload = text.encode()
+    mask = os.urandom(4)
+    header = bytes([0x81])
+    if len(payload) < 126:
+        header += bytes([0x80 | len(payload)])
+    else:
+        header += bytes([0x80 | 126]) + struct.pack(">H", len(payload))
+    masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+    sock.sendall(header + mask + masked)
+
+
+def recv_exact(sock, n):
+    data = b""
+    while len(data) < n:
+        chunk = sock.recv(n - len(data))
+        if not chunk:
+            raise ConnectionError("connection closed")
+        data += chunk
+    return data
+
+
+def recv_text(sock):
+    """Next text message; binary telemetry frames are skipped."""
+    while True:
+        b0, b1 = recv_exact(sock, 2)
+        length = b1 & 0x7F
+        if length == 126:
+            length = struct.unpack(">H", recv_exact(sock, 2))[0]
+        elif length == 127:
+            length = struct.unpack(">Q", recv_exact(sock, 8))[0]
+        payload = recv_exact(sock, length)
+        if b0 & 0x0F == 0x1:
+            return payload.decode(errors="replace")
+        if b0 & 0x0F == 0x8:
+            raise ConnectionError("closed by controller")
+
+
+def parse_credits(message):
+    """Credits from an ack or a C<n> update, None for other messages."""
+    if message.startswith("C"):
+        return int(message[1:])
+    parts = message.split()
+    if len(parts) >= 4 and parts[1] == ">" and parts[2] == "ok":
+        return int(parts[3])
+    if len(parts) >= 3 and parts[1] == ">" and parts[2] == "err":
+        raise RuntimeError(message)
+    return None
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+    host, path = sys.argv[1], sys.argv[2]
+
+    with open(path, encoding="utf-8") as f:
+        lines = [line.split(";")[0].strip() for line in f]
+    lines = [line for line in lines if line]
+    lines.append("%")
+
+    sock = connect(host)
+    sock.settimeout(30)
+    send_text(sock, ">")
+    credits = None
+    while credits is None:
+        credits = parse_credits(recv_text(sock))
+
+    start = time.time()
+    stalls = 0
+    i = 0
+    while i < len(lines):
+        # Pack as many lines as the credits and the frame size allow
+        batch = []
+        cost = 0
+        while i < len(lines):
+            size = len(lines[i]) + 1
+            if cost + size > credits or cost + size > FRAME_BYTES:
+                break
+            batch.append(lines[i])
+            cost += size
+            i += 1
+
+        if batch:
+            send_text(sock, ">" + "\n".join(batch))
+            credits -= cost
+        else:
+            stalls += 1
+
+        # Wait for the ack or a credit update before sending more
+        update = None
+        while update is None:
+            update = parse_credits(recv_text(sock))
+        credits = update
+
+    elapsed = time.time() - start
+    print(f"{len(lines) - 1} lines in {elapsed:.2f} s, "
+          f"{(len(lines) - 1) / max(elapsed, 1e-6):.0f} lines/s, "
+          f"{stalls} waits for credits")
+    sock.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
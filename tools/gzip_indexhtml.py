@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Embed a gzip-compressed copy of the web UI for the controller.
+
+Reads the raw literal from nanoELS-flow/indexhtml.h and writes
+nanoELS-flow/indexhtml_gz.h with the compressed bytes and an ETag derived
+from the uncompressed content. Run it after every change to indexhtml.h:
+
+    python3 tools/gzip_indexhtml.py
+
+Output is deterministic (no timestamp in the gzip header), so an unchanged
+page produces an unchanged header and ETag.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCH = os.path.join(ROOT, "nanoELS-flow")
+SOURCE = os.path.join(SKETCH, "indexhtml.h")
+TARGET = os.path.join(SKETCH, "indexhtml_gz.h")
+
+
+def main():
+    with open(SOURCE, encoding="utf-8") as f:
+        text = f.read()
+
+    match = re.search(r'R"rawliteral\((.*)\)rawliteral"', text, re.S)
+    if not match:
+        sys.exit("indexhtml.h: raw literal not found")
+    html = match.group(1).encode("utf-8")
+
+    compressed = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(html).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(compressed), 16):
+        chunk = compressed[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    with open(TARGET, "w", encoding="utf-8", newline="\n") as f:
+        f.write("#ifndef INDEXHTML_GZ_H\n")
+        f.write("#define INDEXHTML_GZ_H\n\n")
+        f.write("// Generated by tools/gzip_indexhtml.py from indexhtml.h - do not edit\n")
+        f.write("// %d bytes -> %d bytes gzip\n\n" % (len(html), len(compressed)))
+        f.write('#define INDEXHTML_ETAG "\\"%s\\""\n\n' % etag)
+        f.write("const size_t indexhtml_gz_len = %d;\n" % len(compressed))
+        f.write("const uint8_t indexhtml_gz[] PROGMEM = {\n")
+        f.write("\n".join(lines) + "\n")
+        f.write("};\n\n")
+        f.write("#endif // INDEXHTML_GZ_H\n")
+
+    print("%s: %d -> %d bytes, ETag %s" % (os.path.relpath(TARGET, ROOT), len(html), len(compressed), etag))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,336 @@
+// Host load test of the web task / controller split (WebBridge).
+//
+// A controller thread runs a 1 kHz motion tick: every tick it checks the
+// web E-stop flag, every 10th tick it publishes a snapshot and drains the
+// command ring, as taskEmergencyCheck and taskWebUpdate do. Many client
+// threads fire status, jog, E-stop and large page requests at once. The
+// run is made three times:
+// - idle: no clients, shows the wake-up jitter of the host itself
+// - inline: the controller serves one request per tick, the way
+//   WebInterface::update() called handleClient() from the scheduler
+// - bridged: a web thread serves them and talks to the controller only
+//   through the snapshot, the command ring and the E-stop flag
+//
+// The bridged run fails if a controller loop takes longer than its bound
+// (the scheduler's max loop time), if an E-stop posted by a handler is not
+// seen by the next tick, or if a queued move is lost or run twice. Wake-up
+// lateness and E-stop time from the client are printed but not checked:
+// on a shared host they measure the host. The ring is the sketch's
+// CircularBuffer; a priority-inheriting mutex stands in for portMUX, whose
+// holder cannot be preempted. The controller asks for real-time priority,
+// standing in for the core the scheduler loop has to itself on the ESP32.
+//
+//   g++ -O2 -std=c++17 -pthread -I nanoELS-flow -o /tmp/web_bridge_load tools/web_bridge_load.cpp
+//   /tmp/web_bridge_load [clients]
+
+#include "CircularBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#include <vector>
+
+static const int DEFAULT_CLIENTS = 32;
+static const int RUN_MS = 2000;
+static const int TICK_US = 1000;               // Motion tick
+static const int WEB_UPDATE_TICKS = 10;        // Snapshot and commands at 100 Hz
+static const int LARGE_RESPONSE_MS = 20;       // Web UI page to a slow client
+static const int64_t LOOP_LIMIT_US = 5000;     // Controller work per tick: far below one large response
+static const uint32_t ESTOP_LIMIT_TICKS = 1;
+
+static int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// ---------------------------------------------------------------------------
+// Bridge stand-in: same shape as WebBridge
+// ---------------------------------------------------------------------------
+
+struct Snapshot {
+    int32_t position[2];
+    uint32_t speed[2];
+    int64_t publishedUs;
+    uint32_t ticks;
+};
+
+struct Command {
+    uint8_t axis;
+    int32_t steps;
+};
+
+class SnapshotLock {
+private:
+    pthread_mutex_t mutex;
+
+public:
+    SnapshotLock() {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+        pthread_mutex_init(&mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+    }
+    ~SnapshotLock() { pthread_mutex_destroy(&mutex); }
+    void lock() { pthread_mutex_lock(&mutex); }
+    void unlock() { pthread_mutex_unlock(&mutex); }
+};
+
+struct Bridge {
+    SnapshotLock snapshotLock;
+    Snapshot snapshot = {};
+    CircularBuffer<Command, 16> commands;
+    std::atomic<uint32_t> posted{0};
+    std::atomic<uint32_t> dropped{0};
+
+    // E-stop flag, with when it was sent and posted for the statistics
+    std::atomic<bool> stopRequested{false};
+    std::atomic<int64_t> stopSentUs{0};
+    std::atomic<uint32_t> stopPostedTick{0};
+    std::atomic<uint32_t> currentTick{0};
+
+    void publish(const Snapshot& fresh) {
+        std::lock_guard<SnapshotLock> guard(snapshotLock);
+        snapshot = fresh;
+    }
+    void read(Snapshot& out) {
+        std::lock_guard<SnapshotLock> guard(snapshotLock);
+        out = snapshot;
+    }
+    void postMove(uint8_t axis, int32_t steps) {
+        posted++;
+        if (!commands.push({axis, steps})) dropped++;
+    }
+    void requestStop(int64_t sentUs) {
+        stopSentUs = sentUs;
+        stopPostedTick = currentTick.load();
+        stopRequested = true;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Requests: clients queue them like connections waiting in the listen backlog
+// ---------------------------------------------------------------------------
+
+enum RequestKind { REQ_STATUS, REQ_JOG, REQ_ESTOP, REQ_LARGE };
+
+struct Request {
+    RequestKind kind;
+    int64_t sentUs;
+    std::promise<void> done;
+};
+
+struct Backlog {
+    std::mutex lock;
+    std::condition_variable ready;
+    std::deque<Request*> queue;
+
+    void push(Request* request) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            queue.push_back(request);
+        }
+        ready.notify_one();
+    }
+    Request* tryPop() {
+        std::lock_guard<std::mutex> guard(lock);
+        if (queue.empty()) return nullptr;
+        Request* request = queue.front();
+        queue.pop_front();
+        return request;
+    }
+    Request* waitPop(const std::atomic<bool>& running) {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait_for(guard, std::chrono::milliseconds(1), [&] { return !queue.empty() || !running; });
+        if (queue.empty()) return nullptr;
+        Request* request = queue.front();
+        queue.pop_front();
+        return request;
+    }
+    bool withdraw(Request* request) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = std::find(queue.begin(), queue.end(), request);
+        if (it == queue.end()) return false;
+        queue.erase(it);
+        return true;
+    }
+};
+
+static char responseText[1024];
+
+static void serve(Bridge& bridge, Request* request) {
+    Snapshot snapshot;
+    switch (request->kind) {
+        case REQ_STATUS:
+            bridge.read(snapshot);
+            snprintf(responseText, sizeof(responseText),
+                     "X=%d Z=%d\nSpeedX=%u SpeedZ=%u\nTicks=%u\nAge=%lld us\n",
+                     snapshot.position[0], snapshot.position[1], snapshot.speed[0], snapshot.speed[1],
+                     snapshot.ticks, (long long)(nowUs() - snapshot.publishedUs));
+            break;
+        case REQ_JOG:
+            bridge.postMove(1, 100);
+            break;
+        case REQ_ESTOP:
+            bridge.requestStop(request->sentUs);
+            break;
+        case REQ_LARGE:
+            // Synchronous send: the handler sits here until the client took it all
+            std::this_thread::sleep_for(std::chrono::milliseconds(LARGE_RESPONSE_MS));
+            break;
+    }
+    request->done.set_value();
+}
+
+// ---------------------------------------------------------------------------
+// One run
+// ---------------------------------------------------------------------------
+
+struct Result {
+    std::vector<int64_t> lateUs;       // Wake-up after the tick was due
+    std::vector<int64_t> loopUs;       // Controller work in the tick
+    std::vector<int64_t> estopUs;      // Client sent to controller saw it
+    uint32_t estopTicksMax;            // Handler posted to controller saw it
+    uint32_t requests;
+    uint32_t moved;
+    bool countsMatch;
+    bool realTime;
+};
+
+static int64_t percentile(std::vector<int64_t>& values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[(size_t)(p * (values.size() - 1))];
+}
+
+static Result run(bool bridged, int clients) {
+    Bridge bridge;
+    Backlog backlog;
+    std::atomic<bool> running{true};
+    std::atomic<uint32_t> requests{0};
+    Result result = {};
+    result.lateUs.reserve(RUN_MS + 16);
+    result.loopUs.reserve(RUN_MS + 16);
+
+    std::thread controller([&] {
+        sched_param param = {};
+        param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+        result.realTime = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+
+        Snapshot state = {};
+        int64_t next = nowUs();
+        int64_t end = next + RUN_MS * 1000LL;
+        for (uint32_t tick = 1; next < end; tick++) {
+            next += TICK_US;
+            std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::microseconds(next)));
+            int64_t start = nowUs();
+            result.lateUs.push_back(start - next);
+            bridge.currentTick = tick;
+
+            if (bridge.stopRequested.exchange(false)) {
+                result.estopUs.push_back(start - bridge.stopSentUs);
+                result.estopTicksMax = std::max(result.estopTicksMax, tick - bridge.stopPostedTick);
+            }
+
+            state.ticks = tick;
+            if (tick % WEB_UPDATE_TICKS == 0) {
+                state.publishedUs = start;
+                bridge.publish(state);
+                Command command;
+                while (bridge.commands.pop(command)) {
+                    state.position[command.axis] += command.steps;
+                    result.moved++;
+                }
+            }
+
+            if (!bridged) {
+                Request* request = backlog.tryPop();
+                if (request) serve(bridge, request);
+            }
+            result.loopUs.push_back(nowUs() - start);
+        }
+        running = false;
+    });
+
+    std::thread web;
+    if (bridged) {
+        web = std::thread([&] {
+            while (running) {
+                Request* request = backlog.waitPop(running);
+                if (request) serve(bridge, request);
+            }
+        });
+    }
+
+    std::vector<std::thread> pool;
+    for (int c = 0; c < clients; c++) {
+        pool.emplace_back([&, c] {
+            for (uint32_t i = c; running; i++) {
+                RequestKind kind = i % 25 == 0 ? REQ_ESTOP : i % 8 == 0 ? REQ_LARGE : i % 3 == 0 ? REQ_JOG : REQ_STATUS;
+                Request request = {kind, nowUs(), {}};
+                std::future<void> done = request.done.get_future();
+                backlog.push(&request);
+                while (done.wait_for(std::chrono::milliseconds(5)) != std::future_status::ready) {
+                    // Nobody serves it any more; take it back unless already taken
+                    if (!running && backlog.withdraw(&request)) return;
+                }
+                requests++;
+            }
+        });
+    }
+
+    controller.join();
+    for (std::thread& client : pool) client.join();
+    if (web.joinable()) web.join();
+
+    result.requests = requests;
+
+    // Every accepted move is executed or still queued, none twice
+    uint32_t queued = bridge.posted - bridge.dropped - result.moved;
+    result.countsMatch = bridge.commands.size() == queued;
+    if (!result.countsMatch) {
+        printf("  command count mismatch: posted %u dropped %u executed %u\n",
+               (unsigned)bridge.posted, (unsigned)bridge.dropped, result.moved);
+    }
+    return result;
+}
+
+static bool report(const char* name, Result& r, bool checked) {
+    int64_t loopMax = percentile(r.loopUs, 1.0);
+    bool ok = loopMax <= LOOP_LIMIT_US && r.estopTicksMax <= ESTOP_LIMIT_TICKS && r.countsMatch;
+    printf("%-8s %5u req/s  loop max %7lld us  late p50 %5lld p99 %7lld max %7lld us  "
+           "E-stop %u ticks, from client max %7lld us  moves %u  %s\n",
+           name, (unsigned)(r.requests * 1000 / RUN_MS), (long long)loopMax, (long long)percentile(r.lateUs, 0.5),
+           (long long)percentile(r.lateUs, 0.99), (long long)percentile(r.lateUs, 1.0), r.estopTicksMax,
+           (long long)percentile(r.estopUs, 1.0), r.moved, !checked ? "(reference)" : ok ? "ok" : "OVER LIMIT");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    int clients = argc > 1 ? atoi(argv[1]) : DEFAULT_CLIENTS;
+    if (clients < 1) clients = 1;
+    printf("%d clients, %d ms per run, limits: loop %lld us, E-stop %u tick\n", clients, RUN_MS,
+           (long long)LOOP_LIMIT_US, ESTOP_LIMIT_TICKS);
+
+    Result idleRun = run(true, 0);
+    if (!idleRun.realTime) {
+        printf("No real-time priority for the controller (not root?), expect host jitter\n");
+    }
+    report("idle", idleRun, false);
+    Result inlineRun = run(false, clients);
+    report("inline", inlineRun, false);
+    Result bridgedRun = run(true, clients);
+    bool ok = report("bridged", bridgedRun, true);
+    return ok ? 0 : 1;
+}